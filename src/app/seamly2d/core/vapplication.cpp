@@ -59,6 +59,7 @@
 #include "../ifc/exception/vexceptionconversionerror.h"
 #include "../ifc/exception/vexceptionemptyparameter.h"
 #include "../ifc/exception/vexceptionwrongid.h"
+#include "../ifc/xml/vdomdocument.h"
 #include "../vmisc/logging.h"
 #include "../vmisc/vmath.h"
 #include "../qmuparser/qmuparsererror.h"
@@ -708,6 +709,10 @@ void VApplication::OpenSettings()
 {
     settings = new VSettings(QSettings::IniFormat, QSettings::UserScope, QCoreApplication::organizationName(),
                              QCoreApplication::applicationName(), this);
+
+    // Stamps of validated files live next to the settings, so console runs don't validate the same file again.
+    VDomDocument::SetValidationStampsFile(QFileInfo(settings->fileName()).absolutePath()
+                                          + QLatin1String("/validation.stamps"));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -43,6 +43,86 @@ VCommandLinePtr VCommandLine::instance = nullptr;
 
 #define translate(context, source) QCoreApplication::translate((context), (source))
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ExpandGradationValues turns the values of a gradation option into a list of sizes or heights.
+ *
+ * Each value may be a single number, a comma separated list or a range like "46-56". A range takes every valid value
+ * between its bounds.
+ */
+QStringList ExpandGradationValues(const QStringList &values, const QStringList &valid, bool &ok)
+{
+    ok = true;
+    QStringList list;
+    for (const QString &value : values)
+    {
+        const QStringList parts = value.split(QChar(','));
+        for (const QString &part : parts)
+        {
+            const QString token = part.trimmed();
+            if (token.isEmpty())
+            {
+                continue;
+            }
+
+            const QStringList bounds = token.split(QChar('-'));
+            if (bounds.size() == 2)
+            {
+                bool okLow = false;
+                bool okHigh = false;
+                const int low = bounds.at(0).trimmed().toInt(&okLow);
+                const int high = bounds.at(1).trimmed().toInt(&okHigh);
+                if (not okLow || not okHigh || low > high)
+                {
+                    ok = false;
+                    return QStringList();
+                }
+
+                bool found = false;
+                for (const QString &item : valid)
+                {
+                    const int number = item.toInt();
+                    if (number >= low && number <= high)
+                    {
+                        found = true;
+                        if (not list.contains(item))
+                        {
+                            list.append(item);
+                        }
+                    }
+                }
+
+                if (not found)
+                {
+                    ok = false;
+                    return QStringList();
+                }
+            }
+            else if (valid.contains(token))
+            {
+                if (not list.contains(token))
+                {
+                    list.append(token);
+                }
+            }
+            else
+            {
+                ok = false;
+                return QStringList();
+            }
+        }
+    }
+
+    if (list.isEmpty())
+    {
+        ok = false;
+    }
+    return list;
+}
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VCommandLine::VCommandLine() : parser(), optionsUsed(), optionsIndex(), isGuiEnabled(false)
 {
@@ -121,7 +201,8 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
     options.append(new QCommandLineOption(QStringList() << SINGLE_OPTION_GRADATIONSIZE << LONG_OPTION_GRADATIONSIZE,
                                           translate("VCommandLine", "Set size value a pattern file, that was opened "
                                                                     "with multisize measurements (export mode). Valid "
-                                                                    "values: %1cm.")
+                                                                    "values: %1cm. A comma separated list or a range "
+                                                                    "like 46-56 exports every size in one run.")
                                                                 .arg(MeasurementVariable::WholeListSizes(Unit::Cm).join(", ")),
                                           translate("VCommandLine", "The size value")));
 
@@ -129,7 +210,8 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
     options.append(new QCommandLineOption(QStringList() << SINGLE_OPTION_GRADATIONHEIGHT << LONG_OPTION_GRADATIONHEIGHT,
                                           translate("VCommandLine", "Set height value a pattern file, that was opened "
                                                                     "with multisize measurements (export mode). Valid "
-                                                                    "values: %1cm.")
+                                                                    "values: %1cm. A comma separated list or a range "
+                                                                    "like 164-188 exports every height in one run.")
                                                               .arg(MeasurementVariable::WholeListHeights(Unit::Cm).join(", ")),
                                           translate("VCommandLine", "The height value")));
 
@@ -268,6 +350,32 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
                                                     "showing the main window. The key have priority before key '%1'.")
                                                     .arg(LONG_OPTION_BASENAME)));
 
+    optionsIndex.insert(LONG_OPTION_TRACE, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_TRACE,
+                                          translate("VCommandLine", "Record time spent in parsing, calculations, "
+                                                    "layout and export, and save it to the file in Chrome trace-event "
+                                                    "format when the program quits."),
+                                          translate("VCommandLine", "The trace file")));
+
+    optionsIndex.insert(LONG_OPTION_TEST_VARIABLE, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_TEST_VARIABLE,
+                                          translate("VCommandLine", "Change the formula of the custom variable after "
+                                                    "loading and recalculate the pattern, then recalculate it again "
+                                                    "with the full lite parse (test mode). Use with '%1' to compare "
+                                                    "times of both parses.").arg(LONG_OPTION_TRACE),
+                                          translate("VCommandLine", "The variable name")));
+
+    optionsIndex.insert(LONG_OPTION_TEST_DATA, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_TEST_DATA,
+                                          translate("VCommandLine", "Save calculated points, curves and pieces to "
+                                                    "the file in JSON format after loading (test mode)."),
+                                          translate("VCommandLine", "The data file")));
+
+    optionsIndex.insert(LONG_OPTION_TEST_HEADLESS, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_TEST_HEADLESS,
+                                          translate("VCommandLine", "Calculate the pattern without creating tools, "
+                                                    "the same way export does (test mode).")));
+
     optionsIndex.insert(LONG_OPTION_NO_HDPI_SCALING, index++);
     options.append(new QCommandLineOption(QStringList() << LONG_OPTION_NO_HDPI_SCALING,
                                           translate("VCommandLine", "Disable high dpi scaling. Call this option if has "
@@ -532,6 +640,42 @@ bool VCommandLine::IsNoScalingEnabled() const
     return parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_NO_HDPI_SCALING)));
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+QString VCommandLine::OptTraceFile() const
+{
+    return parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_TRACE)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VCommandLine::OptTestVariable() const
+{
+    QString name;
+    if (IsTestModeEnabled())
+    {
+        name = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_TEST_VARIABLE)));
+    }
+
+    return name;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VCommandLine::OptTestDataFile() const
+{
+    QString fileName;
+    if (IsTestModeEnabled())
+    {
+        fileName = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_TEST_DATA)));
+    }
+
+    return fileName;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VCommandLine::IsTestHeadlessEnabled() const
+{
+    return IsTestModeEnabled() && parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_TEST_HEADLESS)));
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommandLine::IsExportEnabled() const
 {
@@ -677,33 +821,33 @@ bool VCommandLine::IsSetGradationHeight() const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QString VCommandLine::OptGradationSize() const
+QStringList VCommandLine::OptGradationSizes() const
 {
-    const QString size = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONSIZE)));
-    if (MeasurementVariable::IsGradationSizeValid(size))
-    {
-        return size;
-    }
-    else
+    bool ok = false;
+    const QStringList sizes =
+            ExpandGradationValues(parser.values(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONSIZE))),
+                                  MeasurementVariable::WholeListSizes(Unit::Cm), ok);
+    if (not ok)
     {
         qCritical() << translate("VCommandLine", "Invalid gradation size value.") << "\n";
         const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
     }
+    return sizes;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QString VCommandLine::OptGradationHeight() const
+QStringList VCommandLine::OptGradationHeights() const
 {
-    const QString height = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONHEIGHT)));
-    if (MeasurementVariable::IsGradationHeightValid(height))
-    {
-        return height;
-    }
-    else
+    bool ok = false;
+    const QStringList heights =
+            ExpandGradationValues(parser.values(*optionsUsed.value(optionsIndex.value(LONG_OPTION_GRADATIONHEIGHT))),
+                                  MeasurementVariable::WholeListHeights(Unit::Cm), ok);
+    if (not ok)
     {
         qCritical() << translate("VCommandLine", "Invalid gradation height value.") << "\n";
         const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
     }
+    return heights;
 }
 
 #undef translate
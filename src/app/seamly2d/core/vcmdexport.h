@@ -59,6 +59,18 @@ class VCommandLine
 
     bool IsNoScalingEnabled() const;
 
+    //@brief returns path to the trace file or empty string if tracing was not requested
+    QString OptTraceFile() const;
+
+    //@brief returns name of the custom variable to edit in test mode or empty string if not set
+    QString OptTestVariable() const;
+
+    //@brief returns path to the file for calculated data in test mode or empty string if not set
+    QString OptTestDataFile() const;
+
+    //@brief tests if the pattern must be calculated without tools in test mode
+    bool IsTestHeadlessEnabled() const;
+
     //@brief tests if user enabled export from cmd, throws exception if not exactly 1 input VAL file supplied in case
     //export enabled
     bool IsExportEnabled() const;
@@ -92,8 +104,10 @@ class VCommandLine
     bool IsSetGradationSize() const;
     bool IsSetGradationHeight() const;
 
-    QString OptGradationSize() const;
-    QString OptGradationHeight() const;
+    //@brief returns the sizes to export, a list or range expands to several values
+    QStringList OptGradationSizes() const;
+    //@brief returns the heights to export, a list or range expands to several values
+    QStringList OptGradationHeights() const;
 
 protected:
 
@@ -782,7 +782,7 @@ QMap<QString, quint32> VToolOptionsPropertyBrowser::getObjectList(Tool *tool, GO
                             VToolRecord newRecord = VToolRecord(id, record.getTypeTool(),
                                                         qApp->getCurrentDocument()->getActiveDraftBlockName());
 
-                        const QHash<quint32, QSharedPointer<VGObject> > *objs = m_data->DataGObjects();
+                        const VPersistentHash<quint32, QSharedPointer<VGObject> > *objs = m_data->DataGObjects();
                         if (objs->contains(id)) //Avoid badId Get GObject only if not a line tool which is not an object
                         {
                             QSharedPointer<VGObject> obj = m_data->GetGObject(id);
@@ -804,7 +804,7 @@ QMap<QString, quint32> VToolOptionsPropertyBrowser::getObjectList(Tool *tool, GO
                             VToolRecord newRecord = VToolRecord(id, record.getTypeTool(),
                                                         qApp->getCurrentDocument()->getActiveDraftBlockName());
 
-                        const QHash<quint32, QSharedPointer<VGObject> > *objs = m_data->DataGObjects();
+                        const VPersistentHash<quint32, QSharedPointer<VGObject> > *objs = m_data->DataGObjects();
                         if (objs->contains(id)) //Avoid badId Get GObject only if not a line tool which is not an object
                         {
                             QSharedPointer<VGObject> obj = m_data->GetGObject(id);
@@ -815,7 +815,7 @@ QMap<QString, quint32> VToolOptionsPropertyBrowser::getObjectList(Tool *tool, GO
                 }
                 default:
                 {
-                    const QHash<quint32, QSharedPointer<VGObject> > *objs = m_data->DataGObjects();
+                    const VPersistentHash<quint32, QSharedPointer<VGObject> > *objs = m_data->DataGObjects();
                     if (objs->contains(recId)) //Avoid badId Get GObject only if not a line tool which is not an object
                     {
                         QSharedPointer<VGObject> obj = m_data->GetGObject(recId);
@@ -86,6 +86,8 @@ DialogVariables::DialogVariables(VContainer *data, VPattern *doc, QWidget *paren
     , doc(doc)
     , formulaBaseHeight(0)
     , hasChanges(false)
+    , variablesChanged(false)
+    , changedFormulas()
     , renameList()
     , tableList()
     , isSorted(false)
@@ -607,6 +609,17 @@ void DialogVariables::refreshPattern()
         }
         renameList.clear();
 
+        if (not variablesChanged)
+        {
+            // Only formulas were edited, objects that don't use the variables keep their data.
+            for (int i = 0; i < changedFormulas.size(); ++i)
+            {
+                doc->MarkVariableChanged(changedFormulas.at(i));
+            }
+        }
+        variablesChanged = false;
+        changedFormulas.clear();
+
         const int row = ui->variables_TableWidget->currentRow();
 
         doc->LiteParseTree(Document::LiteParse);
@@ -643,6 +656,7 @@ void DialogVariables::addCustomVariable()
     }
 
     hasChanges = true;
+    variablesChanged = true;
     localUpdateTree();
 
     ui->variables_TableWidget->selectRow(currentRow);
@@ -665,6 +679,7 @@ void DialogVariables::removeCustomVariable()
     doc->removeCustomVariable(name->text());
 
     hasChanges = true;
+    variablesChanged = true;
     localUpdateTree();
 
     if (ui->variables_TableWidget->rowCount() > 0)
@@ -691,6 +706,7 @@ void DialogVariables::moveUp()
     doc->MoveUpIncrement(name->text());
 
     hasChanges = true;
+    variablesChanged = true;
     localUpdateTree();
 
     ui->variables_TableWidget->selectRow(row-1);
@@ -710,6 +726,7 @@ void DialogVariables::moveDown()
     doc->MoveDownIncrement(name->text());
 
     hasChanges = true;
+    variablesChanged = true;
     localUpdateTree();
 
     ui->variables_TableWidget->selectRow(row+1);
@@ -747,6 +764,7 @@ void DialogVariables::saveCustomVariableName(const QString &text)
     renameCache(name->text(), newName);
 
     hasChanges = true;
+    variablesChanged = true;
     localUpdateTree();
 
     ui->variables_TableWidget->blockSignals(true);
@@ -820,6 +838,7 @@ void DialogVariables::saveCustomVariableFormula()
     {
         const QString formula = qApp->TrVars()->FormulaFromUser(text, qApp->Settings()->GetOsSeparator());
         doc->SetIncrementFormula(name->text(), formula);
+        changedFormulas.append(name->text());
     }
     catch (qmu::QmuParserError &error) // Just in case something bad will happen
     {
@@ -862,6 +881,7 @@ void DialogVariables::Fx()
         // Because of the bug need to take QTableWidgetItem twice time. Previous update "killed" the pointer.
         const QTableWidgetItem *name = ui->variables_TableWidget->item(row, 0);
         doc->SetIncrementFormula(name->text(), dialog->GetFormula());
+        changedFormulas.append(name->text());
 
         hasChanges = true;
         localUpdateTree();
@@ -116,6 +116,12 @@ private slots:
 
     bool                             hasChanges;
 
+    /** @brief variablesChanged custom variables were added, removed, moved or renamed. */
+    bool                             variablesChanged;
+
+    /** @brief changedFormulas custom variables whose formulas were edited. */
+    QStringList                      changedFormulas;
+
     QVector<QPair<QString, QString>> renameList;
 
     QList<QSharedPointer<QTableWidget>> tableList;
@@ -73,6 +73,7 @@
 #include "options.h"
 #include "../ifc/xml/vpatternconverter.h"
 #include "../vmisc/logging.h"
+#include "../vmisc/vtrace.h"
 #include "../vformat/measurements.h"
 #include "../ifc/xml/multi_size_converter.h"
 #include "../ifc/xml/individual_size_converter.h"
@@ -90,6 +91,9 @@
 #include "../vtools/undocommands/addgroup.h"
 #include "../vtools/undocommands/label/showpointname.h"
 #include "../vpatterndb/vpiecepath.h"
+#include "../vpatterndb/variables/vincrement.h"
+#include "../vgeometry/vpointf.h"
+#include "../vlayout/vlayoutpiece.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "../vtools/dialogs/support/editlabeltemplate_dialog.h"
 
@@ -116,6 +120,10 @@
 #include <QTextCodec>
 #include <QDoubleSpinBox>
 #include <QSharedPointer>
+#include <QSignalBlocker>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 
 #if defined(Q_OS_MAC)
 #include <QMimeData>
@@ -136,6 +144,28 @@ const QString autosavePrefix = QStringLiteral(".autosave");
 const QString strQShortcut   = QStringLiteral("QShortcut"); // Context
 const QString strCtrl        = QStringLiteral("Ctrl"); // String
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief gradationSuffix returns the filename suffix of a size and height exported in batch mode, like "_s46_h170".
+ */
+QString gradationSuffix(const QString &size, const QString &height)
+{
+    QString suffix;
+    if (not size.isEmpty())
+    {
+        suffix += QLatin1String("_s") + size;
+    }
+
+    if (not height.isEmpty())
+    {
+        suffix += QLatin1String("_h") + height;
+    }
+    return suffix;
+}
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief MainWindow constructor.
@@ -1821,13 +1851,23 @@ void MainWindow::CleanLayout()
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindow::PrepareSceneList()
 {
-    for (int i=1; i<=scenes.size(); ++i)
+    for (int i=0; i<scenes.size(); ++i)
     {
-        QListWidgetItem *item = new QListWidgetItem(ScenePreview(i-1), QString::number(i));
-        ui->listWidget->addItem(item);
+        AppendSceneList(i);
     }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AppendSceneList add a preview of the scene with index i to the end of the sheet list. The first sheet becomes
+ * current.
+ */
+void MainWindow::AppendSceneList(int i)
+{
+    QListWidgetItem *item = new QListWidgetItem(ScenePreview(i), QString::number(i+1));
+    ui->listWidget->addItem(item);
 
-    if (!scenes.isEmpty())
+    if (ui->listWidget->count() == 1)
     {
         ui->listWidget->setCurrentRow(0);
         SetLayoutModeActions();
@@ -2586,7 +2626,7 @@ void MainWindow::zoomToPrevious()
     /*Set transform for current scene*/
     scene->swapTransforms();
     ui->view->setTransform(scene->transform());
-    zoomScaleChanged(ui->view->transform().m11());
+    emit ui->view->signalZoomScaleChanged(ui->view->transform().m11());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2633,8 +2673,8 @@ void MainWindow::showZoomToPointDialog()
  */
 void MainWindow::zoomToPoint(const QString &pointName)
 {
-    const QHash<quint32, QSharedPointer<VGObject> > *objects = pattern->DataGObjects();
-    QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
+    const VPersistentHash<quint32, QSharedPointer<VGObject> > *objects = pattern->DataGObjects();
+    VPersistentHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
 
     for (i = objects->constBegin(); i != objects->constEnd(); ++i)
     {
@@ -3504,7 +3544,7 @@ void MainWindow::RestoreCurrentScene()
 
     /*Set transform for current scene*/
     ui->view->setTransform(scene->transform());
-    zoomScaleChanged(ui->view->transform().m11());
+    emit ui->view->signalZoomScaleChanged(ui->view->transform().m11());
     /*Set value for current scene scroll bar.*/
     QScrollBar *horScrollBar = ui->view->horizontalScrollBar();
     horScrollBar->setValue(scene->getHorScrollBar());
@@ -4135,7 +4175,15 @@ void MainWindow::fullParseFile()
     try
     {
         setGuiEnabled(true);
-        doc->Parse(Document::FullParse);
+        if (VApplication::IsGUIMode() || not (qApp->CommandLine()->IsExportEnabled() ||
+                                              qApp->CommandLine()->IsTestHeadlessEnabled()))
+        {
+            doc->Parse(Document::FullParse);
+        }
+        else
+        {
+            doc->Evaluate(); // Console export needs only data, tools are not used.
+        }
     }
 
     catch (const VExceptionUndo &exception)
@@ -6173,10 +6221,26 @@ bool MainWindow::LoadPattern(const QString &fileName, const QString& customMeasu
     qApp->setOpeningPattern();//Begin opening file
     try
     {
-        VPatternConverter converter(fileName);
-        m_curFileFormatVersion = converter.GetCurrentFormatVarsion();
-        m_curFileFormatVersionStr = converter.GetVersionStr();
-        doc->setXMLContent(converter.Convert());
+        // Console export only evaluates the pattern. A file in current format doesn't need conversion and can be read
+        // without keeping calculation sections in memory. It is still validated like VPatternConverter does, the
+        // validation stamp makes this cheap for files that did not change.
+        const bool evaluateOnly = not VApplication::IsGUIMode() && qApp->CommandLine()->IsExportEnabled();
+        const QString versionStr = evaluateOnly ? VAbstractConverter::ReadVersionStr(fileName) : QString();
+        if (evaluateOnly && VAbstractConverter::GetVersion(versionStr) == VPatternConverter::PatternMaxVer)
+        {
+            m_curFileFormatVersion = VPatternConverter::PatternMaxVer;
+            m_curFileFormatVersionStr = versionStr;
+            VDomDocument::ValidateXML(VPatternConverter::CurrentSchema, fileName);
+            doc->setXMLContentForEvaluation(fileName);
+        }
+        else
+        {
+            VPatternConverter converter(fileName);
+            m_curFileFormatVersion = converter.GetCurrentFormatVarsion();
+            m_curFileFormatVersionStr = converter.GetVersionStr();
+            doc->setXMLContent(converter.Convert());
+        }
+
         if (!customMeasureFile.isEmpty())
         {
             doc->SetMPath(RelativeMPath(fileName, customMeasureFile));
@@ -6641,7 +6705,7 @@ void MainWindow::exportDraftBlocksAs()
     // Restore scale, scrollbars, current active draft block
     ui->view->setTransform(viewTransform);
     VMainGraphicsView::NewSceneRect(ui->view->scene(), ui->view);
-    zoomScaleChanged(ui->view->transform().m11());
+    emit ui->view->signalZoomScaleChanged(ui->view->transform().m11());
 
     ui->view->verticalScrollBar()->setValue(vScrollBar);
     ui->view->horizontalScrollBar()->setValue(hScrollBar);
@@ -6951,7 +7015,13 @@ void MainWindow::zoomFirstShow()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void MainWindow::DoExport(const VCommandLinePtr &expParams)
+/**
+ * @brief DoExport exports the current pattern pieces in console mode.
+ * @param expParams command line options.
+ * @param baseName base filename of exported files.
+ * @return false if export failed.
+ */
+bool MainWindow::DoExport(const VCommandLinePtr &expParams, const QString &baseName)
 {
     const QHash<quint32, VPiece> *pieces = pattern->DataPieces();
     if(!qApp->getOpeningPattern())
@@ -6959,8 +7029,7 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
         if (pieces->count() == 0)
         {
             qCCritical(vMainWindow, "%s", qUtf8Printable(tr("You can't export empty scene.")));
-            qApp->exit(V_EX_DATAERR);
-            return;
+            return false;
         }
     }
     pieceList = preparePiecesForLayout(*pieces);
@@ -6970,7 +7039,7 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
     {
         try
         {
-            ExportLayoutDialog dialog(1, Draw::Modeling, expParams->OptBaseName(), this);
+            ExportLayoutDialog dialog(1, Draw::Modeling, baseName, this);
             dialog.setDestinationPath(expParams->OptDestinationPath());
             dialog.selectFormat(static_cast<LayoutExportFormat>(expParams->OptExportType()));
             dialog.setBinaryDXFFormat(expParams->IsBinaryDXF());
@@ -6982,8 +7051,7 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
         catch (const VException &exception)
         {
             qCCritical(vMainWindow, "%s\n\n%s", qUtf8Printable(tr("Export exception.")), qUtf8Printable(exception.ErrorMessage()));
-            qApp->exit(V_EX_DATAERR);
-            return;
+            return false;
         }
     }
     else
@@ -6995,7 +7063,7 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
         {
             try
             {
-                ExportLayoutDialog dialog(scenes.size(), Draw::Layout, expParams->OptBaseName(), this);
+                ExportLayoutDialog dialog(scenes.size(), Draw::Layout, baseName, this);
                 dialog.setDestinationPath(expParams->OptDestinationPath());
                 dialog.selectFormat(static_cast<LayoutExportFormat>(expParams->OptExportType()));
                 dialog.setBinaryDXFFormat(expParams->IsBinaryDXF());
@@ -7006,17 +7074,16 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
             catch (const VException &exception)
             {
                 qCCritical(vMainWindow, "%s\n\n%s", qUtf8Printable(tr("Export exception.")), qUtf8Printable(exception.ErrorMessage()));
-                qApp->exit(V_EX_DATAERR);
-                return;
+                return false;
             }
         }
         else
         {
-            return;
+            return false;
         }
     }
 
-    qApp->exit(V_EX_OK);
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -7105,6 +7172,148 @@ bool MainWindow::setHeight(const QString &text)
     return true;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief setGradation sets size and height of a multisize pattern in console mode and recalculates it.
+ *
+ * Measurements follow the current size and height, so the measurement file is not read again. An empty value keeps the
+ * current one.
+ * @param size size value in cm.
+ * @param height height value in cm.
+ * @return false if a value is not supported by the pattern.
+ */
+bool MainWindow::setGradation(const QString &size, const QString &height)
+{
+    if (size.isEmpty() && height.isEmpty())
+    {
+        return true;
+    }
+
+    const QSignalBlocker sizesBlocker(gradationSizes);
+    const QSignalBlocker heightsBlocker(gradationHeights);
+
+    if (not size.isEmpty() && not setSize(size))
+    {
+        return false;
+    }
+
+    if (not height.isEmpty() && not setHeight(height))
+    {
+        return false;
+    }
+
+    VContainer::setSize(gradationSizes->currentText().toInt());
+    VContainer::setHeight(gradationHeights->currentText().toInt());
+    doc->SetPatternWasChanged(true);
+    emit doc->UpdatePatternLabel();
+
+    doc->LiteParseTree(Document::LiteParse);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief testVariableEdit changes the formula of a custom variable in test mode, the same way the variables dialog
+ * does, and recalculates the pattern. Then recalculates it again without marking the change.
+ *
+ * The variable is changed twice, the first edit also collects dependencies of the pattern. The last two LiteParseTree
+ * spans of the trace are the second edit, that recalculates only objects using the variable, and the whole pattern.
+ * @param name custom variable name.
+ * @return false if the pattern has no such variable.
+ */
+bool MainWindow::testVariableEdit(const QString &name)
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        const QSharedPointer<VIncrement> variable = pattern->variablesData().value(name);
+        if (variable.isNull())
+        {
+            qCritical() << tr("The pattern doesn't have custom variable %1.").arg(name);
+            return false;
+        }
+
+        doc->SetIncrementFormula(name, QStringLiteral("(%1)+1").arg(variable->GetFormula()));
+        doc->LiteParseIncrements();
+        doc->MarkVariableChanged(name);
+        doc->LiteParseTree(Document::LiteParse);
+    }
+
+    doc->LiteParseTree(Document::LiteParse);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief writeTestData save calculated points, curves and pieces in JSON format in test mode.
+ *
+ * Used to check that a pattern calculated without tools gives the same data as a pattern calculated with them.
+ * Pieces are saved as their layout contours, that is what export uses.
+ * @param fileName path to the data file.
+ * @return false if the file could not be written.
+ */
+bool MainWindow::writeTestData(const QString &fileName) const
+{
+    QJsonObject objects;
+    const VPersistentHash<quint32, QSharedPointer<VGObject> > *gObjects = pattern->DataGObjects();
+    for (auto i = gObjects->constBegin(); i != gObjects->constEnd(); ++i)
+    {
+        const QSharedPointer<VGObject> gObject = i.value();
+        QJsonObject object;
+        object.insert(QStringLiteral("name"), gObject->name());
+        object.insert(QStringLiteral("type"), static_cast<int>(gObject->getType()));
+
+        if (gObject->getType() == GOType::Point)
+        {
+            const QSharedPointer<VPointF> point = qSharedPointerDynamicCast<VPointF>(gObject);
+            object.insert(QStringLiteral("points"), pointsToJson(QVector<QPointF>() << point->toQPointF()));
+        }
+        else if (const QSharedPointer<VAbstractCurve> curve = qSharedPointerDynamicCast<VAbstractCurve>(gObject))
+        {
+            object.insert(QStringLiteral("length"), curve->GetLength());
+            object.insert(QStringLiteral("points"), pointsToJson(curve->getPoints()));
+        }
+        objects.insert(QString::number(i.key()), object);
+    }
+
+    QJsonObject pieces;
+    const QHash<quint32, VPiece> *dataPieces = pattern->DataPieces();
+    for (auto i = dataPieces->constBegin(); i != dataPieces->constEnd(); ++i)
+    {
+        const VContainer pieceData = doc->getPieceData(i.key());
+        const VLayoutPiece layoutPiece = VLayoutPiece::Create(i.value(), &pieceData);
+
+        QJsonObject piece;
+        piece.insert(QStringLiteral("name"), layoutPiece.GetName());
+        piece.insert(QStringLiteral("contour"), pointsToJson(layoutPiece.getContourPoints()));
+        piece.insert(QStringLiteral("seamAllowance"), pointsToJson(layoutPiece.GetSeamAllowancePoints()));
+        pieces.insert(QString::number(i.key()), piece);
+    }
+
+    QJsonObject root;
+    root.insert(QStringLiteral("objects"), objects);
+    root.insert(QStringLiteral("pieces"), pieces);
+
+    QFile file(fileName);
+    if (not file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qCritical() << tr("Can't write data file %1.").arg(fileName);
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    return file.error() == QFile::NoError;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QJsonArray MainWindow::pointsToJson(const QVector<QPointF> &points)
+{
+    QJsonArray array;
+    for (int i = 0; i < points.size(); ++i)
+    {
+        array.append(QJsonArray() << points.at(i).x() << points.at(i).y());
+    }
+    return array;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindow::ProcessCMD()
 {
@@ -7113,6 +7322,15 @@ void MainWindow::ProcessCMD()
 
     isNoScaling = cmd->IsNoScalingEnabled();
 
+    const QString traceFile = cmd->OptTraceFile();
+    if (not traceFile.isEmpty())
+    {
+        VTrace::Enable(traceFile);
+    }
+
+    // Test mode checks every conversion step of old files, not only the result.
+    VAbstractConverter::SetValidateEachStep(cmd->IsTestModeEnabled());
+
     if (VApplication::IsGUIMode())
     {
         ReopenFilesAfterCrash(args);
@@ -7136,36 +7354,59 @@ void MainWindow::ProcessCMD()
             return; // process only one input file
         }
 
-        bool hSetted = true;
-        bool sSetted = true;
         if (loaded && (cmd->IsTestModeEnabled() || cmd->IsExportEnabled()))
         {
-            if (cmd->IsSetGradationSize())
+            // A list of sizes or heights exports every combination from the pattern loaded once.
+            const QStringList sizes = cmd->IsSetGradationSize() ? cmd->OptGradationSizes() : QStringList(QString());
+            const QStringList heights = cmd->IsSetGradationHeight() ? cmd->OptGradationHeights()
+                                                                    : QStringList(QString());
+            const bool isBatch = sizes.size() * heights.size() > 1;
+
+            for (const QString &size : sizes)
+            {
+                for (const QString &height : heights)
+                {
+                    if (not setGradation(size, height))
+                    {
+                        qApp->exit(V_EX_DATAERR);
+                        return;
+                    }
+
+                    if (not cmd->IsTestModeEnabled())
+                    {
+                        QString baseName = cmd->OptBaseName();
+                        if (isBatch)
+                        {
+                            baseName += gradationSuffix(size, height);
+                        }
+
+                        if (not DoExport(cmd, baseName))
+                        {
+                            qApp->exit(V_EX_DATAERR);
+                            return;
+                        }
+                    }
+                }
+            }
+
+            const QString testVariable = cmd->OptTestVariable();
+            if (not testVariable.isEmpty() && not testVariableEdit(testVariable))
             {
-                sSetted = setSize(cmd->OptGradationSize());
+                qApp->exit(V_EX_DATAERR);
+                return;
             }
 
-            if (cmd->IsSetGradationHeight())
+            const QString testData = cmd->OptTestDataFile();
+            if (not testData.isEmpty() && not writeTestData(testData))
             {
-                hSetted = setHeight(cmd->OptGradationHeight());
+                qApp->exit(V_EX_DATAERR);
+                return;
             }
-        }
 
-        if (!cmd->IsTestModeEnabled())
-        {
-            if (cmd->IsExportEnabled())
+            if (not cmd->IsTestModeEnabled())
             {
-                if (loaded && hSetted && sSetted)
-                {
-                    DoExport(cmd);
-                    return; // process only one input file
-                }
-                else
-                {
-                    qApp->exit(V_EX_DATAERR);
-                    return;
-                }
-                break;
+                qApp->exit(V_EX_OK);
+                return; // process only one input file
             }
         }
     }
@@ -7265,11 +7506,13 @@ void MainWindow::upDateScenes()
 {
     if (draftScene)
     {
+        draftScene->updateItemsSettings();
         draftScene->update();
     }
 
     if (pieceScene)
     {
+        pieceScene->updateItemsSettings();
         pieceScene->update();
     }
 }
@@ -7370,7 +7613,7 @@ bool MainWindow::IgnoreLocking(int error, const QString &path)
 QStringList MainWindow::draftPointNamesList()
 {
     QStringList pointNames;
-    for (QHash<quint32, QSharedPointer<VGObject>>::const_iterator item = pattern->DataGObjects()->begin();
+    for (VPersistentHash<quint32, QSharedPointer<VGObject>>::const_iterator item = pattern->DataGObjects()->begin();
          item != pattern->DataGObjects()->end();
          ++item)
     {
@@ -89,6 +89,7 @@ class QDoubleSpinBox;
 class QFontComboBox;
 class MouseCoordinates;
 class PenToolBar;
+class QJsonArray;
 
 /**
  * @brief The MainWindow class main windows.
@@ -157,6 +158,7 @@ public slots:
     virtual void customEvent(QEvent * event) Q_DECL_OVERRIDE;
     virtual void CleanLayout() Q_DECL_OVERRIDE;
     virtual void PrepareSceneList() Q_DECL_OVERRIDE;
+    virtual void AppendSceneList(int i) Q_DECL_OVERRIDE;
     virtual void exportToCSVData(const QString &fileName, const DialogExportToCSV &dialog) Q_DECL_FINAL;
     void         handleExportToCSV();
 
@@ -441,10 +443,14 @@ private slots:
     void               checkRequiredMeasurements(const MeasurementDoc *m);
 
     void               ReopenFilesAfterCrash(QStringList &args);
-    void               DoExport(const VCommandLinePtr& expParams);
+    bool               DoExport(const VCommandLinePtr& expParams, const QString &baseName);
 
     bool               setSize(const QString &text);
     bool               setHeight(const QString & text);
+    bool               setGradation(const QString &size, const QString &height);
+    bool               testVariableEdit(const QString &name);
+    bool               writeTestData(const QString &fileName) const;
+    static QJsonArray  pointsToJson(const QVector<QPointF> &points);
 
     QString            GetPatternFileName();
     QString            GetMeasurementFileName();
@@ -67,9 +67,12 @@
 #include "../vpatterndb/measurements_def.h"
 #include "../vtools/tools/vabstracttool.h"
 #include "../vtools/tools/pattern_piece_tool.h"
+#include "../vmisc/vtrace.h"
 
+#include <QEventLoop>
 #include <QFileDialog>
 #include <QFileInfo>
+#include <QFont>
 #include <QGraphicsScene>
 #include <QMessageBox>
 #include <QProcess>
@@ -179,7 +182,9 @@ void MainWindowsNoGUI::toolLayoutSettings(QToolButton *tButton, bool checked)
 //---------------------------------------------------------------------------------------------------------------------
 bool MainWindowsNoGUI::LayoutSettings(VLayoutGenerator& lGenerator)
 {
+    V_TRACE_SCOPE("layout", "MainWindowsNoGUI::LayoutSettings");
     lGenerator.setPieces(pieceList);
+    lGenerator.SetHeadless(not VApplication::IsGUIMode());
     DialogLayoutProgress progress(pieceList.count(), this);
     if (VApplication::IsGUIMode())
     {
@@ -193,7 +198,41 @@ bool MainWindowsNoGUI::LayoutSettings(VLayoutGenerator& lGenerator)
     {
         connect(&lGenerator, &VLayoutGenerator::Error, this, &MainWindowsNoGUI::ErrorConsoleMode);
     }
-    lGenerator.Generate();
+
+    // Keep the event loop alive while the sheets are arranged in background
+    QEventLoop loop;
+    connect(&lGenerator, &VLayoutGenerator::Finished, &loop, &QEventLoop::quit);
+    connect(&lGenerator, &VLayoutGenerator::Error,    &loop, &QEventLoop::quit);
+
+    if (VApplication::IsGUIMode())
+    {
+        // Preview sheets as soon as they are done. The final result replaces them after Finished.
+        connect(&lGenerator, &VLayoutGenerator::PaperArranged, &loop,
+                [this, &lGenerator](int index, const VLayoutPaper &paper)
+        {
+            if (index == 0)
+            {
+                CleanLayout();
+                pieces.clear();
+            }
+
+            // Only the new sheet gets a scene, previews of earlier sheets stay as they are
+            const QList<QGraphicsItem *> newPapers{paper.GetPaperItem(lGenerator.GetAutoCrop(),
+                                                                      lGenerator.IsTestAsPaths())};
+            const QList<QGraphicsItem *> newShadows = CreateShadows(newPapers);
+            const QList<QList<QGraphicsItem *> > newPieces{paper.getPieceItems(lGenerator.IsTestAsPaths())};
+
+            papers.append(newPapers);
+            shadows.append(newShadows);
+            pieces.append(newPieces);
+            scenes.append(CreateScenes(newPapers, newShadows, newPieces));
+            AppendSceneList(scenes.size() - 1);
+        });
+    }
+
+    lGenerator.GenerateInBackground();
+    loop.exec();
+    lGenerator.Wait();
 
     switch (lGenerator.State())
     {
@@ -254,6 +293,7 @@ void MainWindowsNoGUI::ErrorConsoleMode(const LayoutErrors &state)
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::ExportData(const QVector<VLayoutPiece> &pieceList, const ExportLayoutDialog &dialog)
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::ExportData");
     const LayoutExportFormat format = dialog.format();
 
     if (format == LayoutExportFormat::DXF_AC1006_AAMA ||
@@ -306,6 +346,7 @@ void MainWindowsNoGUI::ExportFlatLayout(const ExportLayoutDialog &dialog, const
                                         const QList<QList<QGraphicsItem *> > &pieces, bool ignoreMargins,
                                         const QMarginsF &margins)
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::ExportFlatLayout");
     const QString path = dialog.path();
     bool usedNotExistedDir = CreateLayoutPath(path);
     if (!usedNotExistedDir)
@@ -338,6 +379,7 @@ void MainWindowsNoGUI::ExportFlatLayout(const ExportLayoutDialog &dialog, const
 void MainWindowsNoGUI::exportPiecesAsFlatLayout(const ExportLayoutDialog &dialog,
                                                  const QVector<VLayoutPiece> &pieceList)
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportPiecesAsFlatLayout");
     if (pieceList.isEmpty())
     {
         return;
@@ -397,6 +439,7 @@ void MainWindowsNoGUI::exportPiecesAsFlatLayout(const ExportLayoutDialog &dialog
 void MainWindowsNoGUI::ExportApparelLayout(const ExportLayoutDialog &dialog, const QVector<VLayoutPiece> &pieces,
                                            const QString &name, const QSize &size) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::ExportApparelLayout");
     const QString path = dialog.path();
     bool usedNotExistedDir = CreateLayoutPath(path);
     if (!usedNotExistedDir)
@@ -460,6 +503,7 @@ void MainWindowsNoGUI::ExportApparelLayout(const ExportLayoutDialog &dialog, con
 void MainWindowsNoGUI::exportPiecesAsApparelLayout(const ExportLayoutDialog &dialog,
                                                     QVector<VLayoutPiece> pieceList)
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportPiecesAsApparelLayout");
     if (pieceList.isEmpty())
     {
         return;
@@ -779,9 +823,8 @@ QVector<VLayoutPiece> MainWindowsNoGUI::preparePiecesForLayout(const QHash<quint
         QHash<quint32, VPiece>::const_iterator i = pieces.constBegin();
         while (i != pieces.constEnd())
         {
-            VAbstractTool *tool = qobject_cast<VAbstractTool*>(VAbstractPattern::getTool(i.key()));
-            SCASSERT(tool != nullptr)
-            pieceList.append(VLayoutPiece::Create(i.value(), tool->getData()));
+            const VContainer pieceData = doc->getPieceData(i.key());
+            pieceList.append(VLayoutPiece::Create(i.value(), &pieceData));
             ++i;
         }
     }
@@ -888,6 +931,7 @@ QList<QGraphicsScene *> MainWindowsNoGUI::CreateScenes(const QList<QGraphicsItem
  */
 void MainWindowsNoGUI::exportSVG(const QString &name, QGraphicsRectItem *paper, QGraphicsScene *scene) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportSVG");
     QSvgGenerator generator;
     generator.setFileName(name);
     generator.setSize(paper->rect().size().toSize());
@@ -912,6 +956,7 @@ void MainWindowsNoGUI::exportSVG(const QString &name, QGraphicsRectItem *paper,
  */
 void MainWindowsNoGUI::exportPNG(const QString &fileName,  QGraphicsScene *scene) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportPNG");
     QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
     image.fill(Qt::transparent);                                              // Start all pixels transparent
     QPainter painter(&image);
@@ -929,6 +974,7 @@ void MainWindowsNoGUI::exportPNG(const QString &fileName,  QGraphicsScene *scene
  */
 void MainWindowsNoGUI::exportTIF(const QString &fileName,  QGraphicsScene *scene) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportTIF");
     QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
     image.fill(Qt::transparent);                                              // Start all pixels transparent
     QPainter painter(&image);
@@ -951,6 +997,7 @@ void MainWindowsNoGUI::exportTIF(const QString &fileName,  QGraphicsScene *scene
  */
 void MainWindowsNoGUI::exportJPG(const QString &fileName,  QGraphicsScene *scene) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportJPG");
     QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
     image.fill(Qt::white);                                              // Start all pixels transparent
     QPainter painter(&image);
@@ -968,6 +1015,7 @@ void MainWindowsNoGUI::exportJPG(const QString &fileName,  QGraphicsScene *scene
  */
 void MainWindowsNoGUI::exportBMP(const QString &fileName,  QGraphicsScene *scene) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportBMP");
     QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
     image.fill(Qt::white);                                              // Start all pixels transparent
     QPainter painter(&image);
@@ -985,6 +1033,7 @@ void MainWindowsNoGUI::exportBMP(const QString &fileName,  QGraphicsScene *scene
  */
 void MainWindowsNoGUI::exportPPM(const QString &fileName,  QGraphicsScene *scene) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportPPM");
     QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
     image.fill(Qt::transparent);                                              // Start all pixels transparent
     QPainter painter(&image);
@@ -1003,6 +1052,7 @@ void MainWindowsNoGUI::exportPPM(const QString &fileName,  QGraphicsScene *scene
 void MainWindowsNoGUI::exportPDF(const QString &name, QGraphicsRectItem *paper, QGraphicsScene *scene,
                                bool ignoreMargins, const QMarginsF &margins) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportPDF");
     QPrinter printer;
     printer.setCreator(QGuiApplication::applicationDisplayName()+QLatin1String(" ")+
                        QCoreApplication::applicationVersion());
@@ -1051,6 +1101,7 @@ void MainWindowsNoGUI::exportPDF(const QString &name, QGraphicsRectItem *paper,
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::PdfTiledFile(const QString &name)
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::PdfTiledFile");
     isTiled = true;
 
     if (isLayoutStale)
@@ -1082,6 +1133,7 @@ void MainWindowsNoGUI::PdfTiledFile(const QString &name)
 void MainWindowsNoGUI::exportEPS(const QString &name, QGraphicsRectItem *paper, QGraphicsScene *scene,
                                bool ignoreMargins, const QMarginsF &margins) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportEPS");
     QTemporaryFile tmp;
     if (tmp.open())
     {
@@ -1099,6 +1151,7 @@ void MainWindowsNoGUI::exportEPS(const QString &name, QGraphicsRectItem *paper,
 void MainWindowsNoGUI::exportPS(const QString &name, QGraphicsRectItem *paper, QGraphicsScene *scene, bool
                               ignoreMargins, const QMarginsF &margins) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::exportPS");
     QTemporaryFile tmp;
     if (tmp.open())
     {
@@ -1116,6 +1169,7 @@ void MainWindowsNoGUI::exportPS(const QString &name, QGraphicsRectItem *paper, Q
  */
 void MainWindowsNoGUI::convertPdfToPs(const QStringList &params) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::convertPdfToPs");
 #ifndef QT_NO_CURSOR
     QGuiApplication::setOverrideCursor(Qt::WaitCursor);
 #endif
@@ -1147,6 +1201,7 @@ void MainWindowsNoGUI::convertPdfToPs(const QStringList &params) const
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::ObjFile(const QString &name, QGraphicsRectItem *paper, QGraphicsScene *scene) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::ObjFile");
     VObjPaintDevice generator;
     generator.setFileName(name);
     generator.setSize(paper->rect().size().toSize());
@@ -1164,7 +1219,8 @@ QT_WARNING_DISABLE_GCC("-Wswitch-default")
 void MainWindowsNoGUI::FlatDxfFile(const QString &name, int version, bool binary, QGraphicsRectItem *paper,
                                QGraphicsScene *scene, const QList<QList<QGraphicsItem *> > &pieces) const
 {
-    PrepareTextForDXF(endStringPlaceholder, pieces);
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::FlatDxfFile");
+    const QList<QFont> fonts = PrepareTextForDXF(endStringPlaceholder, pieces);
     VDxfPaintDevice generator;
     generator.setFileName(name);
     generator.setSize(paper->rect().size().toSize());
@@ -1172,6 +1228,10 @@ void MainWindowsNoGUI::FlatDxfFile(const QString &name, int version, bool binary
     generator.setVersion(static_cast<DRW::Version>(version));
     generator.SetBinaryFormat(binary);
     generator.setInsunits(VarInsunits::Millimeters);// Decided to always use mm. See issue #745
+    for (int i = 0; i < fonts.size(); ++i)
+    {
+        generator.AddFont(fonts.at(i));
+    }
 
     QPainter painter;
     if (painter.begin(&generator))
@@ -1186,6 +1246,7 @@ void MainWindowsNoGUI::FlatDxfFile(const QString &name, int version, bool binary
 void MainWindowsNoGUI::AAMADxfFile(const QString &name, int version, bool binary, const QSize &size,
                                    const QVector<VLayoutPiece> &pieces) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::AAMADxfFile");
     VDxfPaintDevice generator;
     generator.setFileName(name);
     generator.setSize(size);
@@ -1234,10 +1295,12 @@ void MainWindowsNoGUI::RestorePaper(int index) const
  * placeholder. This method append it.
  *
  * @param placeholder placeholder that will be appended to each QGraphicsSimpleTextItem item's text string.
+ * @return fonts of the text items. The dxf text styles are written before the entities.
  */
-void MainWindowsNoGUI::PrepareTextForDXF(const QString &placeholder,
-                                         const QList<QList<QGraphicsItem *> > &pieces) const
+QList<QFont> MainWindowsNoGUI::PrepareTextForDXF(const QString &placeholder,
+                                                 const QList<QList<QGraphicsItem *> > &pieces) const
 {
+    QList<QFont> fonts;
     for (int i = 0; i < pieces.size(); ++i)
     {
         const QList<QGraphicsItem *> &paperItems = pieces.at(i);
@@ -1252,11 +1315,13 @@ void MainWindowsNoGUI::PrepareTextForDXF(const QString &placeholder,
                     if(QGraphicsSimpleTextItem *textItem = qgraphicsitem_cast<QGraphicsSimpleTextItem *>(item))
                     {
                         textItem->setText(textItem->text() + placeholder);
+                        fonts.append(textItem->font());
                     }
                 }
             }
         }
     }
+    return fonts;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1606,6 +1671,7 @@ void MainWindowsNoGUI::ExportScene(const ExportLayoutDialog &dialog, const QList
                                    const QList<QList<QGraphicsItem *> > &pieces, bool ignoreMargins,
                                    const QMarginsF &margins) const
 {
+    V_TRACE_SCOPE("export", "MainWindowsNoGUI::ExportScene");
     for (int i=0; i < scenes.size(); ++i)
     {
         QString increment  = QStringLiteral("");
@@ -1735,7 +1801,7 @@ QString MainWindowsNoGUI::FileName() const
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::setSizeHeightForIndividualM() const
 {
-    const QHash<QString, QSharedPointer<VInternalVariable> > * vars = pattern->DataVariables();
+    const VPersistentHash<QString, QSharedPointer<VInternalVariable> > * vars = pattern->DataVariables();
 
     if (vars->contains(size_M))
     {
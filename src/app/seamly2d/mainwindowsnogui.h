@@ -63,6 +63,7 @@
 #include "../vlayout/vlayoutgenerator.h"
 #include "../vwidgets/vabstractmainwindow.h"
 
+class QFont;
 class QGraphicsScene;
 struct PosterData;
 class QGraphicsRectItem;
@@ -130,6 +131,7 @@ public slots:
     void         InitTempLayoutScene();
     virtual void CleanLayout()=0;
     virtual void PrepareSceneList()=0;
+    virtual void AppendSceneList(int i)=0;
     QIcon        ScenePreview(int i) const;
     bool         LayoutSettings(VLayoutGenerator& lGenerator);
     int          ContinueIfLayoutStale();
@@ -168,7 +170,7 @@ private slots:
     void PreparePaper(int index) const;
     void RestorePaper(int index) const;
 
-    void PrepareTextForDXF(const QString &placeholder, const QList<QList<QGraphicsItem *> > &pieces) const;
+    QList<QFont> PrepareTextForDXF(const QString &placeholder, const QList<QList<QGraphicsItem *> > &pieces) const;
     void RestoreTextAfterDXF(const QString &placeholder, const QList<QList<QGraphicsItem *> > &pieces) const;
 
     void PrintPreview();
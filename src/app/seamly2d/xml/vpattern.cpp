@@ -68,6 +68,7 @@
 #include "../vmisc/vmath.h"
 #include "../vmisc/projectversion.h"
 #include "../vmisc/vabstractapplication.h"
+#include "../vmisc/vtrace.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "../qmuparser/qmutokenparser.h"
 #include "../vgeometry/varc.h"
@@ -84,11 +85,15 @@
 #include "../vpatterndb/vpiecepath.h"
 #include "../vpatterndb/vnodedetail.h"
 
+#include <QDomAttr>
+#include <QDomNamedNodeMap>
 #include <QMessageBox>
 #include <QUndoStack>
 #include <QtNumeric>
 #include <QDebug>
+#include <QFile>
 #include <QFileInfo>
+#include <QXmlStreamReader>
 
 const QString VPattern::AttrReadOnly = QStringLiteral("readOnly");
 
@@ -99,6 +104,119 @@ QString FileComment()
 {
     return QString("Pattern created with Seamly2D v%1 (https://seamly.io).").arg(APP_VERSION_STR);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReferencedObjects collect ids of objects a tag refers to.
+ *
+ * Every whole number in attributes and text of the tag and its children counts as a reference, except attributes
+ * known to keep something else. A wrong reference only makes incremental parse recalculate more objects.
+ */
+QVector<quint32> ReferencedObjects(const QDomElement &element)
+{
+    static const QSet<QString> skip = QSet<QString>()
+            << VDomDocument::AttrId << AttrMx << AttrMy << AttrMx1 << AttrMy1 << AttrMx2 << AttrMy2 << AttrX << AttrY
+            << AttrLength << AttrLength1 << AttrLength2 << AttrAngle << AttrAngle1 << AttrAngle2 << AttrRadius
+            << AttrRadius1 << AttrRadius2 << AttrC1Radius << AttrC2Radius << AttrCRadius << AttrRotationAngle
+            << AttrKAsm1 << AttrKAsm2 << AttrKCurve << AttrDuplicate << AttrClosed << AttrAxisType << AttrLineWeight
+            << VAbstractPattern::AttrWidth << VAbstractPattern::AttrRotation << VAbstractPattern::AttrQuantity
+            << VAbstractPattern::AttrArrows << VAbstractPattern::AttrSABefore << VAbstractPattern::AttrSAAfter
+            << VAbstractPattern::AttrIncludeAs << VAbstractPattern::AttrNodeReverse
+            << VAbstractPattern::AttrNodeNotchLength << VAbstractPattern::AttrNodeNotchWidth
+            << VAbstractPattern::AttrNodeNotchAngle << VAbstractPattern::AttrNodeNotchCount
+            << PatternPieceTool::AttrVersion << PatternPieceTool::AttrHeight << PatternPieceTool::AttrFont;
+
+    QVector<quint32> objects;
+    const QDomNamedNodeMap attributes = element.attributes();
+    for (int i = 0; i < attributes.count(); ++i)
+    {
+        const QDomAttr attribute = attributes.item(i).toAttr();
+        if (not skip.contains(attribute.name()))
+        {
+            bool ok = false;
+            const quint32 id = attribute.value().toUInt(&ok);
+            if (ok && id != NULL_ID)
+            {
+                objects.append(id);
+            }
+        }
+    }
+
+    QDomElement child = element.firstChildElement();
+    if (child.isNull())
+    {
+        bool ok = false;
+        const quint32 id = element.text().toUInt(&ok);
+        if (ok && id != NULL_ID)
+        {
+            objects.append(id);
+        }
+    }
+
+    while (not child.isNull())
+    {
+        objects += ReferencedObjects(child);
+        child = child.nextSiblingElement();
+    }
+    return objects;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VariableObjects return ids of objects an internal variable is calculated from.
+ */
+QVector<quint32> VariableObjects(const QSharedPointer<VInternalVariable> &variable)
+{
+    QVector<quint32> objects;
+
+    const QSharedPointer<VLengthLine> length = variable.dynamicCast<VLengthLine>();
+    if (not length.isNull())
+    {
+        objects << length->GetP1Id() << length->GetP2Id();
+        return objects;
+    }
+
+    const QSharedPointer<VLineAngle> angle = variable.dynamicCast<VLineAngle>();
+    if (not angle.isNull())
+    {
+        objects << angle->GetP1Id() << angle->GetP2Id();
+        return objects;
+    }
+
+    const QSharedPointer<VCurveVariable> curve = variable.dynamicCast<VCurveVariable>();
+    if (not curve.isNull())
+    {
+        objects << curve->GetId() << curve->GetParentId();
+    }
+    return objects;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FormulaOwner return id of draft block element a formula tag belongs to.
+ * @return element id or NULL_ID if the formula isn't a part of a draft block (e.g. increment).
+ */
+quint32 FormulaOwner(const QDomElement &element)
+{
+    QDomElement current = element;
+    while (not current.isNull())
+    {
+        const QDomElement parent = current.parentNode().toElement();
+        if (parent.isNull())
+        {
+            return NULL_ID;
+        }
+
+        const QString tag = parent.tagName();
+        if (tag == VAbstractPattern::TagCalculation || tag == VAbstractPattern::TagModeling
+                || tag == VAbstractPattern::TagPieces)
+        {
+            return VDomDocument::GetParametrUInt(current, VDomDocument::AttrId, NULL_ID_STR);
+        }
+        current = parent;
+    }
+    return NULL_ID;
+}
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -108,7 +226,14 @@ VPattern::VPattern(VContainer *data, Draw *mode, VMainGraphicsScene *draftScene,
       data(data),
       mode(mode),
       draftScene(draftScene),
-      pieceScene(pieceScene)
+      pieceScene(pieceScene),
+      graph(),
+      graphToolCount(0),
+      incrementalObjects(),
+      incrementalStarted(false),
+      headless(false),
+      pieceData(),
+      streamSource()
 {
     SCASSERT(draftScene != nullptr)
     SCASSERT(pieceScene != nullptr)
@@ -120,6 +245,7 @@ VPattern::VPattern(VContainer *data, Draw *mode, VMainGraphicsScene *draftScene,
  */
 void VPattern::CreateEmptyFile()
 {
+    streamSource.clear();
     this->clear();
     QDomElement patternElement = this->createElement(TagPattern);
 
@@ -148,6 +274,7 @@ void VPattern::CreateEmptyFile()
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::setXMLContent(const QString &fileName)
 {
+    streamSource.clear();
     VDomDocument::setXMLContent(fileName);
     GarbageCollector();
 }
@@ -159,6 +286,7 @@ void VPattern::setXMLContent(const QString &fileName)
  */
 void VPattern::Parse(const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::Parse");
     qCDebug(vXML, "Parsing pattern.");
     switch (parse)
     {
@@ -182,6 +310,16 @@ void VPattern::Parse(const Document &parse)
                                      << TagPatternName << TagPatternNum << TagCompanyName << TagCustomerName
                                      << TagPatternLabel;
     PrepareForParse(parse);
+    graph.Clear();
+
+    if (not streamSource.isEmpty())
+    {
+        parseStream(parse);
+        traceToolDataMemory();
+        emit CheckLayout();
+        return;
+    }
+
     QDomNode domNode = documentElement().firstChild();
     while (domNode.isNull() == false)
     {
@@ -260,9 +398,163 @@ void VPattern::Parse(const Document &parse)
         }
         domNode = domNode.nextSibling();
     }
+    traceToolDataMemory();
     emit CheckLayout();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief traceToolDataMemory record memory taken by tables of data copies the tools keep. Tables shared between
+ * copies are counted once.
+ */
+void VPattern::traceToolDataMemory() const
+{
+    if (not VTrace::IsEnabled())
+    {
+        return;
+    }
+
+    QSet<const void *> visited;
+    qint64 bytes = 0;
+    for (auto i = tools.constBegin(); i != tools.constEnd(); ++i)
+    {
+        const VContainer toolData = i.value()->getData();
+        bytes += toolData.DataGObjects()->MemoryUsage(&visited);
+        bytes += toolData.DataVariables()->MemoryUsage(&visited);
+    }
+    VTrace::AddCounter("memory", "Tool data", bytes);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Evaluate calculate pattern objects and pieces without creating tools.
+ *
+ * Used by console export, that needs only the data. Tools' Create functions run their lite parse path, so no
+ * graphics item or tool object is created. Data of each piece is kept instead of a tool's copy, following lite
+ * parses (for example after changing size) keep working in the same way.
+ */
+void VPattern::Evaluate()
+{
+    qCDebug(vXML, "Evaluating pattern without tools.");
+    PrepareForParse(Document::FullParse);
+    headless = true;
+
+    const QDomNodeList blocks = elementsByTagName(TagDraftBlock);
+    for (int i = 0; i < blocks.size(); ++i)
+    {
+        patternPieces << GetParametrString(blocks.at(i).toElement(), AttrName);
+    }
+
+    if (not patternPieces.isEmpty())
+    {
+        setActiveDraftBlock(patternPieces.first());
+    }
+
+    Parse(Document::LiteParse);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief setXMLContentForEvaluation load pattern for Evaluate() without calculation sections.
+ *
+ * Calculation sections hold most of a pattern. Instead of keeping them in the tree each parse reads them from the file
+ * one tag at a time. Modeling, pieces and everything else stay in memory, so the document can be used as usual, but
+ * it can't be saved.
+ * @param fileName pattern file in current format version.
+ */
+void VPattern::setXMLContentForEvaluation(const QString &fileName)
+{
+    setXMLContentSkipping(fileName, QStringList() << TagCalculation);
+    streamSource = fileName;
+    GarbageCollector();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief parseStream parse pattern loaded by setXMLContentForEvaluation().
+ *
+ * Tags of calculation sections are read from the file and dispatched to tools one by one, every tag is freed right
+ * after its objects were calculated. The rest of a draft block is parsed from the tree.
+ * @param parse parser file mode.
+ */
+void VPattern::parseStream(const Document &parse)
+{
+    V_TRACE_SCOPE("parse", "VPattern::parseStream");
+    SCASSERT(parse != Document::FullParse)
+
+    QFile file(streamSource);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        throw VException(tr("Can't open file %1:\n%2.").arg(streamSource).arg(file.errorString()));
+    }
+
+    const QDomNodeList blocks = documentElement().elementsByTagName(TagDraftBlock);
+    int blockIndex = 0;
+
+    QXmlStreamReader reader(&file);
+    if (reader.readNextStartElement())
+    {
+        while (reader.readNextStartElement())
+        {
+            if (reader.name() == TagDraftBlock && blockIndex < blocks.size())
+            {
+                qCDebug(vXML, "Tag draw.");
+                parseStreamedDraftBlock(reader, blocks.at(blockIndex++).toElement(), parse);
+            }
+            else if (reader.name() == TagIncrements)
+            {
+                qCDebug(vXML, "Tag increments.");
+                ParseIncrementsElement(documentElement().firstChildElement(TagIncrements));
+                reader.skipCurrentElement();
+            }
+            else
+            {
+                reader.skipCurrentElement();
+            }
+        }
+    }
+
+    if (reader.hasError())
+    {
+        VException e(reader.errorString());
+        e.AddMoreInformation(tr("Parsing error file %3 in line %1 column %2").arg(reader.lineNumber())
+                             .arg(reader.columnNumber()).arg(streamSource));
+        throw e;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPattern::parseStreamedDraftBlock(QXmlStreamReader &reader, const QDomElement &block, const Document &parse)
+{
+    V_TRACE_SCOPE("parse", "VPattern::parseStreamedDraftBlock");
+    changeActiveDraftBlock(GetParametrString(block, AttrName), Document::LiteParse);
+
+    while (reader.readNextStartElement())
+    {
+        if (reader.name() == TagCalculation)
+        {
+            qCDebug(vXML, "Tag calculation.");
+            if (incrementalObjects.isEmpty())
+            {
+                data->ClearCalculationGObjects();
+            }
+
+            while (reader.readNextStartElement())
+            {
+                QDomElement domElement = ReadElement(reader, *this);
+                parseDrawElement(draftScene, domElement, parse);
+            }
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    // The tree has no calculation section, only modeling, pieces and groups are left.
+    parseDraftBlockElement(block, parse);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief setCurrentData set current data set.
@@ -348,12 +640,38 @@ void VPattern::UpdateToolData(const quint32 &id, VContainer *data)
 {
     Q_ASSERT_X(id != 0, Q_FUNC_INFO, "id == 0"); //-V712 //-V654
     SCASSERT(data != nullptr)
+    if (headless)
+    {
+        if (data->DataPieces()->contains(id))
+        {
+            pieceData.insert(id, *data);
+        }
+        return;
+    }
     ToolExists(id);
     VDataTool *tool = tools.value(id);
     SCASSERT(tool != nullptr)
     tool->VDataTool::setData(data);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getPieceData return data container a piece was calculated with.
+ * @param id piece id.
+ * @return data of piece's tool or, if pattern was evaluated without tools, data saved for the piece.
+ */
+VContainer VPattern::getPieceData(quint32 id) const
+{
+    if (headless)
+    {
+        return pieceData.value(id, *data);
+    }
+
+    const VDataTool *tool = getTool(id);
+    SCASSERT(tool != nullptr)
+    return tool->getData();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief getActiveBasePoint return id base point current draft block.
@@ -409,6 +727,12 @@ QVector<quint32> VPattern::getActivePatternPieces() const
 //---------------------------------------------------------------------------------------------------------------------
 bool VPattern::SaveDocument(const QString &fileName, QString &error)
 {
+    if (not streamSource.isEmpty())
+    {
+        error = tr("Pattern was loaded without calculation sections and can't be saved.");
+        return false;
+    }
+
     try
     {
         TestUniqueId();
@@ -440,6 +764,7 @@ bool VPattern::SaveDocument(const QString &fileName, QString &error)
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::LiteParseIncrements()
 {
+    V_TRACE_SCOPE("parse", "VPattern::LiteParseIncrements");
     try
     {
         emit setGuiEnabled(true);
@@ -514,19 +839,36 @@ void VPattern::LiteParseIncrements()
  */
 void VPattern::LiteParseTree(const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::LiteParseTree");
     // Save current draft block name
     QString draftBlockName = activeDraftBlock;
 
+    const QVector<quint32> changed = changedObjects;
+    changedObjects.clear();
+    const QStringList variables = changedVariables;
+    changedVariables.clear();
+    QSet<quint32> updated;
+
+    updateGraphEdges(changedFormulas);
+    changedFormulas.clear();
+
     try
     {
         emit setGuiEnabled(true);
         switch (parse)
         {
             case Document::LiteBlockParse:
-                parseCurrentDraftBlock();
+                if (not incrementalParse(changed, variables, updated))
+                {
+                    graph.Clear(); // The change may be not marked, collect dependencies again on next edit.
+                    parseCurrentDraftBlock();
+                }
                 break;
             case Document::LiteParse:
-                Parse(parse);
+                if (not incrementalParse(changed, variables, updated))
+                {
+                    Parse(parse);
+                }
                 break;
             case Document::FullParse:
                 qCWarning(vXML, "Lite parsing doesn't support full parsing");
@@ -613,7 +955,9 @@ void VPattern::LiteParseTree(const Document &parse)
     activeDraftBlock = draftBlockName;
     qCDebug(vXML, "Current draft block %s", qUtf8Printable(activeDraftBlock));
     setCurrentData();
+    updatedTools = updated;
     emit FullUpdateFromFile();
+    updatedTools.clear();
     // Recalculate scene rect
     VMainGraphicsView::NewSceneRect(draftScene, qApp->getSceneView());
     VMainGraphicsView::NewSceneRect(pieceScene, qApp->getSceneView());
@@ -683,6 +1027,7 @@ VNodeDetail VPattern::parsePieceNode(const QDomElement &domElement) const
  */
 void VPattern::parseDraftBlockElement(const QDomNode &node, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::parseDraftBlockElement");
     QStringList tags = QStringList() << TagCalculation << TagModeling << TagPieces << TagGroups;
     QDomNode domNode = node.firstChild();
     while (domNode.isNull() == false)
@@ -696,7 +1041,10 @@ void VPattern::parseDraftBlockElement(const QDomNode &node, const Document &pars
                 {
                     case 0: // TagCalculation
                         qCDebug(vXML, "Tag calculation.");
-                        data->ClearCalculationGObjects();
+                        if (incrementalObjects.isEmpty())
+                        {
+                            data->ClearCalculationGObjects();
+                        }
                         ParseDrawMode(domElement, parse, Draw::Calculation);
                         break;
                     case 1: // TagModeling
@@ -730,6 +1078,7 @@ void VPattern::parseDraftBlockElement(const QDomNode &node, const Document &pars
  */
 void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const Draw &mode)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseDrawMode");
     SCASSERT(draftScene != nullptr)
     SCASSERT(pieceScene != nullptr)
     VMainGraphicsScene *scene = nullptr;
@@ -741,14 +1090,6 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
     {
         scene = pieceScene;
     }
-    const QStringList tags = QStringList() << TagPoint
-                                           << TagLine
-                                           << TagSpline
-                                           << TagArc
-                                           << TagTools
-                                           << TagOperation
-                                           << TagElArc
-                                           << TagPath;
     const QDomNodeList nodeList = node.childNodes();
     const qint32 num = nodeList.size();
     for (qint32 i = 0; i < num; ++i)
@@ -756,48 +1097,74 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
         QDomElement domElement = nodeList.at(i).toElement();
         if (domElement.isNull() == false)
         {
-            switch (tags.indexOf(domElement.tagName()))
+            if (isSkippedByIncrementalParse(domElement))
             {
-                case 0: // TagPoint
-                    qCDebug(vXML, "Tag point.");
-                    ParsePointElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 1: // TagLine
-                    qCDebug(vXML, "Tag line.");
-                    ParseLineElement(scene, domElement, parse);
-                    break;
-                case 2: // TagSpline
-                    qCDebug(vXML, "Tag spline.");
-                    ParseSplineElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 3: // TagArc
-                    qCDebug(vXML, "Tag arc.");
-                    ParseArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 4: // TagTools
-                    qCDebug(vXML, "Tag tools.");
-                    ParseToolsElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 5: // TagOperation
-                    qCDebug(vXML, "Tag operation.");
-                    ParseOperationElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 6: // TagElArc
-                    qCDebug(vXML, "Tag elliptical arc.");
-                    ParseEllipticalArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 7: // TagPath
-                    qCDebug(vXML, "Tag path.");
-                    ParsePathElement(scene, domElement, parse);
-                    break;
-                default:
-                    VException e(tr("Wrong tag name '%1'.").arg(domElement.tagName()));
-                    throw e;
+                continue;
             }
+
+            parseDrawElement(scene, domElement, parse);
         }
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief parseDrawElement parse one tag of calculation or modeling section.
+ * @param scene scene.
+ * @param domElement tag in xml tree.
+ * @param parse parser file mode.
+ */
+void VPattern::parseDrawElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
+{
+    V_TRACE_SCOPE("parse", "VPattern::parseDrawElement");
+    const QStringList tags = QStringList() << TagPoint
+                                           << TagLine
+                                           << TagSpline
+                                           << TagArc
+                                           << TagTools
+                                           << TagOperation
+                                           << TagElArc
+                                           << TagPath;
+    switch (tags.indexOf(domElement.tagName()))
+    {
+        case 0: // TagPoint
+            qCDebug(vXML, "Tag point.");
+            ParsePointElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 1: // TagLine
+            qCDebug(vXML, "Tag line.");
+            ParseLineElement(scene, domElement, parse);
+            break;
+        case 2: // TagSpline
+            qCDebug(vXML, "Tag spline.");
+            ParseSplineElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 3: // TagArc
+            qCDebug(vXML, "Tag arc.");
+            ParseArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 4: // TagTools
+            qCDebug(vXML, "Tag tools.");
+            ParseToolsElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 5: // TagOperation
+            qCDebug(vXML, "Tag operation.");
+            ParseOperationElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 6: // TagElArc
+            qCDebug(vXML, "Tag elliptical arc.");
+            ParseEllipticalArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 7: // TagPath
+            qCDebug(vXML, "Tag path.");
+            ParsePathElement(scene, domElement, parse);
+            break;
+        default:
+            VException e(tr("Wrong tag name '%1'.").arg(domElement.tagName()));
+            throw e;
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief parsePieceElement parse piece tag.
@@ -806,6 +1173,7 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
  */
 void VPattern::parsePieceElement(QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::parsePieceElement");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     try
     {
@@ -982,6 +1350,7 @@ void VPattern::ParsePieceGrainline(const QDomElement &domElement, VPiece &piece)
  */
 void VPattern::parsePatternPieces(const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::parsePatternPieces");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     QDomNode domNode = domElement.firstChild();
     while (domNode.isNull() == false)
@@ -991,7 +1360,7 @@ void VPattern::parsePatternPieces(const QDomElement &domElement, const Document
             QDomElement domElement = domNode.toElement();
             if (domElement.isNull() == false)
             {
-                if (domElement.tagName() == TagPiece)
+                if (domElement.tagName() == TagPiece && not isSkippedByIncrementalParse(domElement))
                 {
                     parsePieceElement(domElement, parse);
                 }
@@ -1040,6 +1409,7 @@ void VPattern::PointsCommonAttributes(const QDomElement &domElement, quint32 &id
 void VPattern::ParsePointElement(VMainGraphicsScene *scene, QDomElement &domElement,
                                  const Document &parse, const QString &type)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParsePointElement");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     Q_ASSERT_X(not type.isEmpty(), Q_FUNC_INFO, "type of point is empty");
@@ -1158,6 +1528,7 @@ void VPattern::ParsePointElement(VMainGraphicsScene *scene, QDomElement &domElem
 void VPattern::ParseLineElement(VMainGraphicsScene *scene, const QDomElement &domElement,
                                 const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseLineElement");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     try
@@ -1191,6 +1562,7 @@ void VPattern::SplinesCommonAttributes(const QDomElement &domElement, quint32 &i
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::parseCurrentDraftBlock()
 {
+    V_TRACE_SCOPE("parse", "VPattern::parseCurrentDraftBlock");
     QDomElement domElement;
     if (getActiveDraftElement(domElement))
     {
@@ -1199,6 +1571,324 @@ void VPattern::parseCurrentDraftBlock()
     emit CheckLayout();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief incrementalParse recalculate only changed objects and objects that depend on them.
+ *
+ * Works only if all of them belong to the active draft block. Other objects keep their data, only tools that follow
+ * the first changed object get a fresh copy of the data container.
+ * @param changed ids of objects whose attributes were changed.
+ * @param variables names of custom variables whose formulas were changed. Objects that use them are changed too.
+ * @param updated ids of recalculated objects.
+ * @return false if the pattern needs a usual lite parse.
+ */
+bool VPattern::incrementalParse(const QVector<quint32> &changed, const QStringList &variables,
+                                QSet<quint32> &updated)
+{
+    if ((changed.isEmpty() && variables.isEmpty()) || headless || *mode != Draw::Calculation)
+    {
+        return false;
+    }
+
+    QDomElement domElement;
+    if (not getActiveDraftElement(domElement))
+    {
+        return false;
+    }
+
+    if (graph.IsEmpty() || graphToolCount != tools.size())
+    {
+        buildGraph();
+    }
+
+    if (not graph.IsComplete(activeDraftBlock))
+    {
+        return false;
+    }
+
+    QVector<quint32> marked = changed;
+    if (not variables.isEmpty())
+    {
+        QStringList affected;
+        if (not dependentVariables(variables, affected))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < affected.size(); ++i)
+        {
+            marked += graph.VariableUsers(affected.at(i));
+        }
+
+        if (marked.isEmpty())
+        {
+            return false; // Variables are not used by objects of the pattern
+        }
+    }
+
+    QSet<quint32> objects;
+    for (int i = 0; i < marked.size(); ++i)
+    {
+        const QVector<quint32> dependents = graph.Dependents(marked.at(i));
+        if (dependents.isEmpty())
+        {
+            return false;
+        }
+
+        for (int j = 0; j < dependents.size(); ++j)
+        {
+            if (graph.DraftBlock(dependents.at(j)) != activeDraftBlock)
+            {
+                return false;
+            }
+            objects.insert(dependents.at(j));
+        }
+    }
+
+    qCDebug(vXML, "Incremental parse of %d objects.", objects.size());
+    incrementalObjects = objects;
+    incrementalStarted = false;
+    try
+    {
+        parseDraftBlockElement(domElement, Document::LiteParse);
+    }
+    catch (...)
+    {
+        incrementalObjects.clear();
+        throw;
+    }
+    incrementalObjects.clear();
+    emit CheckLayout();
+
+    updated = objects;
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief isSkippedByIncrementalParse check if incremental parse doesn't need to recalculate the tag.
+ * @param domElement tag in xml tree.
+ * @return true if tag should be skipped.
+ */
+bool VPattern::isSkippedByIncrementalParse(const QDomElement &domElement)
+{
+    if (incrementalObjects.isEmpty())
+    {
+        return false;
+    }
+
+    const quint32 id = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+    if (incrementalObjects.contains(id))
+    {
+        incrementalStarted = true;
+        return false;
+    }
+
+    // The tool keeps a copy of data. Changed objects placed before it must be seen there.
+    if (incrementalStarted && tools.contains(id))
+    {
+        UpdateToolData(id, data);
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief buildGraph collect dependencies between pattern objects from the file and variables of the data container.
+ */
+void VPattern::buildGraph()
+{
+    graph.Clear();
+    graphToolCount = tools.size();
+
+    QVector<QPair<quint32, QVector<quint32>>> references;
+    const QDomNodeList blocks = elementsByTagName(TagDraftBlock);
+    for (int i = 0; i < blocks.size(); ++i)
+    {
+        const QDomElement block = blocks.at(i).toElement();
+        const QString blockName = block.attribute(AttrName);
+
+        QDomElement section = block.firstChildElement();
+        while (not section.isNull())
+        {
+            if (section.tagName() != TagGroups)
+            {
+                QDomElement element = section.firstChildElement();
+                while (not element.isNull())
+                {
+                    if (element.tagName() == TagTools)
+                    {
+                        // Union tool refers to pieces by index
+                        graph.SetIncomplete(blockName);
+                    }
+
+                    const quint32 id = GetParametrUInt(element, AttrId, NULL_ID_STR);
+                    if (id != NULL_ID)
+                    {
+                        graph.AddVertex(id, blockName);
+                        references.append(qMakePair(id, ReferencedObjects(element)));
+                    }
+                    element = element.nextSiblingElement();
+                }
+            }
+            section = section.nextSiblingElement();
+        }
+    }
+
+    for (int i = 0; i < references.size(); ++i)
+    {
+        const QVector<quint32> &objects = references.at(i).second;
+        for (int j = 0; j < objects.size(); ++j)
+        {
+            graph.AddEdge(objects.at(j), references.at(i).first);
+        }
+    }
+
+    const QVector<VFormulaField> expressions = ListExpressions();
+    for (int i = 0; i < expressions.size(); ++i)
+    {
+        const quint32 child = FormulaOwner(expressions.at(i).element);
+        if (child != NULL_ID)
+        {
+            addFormulaEdges(expressions.at(i).expression, child);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateGraphEdges collect dependencies of edited elements again.
+ *
+ * A formula edit can make an element use variables of objects it didn't use before. Without new edges a later change
+ * of such object would skip the element.
+ * @param ids ids of edited elements.
+ */
+void VPattern::updateGraphEdges(const QVector<quint32> &ids)
+{
+    if (ids.isEmpty() || graph.IsEmpty() || graphToolCount != tools.size())
+    {
+        return; // Nothing to update, the graph will be built from scratch.
+    }
+
+    QSet<quint32> edited;
+    for (int i = 0; i < ids.size(); ++i)
+    {
+        const quint32 vertex = graph.Owner(ids.at(i));
+        const QDomElement element = vertex != NULL_ID ? elementById(vertex) : QDomElement();
+        if (element.isNull())
+        {
+            graph.Clear(); // Unknown element, build the graph from scratch on next parse.
+            return;
+        }
+
+        graph.RemoveEdgesTo(vertex);
+        const QVector<quint32> references = ReferencedObjects(element);
+        for (int j = 0; j < references.size(); ++j)
+        {
+            graph.AddEdge(references.at(j), vertex);
+        }
+        edited.insert(vertex);
+    }
+
+    const QVector<VFormulaField> expressions = ListExpressions();
+    for (int i = 0; i < expressions.size(); ++i)
+    {
+        const quint32 child = FormulaOwner(expressions.at(i).element);
+        if (edited.contains(child))
+        {
+            addFormulaEdges(expressions.at(i).expression, child);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief addFormulaEdges add edges from objects whose variables the formula uses to the element.
+ * @param expression formula.
+ * @param child id of element the formula belongs to.
+ */
+void VPattern::addFormulaEdges(const QString &expression, quint32 child)
+{
+    const VPersistentHash<QString, QSharedPointer<VInternalVariable> > *variables = data->DataVariables();
+    try
+    {
+        QScopedPointer<qmu::QmuTokenParser> cal(new qmu::QmuTokenParser(expression, false, false));
+        const QList<QString> tokens = cal->GetTokens().values();
+        for (int i = 0; i < tokens.size(); ++i)
+        {
+            const QSharedPointer<VInternalVariable> variable = variables->value(tokens.at(i));
+            if (not variable.isNull() && variable->GetType() == VarType::Increment)
+            {
+                graph.AddVariableUse(tokens.at(i), child);
+                continue;
+            }
+
+            const QVector<quint32> objects = VariableObjects(variable);
+            for (int j = 0; j < objects.size(); ++j)
+            {
+                graph.AddEdge(objects.at(j), child);
+            }
+        }
+    }
+    catch (const qmu::QmuParserError &e)
+    {
+        Q_UNUSED(e)
+        graph.SetIncomplete(graph.DraftBlock(child));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief dependentVariables collect changed custom variables and variables calculated from them.
+ * @param variables names of variables with changed formulas.
+ * @param affected changed variables and all custom variables whose formulas use them directly or indirectly.
+ * @return false if a formula of a custom variable can't be tokenized.
+ */
+bool VPattern::dependentVariables(const QStringList &variables, QStringList &affected) const
+{
+    affected = variables;
+
+    QMap<QString, QList<QString>> tokens;
+    const QMap<QString, QSharedPointer<VIncrement> > increments = data->variablesData();
+    for (auto i = increments.constBegin(); i != increments.constEnd(); ++i)
+    {
+        try
+        {
+            QScopedPointer<qmu::QmuTokenParser> cal(new qmu::QmuTokenParser(i.value()->GetFormula(), false, false));
+            tokens.insert(i.key(), cal->GetTokens().values());
+        }
+        catch (const qmu::QmuParserError &e)
+        {
+            Q_UNUSED(e)
+            return false;
+        }
+    }
+
+    bool added = true;
+    while (added)
+    {
+        added = false;
+        for (auto i = tokens.constBegin(); i != tokens.constEnd(); ++i)
+        {
+            if (affected.contains(i.key()))
+            {
+                continue;
+            }
+
+            for (int j = 0; j < i.value().size(); ++j)
+            {
+                if (affected.contains(i.value().at(j)))
+                {
+                    affected.append(i.key());
+                    added = true;
+                    break;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VPattern::GetLabelBase(quint32 index) const
 {
@@ -1267,6 +1957,7 @@ QString VPattern::GetLabelBase(quint32 index) const
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolBasePoint(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolBasePoint");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1300,6 +1991,7 @@ void VPattern::ParseToolBasePoint(VMainGraphicsScene *scene, const QDomElement &
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolEndLine(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolEndLine");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1352,6 +2044,7 @@ void VPattern::ParseToolEndLine(VMainGraphicsScene *scene, QDomElement &domEleme
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolAlongLine(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolAlongLine");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1399,6 +2092,7 @@ void VPattern::ParseToolAlongLine(VMainGraphicsScene *scene, QDomElement &domEle
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolShoulderPoint(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolShoulderPoint");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1447,6 +2141,7 @@ void VPattern::ParseToolShoulderPoint(VMainGraphicsScene *scene, QDomElement &do
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolNormal(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolNormal");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1495,6 +2190,7 @@ void VPattern::ParseToolNormal(VMainGraphicsScene *scene, QDomElement &domElemen
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolBisector(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolBisector");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1543,6 +2239,7 @@ void VPattern::ParseToolBisector(VMainGraphicsScene *scene, QDomElement &domElem
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolLineIntersect(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolLineIntersect");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1574,6 +2271,7 @@ void VPattern::ParseToolLineIntersect(VMainGraphicsScene *scene, const QDomEleme
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolPointOfContact(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolPointOfContact");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1619,6 +2317,7 @@ void VPattern::ParseToolPointOfContact(VMainGraphicsScene *scene, QDomElement &d
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseNodePoint(const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseNodePoint");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
     try
@@ -1658,6 +2357,7 @@ void VPattern::ParseNodePoint(const QDomElement &domElement, const Document &par
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseAnchorPoint(const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseAnchorPoint");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
     try
@@ -1680,6 +2380,7 @@ void VPattern::ParseAnchorPoint(const QDomElement &domElement, const Document &p
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolHeight(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolHeight");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1713,6 +2414,7 @@ void VPattern::ParseToolHeight(VMainGraphicsScene *scene, const QDomElement &dom
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolTriangle(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolTriangle");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1745,6 +2447,7 @@ void VPattern::ParseToolTriangle(VMainGraphicsScene *scene, const QDomElement &d
 void VPattern::parseIntersectXYTool(VMainGraphicsScene *scene, const QDomElement &domElement,
                                             const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::parseIntersectXYTool");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1777,6 +2480,7 @@ void VPattern::parseIntersectXYTool(VMainGraphicsScene *scene, const QDomElement
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolCutSpline(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolCutSpline");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1819,6 +2523,7 @@ void VPattern::ParseToolCutSpline(VMainGraphicsScene *scene, QDomElement &domEle
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolCutSplinePath(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolCutSplinePath");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1862,6 +2567,7 @@ void VPattern::ParseToolCutSplinePath(VMainGraphicsScene *scene, QDomElement &do
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolCutArc(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolCutArc");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1905,6 +2611,7 @@ void VPattern::ParseToolCutArc(VMainGraphicsScene *scene, QDomElement &domElemen
 void VPattern::ParseToolLineIntersectAxis(VMainGraphicsScene *scene, QDomElement &domElement,
                                           const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolLineIntersectAxis");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -1958,6 +2665,7 @@ void VPattern::ParseToolLineIntersectAxis(VMainGraphicsScene *scene, QDomElement
 void VPattern::ParseToolCurveIntersectAxis(VMainGraphicsScene *scene, QDomElement &domElement,
                                            const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolCurveIntersectAxis");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2009,6 +2717,7 @@ void VPattern::ParseToolCurveIntersectAxis(VMainGraphicsScene *scene, QDomElemen
 void VPattern::ParseToolPointOfIntersectionArcs(VMainGraphicsScene *scene, const QDomElement &domElement,
                                                 const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolPointOfIntersectionArcs");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2042,6 +2751,7 @@ void VPattern::ParseToolPointOfIntersectionArcs(VMainGraphicsScene *scene, const
 void VPattern::ParseToolPointOfIntersectionCircles(VMainGraphicsScene *scene, QDomElement &domElement,
                                                    const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolPointOfIntersectionCircles");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2086,6 +2796,7 @@ void VPattern::ParseToolPointOfIntersectionCircles(VMainGraphicsScene *scene, QD
 void VPattern::ParseToolPointOfIntersectionCurves(VMainGraphicsScene *scene, QDomElement &domElement,
                                                   const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolPointOfIntersectionCurves");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2118,6 +2829,7 @@ void VPattern::ParseToolPointOfIntersectionCurves(VMainGraphicsScene *scene, QDo
 void VPattern::ParseToolPointFromCircleAndTangent(VMainGraphicsScene *scene, QDomElement &domElement,
                                                   const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolPointFromCircleAndTangent");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2160,6 +2872,7 @@ void VPattern::ParseToolPointFromCircleAndTangent(VMainGraphicsScene *scene, QDo
 void VPattern::ParseToolPointFromArcAndTangent(VMainGraphicsScene *scene, const QDomElement &domElement,
                                                const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolPointFromArcAndTangent");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2192,6 +2905,7 @@ void VPattern::ParseToolPointFromArcAndTangent(VMainGraphicsScene *scene, const
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolTrueDarts(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolTrueDarts");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2238,6 +2952,7 @@ void VPattern::ParseToolTrueDarts(VMainGraphicsScene *scene, const QDomElement &
 // TODO. Delete if minimal supported version is 0.2.7
 void VPattern::ParseOldToolSpline(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseOldToolSpline");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2279,6 +2994,7 @@ void VPattern::ParseOldToolSpline(VMainGraphicsScene *scene, const QDomElement &
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolSpline(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolSpline");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2345,6 +3061,7 @@ void VPattern::ParseToolSpline(VMainGraphicsScene *scene, QDomElement &domElemen
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolCubicBezier(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolCubicBezier");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2390,6 +3107,7 @@ void VPattern::ParseToolCubicBezier(VMainGraphicsScene *scene, const QDomElement
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseOldToolSplinePath(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseOldToolSplinePath");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2452,6 +3170,7 @@ void VPattern::ParseOldToolSplinePath(VMainGraphicsScene *scene, const QDomEleme
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolSplinePath(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolSplinePath");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2546,6 +3265,7 @@ void VPattern::ParseToolSplinePath(VMainGraphicsScene *scene, const QDomElement
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolCubicBezierPath(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolCubicBezierPath");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
@@ -2603,6 +3323,7 @@ void VPattern::ParseToolCubicBezierPath(VMainGraphicsScene *scene, const QDomEle
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseNodeSpline(const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseNodeSpline");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
     try
@@ -2649,6 +3370,7 @@ void VPattern::ParseNodeSpline(const QDomElement &domElement, const Document &pa
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseNodeSplinePath(const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseNodeSplinePath");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
     try
@@ -2694,6 +3416,7 @@ void VPattern::ParseNodeSplinePath(const QDomElement &domElement, const Document
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolArc(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolArc");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
 
@@ -2742,6 +3465,7 @@ void VPattern::ParseToolArc(VMainGraphicsScene *scene, QDomElement &domElement,
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolEllipticalArc(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolEllipticalArc");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
 
@@ -2797,6 +3521,7 @@ void VPattern::ParseToolEllipticalArc(VMainGraphicsScene *scene, QDomElement &do
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseNodeEllipticalArc(const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseNodeEllipticalArc");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
     try
@@ -2832,6 +3557,7 @@ void VPattern::ParseNodeEllipticalArc(const QDomElement &domElement, const Docum
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseNodeArc(const QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseNodeArc");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
     try
@@ -2867,6 +3593,7 @@ void VPattern::ParseNodeArc(const QDomElement &domElement, const Document &parse
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolArcWithLength(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolArcWithLength");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
 
@@ -2916,6 +3643,7 @@ void VPattern::ParseToolArcWithLength(VMainGraphicsScene *scene, QDomElement &do
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolRotation(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolRotation");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
 
@@ -2959,6 +3687,7 @@ void VPattern::ParseToolRotation(VMainGraphicsScene *scene, QDomElement &domElem
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolMirrorByLine(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolMirrorByLine");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
 
@@ -2989,6 +3718,7 @@ void VPattern::ParseToolMirrorByLine(VMainGraphicsScene *scene, QDomElement &dom
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolMirrorByAxis(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolMirrorByAxis");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
 
@@ -3019,6 +3749,7 @@ void VPattern::ParseToolMirrorByAxis(VMainGraphicsScene *scene, QDomElement &dom
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParseToolMove(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolMove");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
 
@@ -3178,6 +3909,7 @@ void VPattern::GarbageCollector()
 void VPattern::ParseSplineElement(VMainGraphicsScene *scene, QDomElement &domElement,
                                   const Document &parse, const QString &type)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseSplineElement");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
     Q_ASSERT_X(type.isEmpty() == false, Q_FUNC_INFO, "type of spline is empty");
@@ -3241,6 +3973,7 @@ void VPattern::ParseSplineElement(VMainGraphicsScene *scene, QDomElement &domEle
 void VPattern::ParseArcElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse,
                                const QString &type)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseArcElement");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     Q_ASSERT_X(not type.isEmpty(), Q_FUNC_INFO, "type of arc is empty");
@@ -3277,6 +4010,7 @@ void VPattern::ParseArcElement(VMainGraphicsScene *scene, QDomElement &domElemen
 void VPattern::ParseEllipticalArcElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse,
                                const QString &type)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseEllipticalArcElement");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     Q_ASSERT_X(not type.isEmpty(), Q_FUNC_INFO, "type of elliptical arc is empty");
@@ -3309,6 +4043,7 @@ void VPattern::ParseEllipticalArcElement(VMainGraphicsScene *scene, QDomElement
 void VPattern::ParseToolsElement(VMainGraphicsScene *scene, const QDomElement &domElement,
                                  const Document &parse, const QString &type)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseToolsElement");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(domElement.isNull() == false, Q_FUNC_INFO, "domElement is null");
     Q_ASSERT_X(type.isEmpty() == false, Q_FUNC_INFO, "type of spline is empty");
@@ -3350,6 +4085,7 @@ void VPattern::ParseToolsElement(VMainGraphicsScene *scene, const QDomElement &d
 void VPattern::ParseOperationElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse,
                                      const QString &type)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseOperationElement");
     SCASSERT(scene != nullptr)
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     Q_ASSERT_X(not type.isEmpty(), Q_FUNC_INFO, "type of operation is empty");
@@ -3382,6 +4118,7 @@ void VPattern::ParseOperationElement(VMainGraphicsScene *scene, QDomElement &dom
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::ParsePathElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParsePathElement");
     SCASSERT(scene != nullptr);
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
     try
@@ -3424,6 +4161,7 @@ void VPattern::ParsePathElement(VMainGraphicsScene *scene, QDomElement &domEleme
  */
 void VPattern::ParseIncrementsElement(const QDomNode &node)
 {
+    V_TRACE_SCOPE("parse", "VPattern::ParseIncrementsElement");
     int index = 0;
     QDomNode domNode = node.firstChild();
     while (domNode.isNull() == false)
@@ -3932,6 +4670,9 @@ void VPattern::PrepareForParse(const Document &parse)
         tools.clear();
         cursor = 0;
         history.clear();
+
+        headless = false;
+        pieceData.clear();
     }
     else if (parse == Document::LiteParse)
     {
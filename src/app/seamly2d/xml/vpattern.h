@@ -57,9 +57,11 @@
 #include "../ifc/xml/vtoolrecord.h"
 #include "../vpatterndb/vcontainer.h"
 #include "../ifc/xml/vpatternconverter.h"
+#include "../ifc/xml/vpatterngraph.h"
 
 class VMainGraphicsScene;
 class VNodeDetail;
+class QXmlStreamReader;
 
 /**
  * @brief The VPattern class working with pattern file.
@@ -74,9 +76,11 @@ class VPattern : public VAbstractPattern
     virtual void   CreateEmptyFile() Q_DECL_OVERRIDE;
 
     void           Parse(const Document &parse);
+    void           Evaluate();
 
     void           setCurrentData();
     virtual void   UpdateToolData(const quint32 &id, VContainer *data) Q_DECL_OVERRIDE;
+    VContainer     getPieceData(quint32 id) const;
 
     virtual void   IncrementReferens(quint32 id) const Q_DECL_OVERRIDE;
     virtual void   DecrementReferens(quint32 id) const Q_DECL_OVERRIDE;
@@ -86,6 +90,7 @@ class VPattern : public VAbstractPattern
     QVector<quint32> getActivePatternPieces() const;
 
     virtual void   setXMLContent(const QString &fileName) Q_DECL_OVERRIDE;
+    void           setXMLContentForEvaluation(const QString &fileName);
     virtual bool   SaveDocument(const QString &fileName, QString &error) Q_DECL_OVERRIDE;
 
     QRectF         ActiveDrawBoundingRect() const;
@@ -135,10 +140,23 @@ public slots:
     VMainGraphicsScene *draftScene;
     VMainGraphicsScene *pieceScene;
 
+    VPatternGraph       graph;              /** @brief graph dependencies between pattern objects. */
+    int                 graphToolCount;     /** @brief graphToolCount number of tools when graph was built. */
+    QSet<quint32>       incrementalObjects; /** @brief incrementalObjects objects to recalculate by lite parse. */
+    bool                incrementalStarted; /** @brief incrementalStarted first changed object was recalculated. */
+
+    bool                headless;           /** @brief headless pattern was evaluated without tools. */
+    QHash<quint32, VContainer> pieceData;   /** @brief pieceData data of pieces evaluated without tools. */
+    QString             streamSource;       /** @brief streamSource file calculation sections are read from. */
+
     VNodeDetail    parsePieceNode(const QDomElement &domElement) const;
 
     void           parseDraftBlockElement(const QDomNode &node, const Document &parse);
     void           ParseDrawMode(const QDomNode &node, const Document &parse, const Draw &mode);
+    void           parseDrawElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse);
+    void           parseStream(const Document &parse);
+    void           parseStreamedDraftBlock(QXmlStreamReader &reader, const QDomElement &block,
+                                           const Document &parse);
     void           parsePieceElement(QDomElement &domElement, const Document &parse);
     void           parsePieceNodes(const QDomElement &domElement, VPiece &piece, qreal width, bool closed) const;
     void           ParsePieceDataTag(const QDomElement &domElement, VPiece &piece) const;
@@ -177,6 +195,14 @@ public slots:
     template <typename T>
     QRectF         ToolBoundingRect(const QRectF &rec, const quint32 &id) const;
     void           parseCurrentDraftBlock();
+    bool           incrementalParse(const QVector<quint32> &changed, const QStringList &variables,
+                                    QSet<quint32> &updated);
+    bool           isSkippedByIncrementalParse(const QDomElement &domElement);
+    void           buildGraph();
+    void           updateGraphEdges(const QVector<quint32> &ids);
+    void           addFormulaEdges(const QString &expression, quint32 child);
+    bool           dependentVariables(const QStringList &variables, QStringList &affected) const;
+    void           traceToolDataMemory() const;
     QString        GetLabelBase(quint32 index)const;
 
     void ParseToolBasePoint(VMainGraphicsScene *scene, const QDomElement &domElement, const Document &parse);
@@ -58,6 +58,8 @@
 #include "../ifc/exception/vexceptionconversionerror.h"
 #include "../ifc/exception/vexceptionemptyparameter.h"
 #include "../ifc/exception/vexceptionwrongid.h"
+#include "../ifc/xml/abstract_converter.h"
+#include "../ifc/xml/vdomdocument.h"
 #include "../vmisc/logging.h"
 #include "../vmisc/vsysexits.h"
 #include "../vmisc/diagnostic.h"
@@ -65,6 +67,7 @@
 
 #include <Qt>
 #include <QDir>
+#include <QFileInfo>
 #include <QFileOpenEvent>
 #include <QLocalSocket>
 #include <QResource>
@@ -489,6 +492,10 @@ void MApplication::OpenSettings()
 {
     settings = new VSeamlyMeSettings(QSettings::IniFormat, QSettings::UserScope, QCoreApplication::organizationName(),
                                  QCoreApplication::applicationName(), this);
+
+    // Stamps of validated files live next to the settings, so console runs don't validate the same file again.
+    VDomDocument::SetValidationStampsFile(QFileInfo(settings->fileName()).absolutePath()
+                                          + QLatin1String("/validation.stamps"));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -631,6 +638,8 @@ void MApplication::ParseCommandLine(const SocketConnection &connection, const QS
     }
 
     testMode = parser.isSet(testOption);
+    // Test mode checks every conversion step of old files, not only the result.
+    VAbstractConverter::SetValidateEachStep(testMode);
 
     if (not testMode && connection == SocketConnection::Client)
     {
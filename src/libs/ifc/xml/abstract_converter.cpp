@@ -59,6 +59,7 @@
 
 #include "abstract_converter.h"
 
+#include <QBuffer>
 #include <QDir>
 #include <QDomElement>
 #include <QDomNode>
@@ -73,11 +74,14 @@
 #include <QStringData>
 #include <QStringDataPtr>
 #include <QStringList>
+#include <QXmlStreamReader>
 
 #include "../exception/vexception.h"
 #include "../exception/vexceptionwrongid.h"
 #include "vdomdocument.h"
 
+bool VAbstractConverter::validateEachStep = false;
+
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractConverter::VAbstractConverter(const QString &fileName)
     : VDomDocument()
@@ -117,7 +121,9 @@ QString VAbstractConverter::Convert()
     qInfo() << " m_ver = " << m_ver;
     qInfo() << " MaxVer = " << maxVer();
 
+    // Conversion steps change only the document in memory, the result is written once.
     m_ver < maxVer() ? applyPatches() : downgradeToCurrentMaxVersion();
+    Save();
 
     return m_convertedFileName;
 }
@@ -157,6 +163,39 @@ QString VAbstractConverter::GetVersionStr() const
     return QString(QStringLiteral("0.0.0"));
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadVersionStr read version of a file without loading the whole document. The version tag is one of the first
+ * tags, so only the beginning of the file is read.
+ * @param fileName file to read.
+ * @return version string.
+ */
+QString VAbstractConverter::ReadVersionStr(const QString &fileName)
+{
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        const QString errorMsg(tr("Can't open file %1:\n%2.").arg(fileName).arg(file.errorString()));
+        throw VException(errorMsg);
+    }
+
+    QXmlStreamReader reader(&file);
+    if (reader.readNextStartElement())
+    {
+        while (reader.readNextStartElement())
+        {
+            if (reader.name() == TagVersion)
+            {
+                return reader.readElementText();
+            }
+            reader.skipCurrentElement();
+        }
+    }
+
+    const QString errorMsg(tr("Couldn't get version information."));
+    throw VException(errorMsg);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 int VAbstractConverter::GetVersion(const QString &version)
 {
@@ -187,6 +226,22 @@ int VAbstractConverter::GetVersion(const QString &version)
     return (major<<16)|(minor<<8)|(patch);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetValidateEachStep enable validation of every intermediate version during conversion. By default only the
+ * converted document is validated, that is enough to open a file. Tests enable it to check each conversion step.
+ */
+void VAbstractConverter::SetValidateEachStep(bool value)
+{
+    validateEachStep = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VAbstractConverter::IsValidateEachStep()
+{
+    return validateEachStep;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VAbstractConverter::removeVersionNumber(const QString& fileName)
 {
@@ -368,6 +423,11 @@ Q_NORETURN void VAbstractConverter::InvalidVersion(int ver) const
 //---------------------------------------------------------------------------------------------------------------------
 void VAbstractConverter::ValidateInputFile(const QString &currentSchema) const
 {
+    if (m_ver >= minVer() && m_ver < maxVer() && not validateEachStep)
+    { // An old file will be converted and the result validated.
+        return;
+    }
+
     QString schema;
     try
     {
@@ -402,6 +462,25 @@ void VAbstractConverter::ValidateInputFile(const QString &currentSchema) const
     ValidateXML(schema, m_convertedFileName);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ValidateStep validate the document in memory after conversion to version ver. Intermediate versions are
+ * checked only if validation of each step is enabled, the last version always.
+ * @param ver version the document was converted to.
+ */
+void VAbstractConverter::ValidateStep(int ver) const
+{
+    if (ver != maxVer() && not validateEachStep)
+    {
+        return;
+    }
+
+    const int indent = 4;
+    QBuffer buffer;
+    buffer.setData(toByteArray(indent));
+    ValidateXML(getSchema(ver), &buffer, m_convertedFileName);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VAbstractConverter::Save()
 {
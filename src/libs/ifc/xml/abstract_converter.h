@@ -85,13 +85,18 @@ class VAbstractConverter :public VDomDocument
     int             GetCurrentFormatVarsion() const;
     QString         GetVersionStr() const;
 
+    static QString  ReadVersionStr(const QString &fileName);
     static int      GetVersion(const QString &version);
 
+    static void     SetValidateEachStep(bool value);
+    static bool     IsValidateEachStep();
+
 protected:
     int             m_ver;
     QString         m_convertedFileName;
 
     void            ValidateInputFile(const QString &currentSchema) const;
+    void            ValidateStep(int ver) const;
     Q_NORETURN void InvalidVersion(int ver) const;
     void            Save();
     void            setVersion(const QString &version);
@@ -118,6 +123,8 @@ class VAbstractConverter :public VDomDocument
 
     QTemporaryFile  m_tmpFile;
 
+    static bool     validateEachStep;
+
     static void     ValidateVersion(const QString &version);
 
     void            ReserveFile() const;
@@ -126,23 +126,23 @@ void IndividualSizeConverter::applyPatches()
     {
         case (0x000200):
             convertToVer0_3_0();
-            ValidateXML(getSchema(0x000300), m_convertedFileName);
+            ValidateStep(0x000300);
             V_FALLTHROUGH
         case (0x000300):
             convertToVer0_3_1();
-            ValidateXML(getSchema(0x000301), m_convertedFileName);
+            ValidateStep(0x000301);
             V_FALLTHROUGH
         case (0x000301):
             convertToVer0_3_2();
-            ValidateXML(getSchema(0x000302), m_convertedFileName);
+            ValidateStep(0x000302);
             V_FALLTHROUGH
         case (0x000302):
             convertToVer0_3_3();
-            ValidateXML(getSchema(0x000303), m_convertedFileName);
+            ValidateStep(0x000303);
             V_FALLTHROUGH
         case (0x000303):
             convertToVer0_3_4();
-            ValidateXML(getSchema(0x000304), m_convertedFileName);
+            ValidateStep(0x000304);
             V_FALLTHROUGH
         case (0x000304):
             break;
@@ -156,7 +156,6 @@ void IndividualSizeConverter::applyPatches()
 void IndividualSizeConverter::downgradeToCurrentMaxVersion()
 {
     setVersion(MeasurementMaxVerStr);
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -343,7 +342,6 @@ void IndividualSizeConverter::convertToVer0_3_0()
     setVersion(QStringLiteral("0.3.0"));
     addNewTagsForVer0_3_0();
     convertMeasurementsToV0_3_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -355,7 +353,6 @@ void IndividualSizeConverter::convertToVer0_3_1()
 
     setVersion(QStringLiteral("0.3.1"));
     convertGenderToVer0_3_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -367,7 +364,6 @@ void IndividualSizeConverter::convertToVer0_3_2()
 
     setVersion(QStringLiteral("0.3.2"));
     convertPmSystemToVer0_3_2();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -379,7 +375,6 @@ void IndividualSizeConverter::convertToVer0_3_3()
 
     setVersion(QStringLiteral("0.3.3"));
     convertMeasurementsToV0_3_3();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -400,5 +395,4 @@ void IndividualSizeConverter::convertToVer0_3_4()
     }
 
     setVersion(QStringLiteral("0.3.4"));
-    Save();
 }
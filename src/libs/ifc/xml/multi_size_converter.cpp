@@ -128,27 +128,27 @@ void MultiSizeConverter::applyPatches()
     {
         case (0x000300):
             convertToVer0_4_0();
-            ValidateXML(getSchema(0x000400), m_convertedFileName);
+            ValidateStep(0x000400);
             V_FALLTHROUGH
         case (0x000400):
             convertToVer0_4_1();
-            ValidateXML(getSchema(0x000401), m_convertedFileName);
+            ValidateStep(0x000401);
             V_FALLTHROUGH
         case (0x000401):
             convertToVer0_4_2();
-            ValidateXML(getSchema(0x000402), m_convertedFileName);
+            ValidateStep(0x000402);
             V_FALLTHROUGH
         case (0x000402):
             convertToVer0_4_3();
-            ValidateXML(getSchema(0x000403), m_convertedFileName);
+            ValidateStep(0x000403);
             V_FALLTHROUGH
         case (0x000403):
             convertToVer0_4_4();
-            ValidateXML(getSchema(0x000404), m_convertedFileName);
+            ValidateStep(0x000404);
             V_FALLTHROUGH
         case (0x000404):
             convertToVer0_4_5();
-            ValidateXML(getSchema(0x000405), m_convertedFileName);
+            ValidateStep(0x000405);
             V_FALLTHROUGH
         case (0x000405):
             break;
@@ -162,7 +162,6 @@ void MultiSizeConverter::applyPatches()
 void MultiSizeConverter::downgradeToCurrentMaxVersion()
 {
     setVersion(MeasurementMaxVerStr);
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -361,7 +360,6 @@ void MultiSizeConverter::convertToVer0_4_0()
     addNewTagsForVer0_4_0();
     removeTagsForVer0_4_0();
     convertMeasurementsToV0_4_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -373,7 +371,6 @@ void MultiSizeConverter::convertToVer0_4_1()
 
     setVersion(QStringLiteral("0.4.1"));
     convertPmSystemToVer0_4_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -385,7 +382,6 @@ void MultiSizeConverter::convertToVer0_4_2()
 
     setVersion(QStringLiteral("0.4.2"));
     convertMeasurementsToV0_4_2();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -396,7 +392,6 @@ void MultiSizeConverter::convertToVer0_4_3()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.4.3"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -407,7 +402,6 @@ void MultiSizeConverter::convertToVer0_4_4()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.4.4"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -428,5 +422,4 @@ void MultiSizeConverter::convertToVer0_4_5()
     }
 
     setVersion(QStringLiteral("0.4.5"));
-    Save();
 }
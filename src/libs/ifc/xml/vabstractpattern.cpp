@@ -267,6 +267,10 @@ VAbstractPattern::VAbstractPattern(QObject *parent)
     , history(QVector<VToolRecord>())
     , patternPieces(QStringList())
     , modified(false)
+    , changedObjects()
+    , changedFormulas()
+    , changedVariables()
+    , updatedTools()
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -671,6 +675,56 @@ void VAbstractPattern::RemoveTool(quint32 id)
     tools.remove(id);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MarkObjectChanged remember that attributes of the object were changed.
+ *
+ * Call before the lite parse that follows the change. If only marked objects were changed the parse recalculates
+ * them and their dependents instead of the whole pattern. Don't mark changes of names or object references.
+ * @param id object id.
+ * @param formulasChanged true if formulas of the object were changed. A formula can start using variables of other
+ * objects, so dependencies of the object will be collected again.
+ */
+void VAbstractPattern::MarkObjectChanged(quint32 id, bool formulasChanged)
+{
+    if (not changedObjects.contains(id))
+    {
+        changedObjects.append(id);
+    }
+
+    if (formulasChanged && not changedFormulas.contains(id))
+    {
+        changedFormulas.append(id);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MarkVariableChanged remember that the formula of a custom variable was changed.
+ *
+ * Like MarkObjectChanged, lets the following lite parse recalculate only objects that use the variable. Don't mark
+ * renamed, added, removed or moved variables.
+ * @param name variable name.
+ */
+void VAbstractPattern::MarkVariableChanged(const QString &name)
+{
+    if (not changedVariables.contains(name))
+    {
+        changedVariables.append(name);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsToolUpdateRequired check if the tool should react on FullUpdateFromFile.
+ * @param id tool id.
+ * @return false if the last parse was partial and didn't touch the tool.
+ */
+bool VAbstractPattern::IsToolUpdateRequired(quint32 id) const
+{
+    return updatedTools.isEmpty() || updatedTools.contains(id);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VPiecePath VAbstractPattern::ParsePieceNodes(const QDomElement &domElement)
 {
@@ -59,6 +59,7 @@
 #include <QMetaObject>
 #include <QObject>
 #include <QPair>
+#include <QSet>
 #include <QString>
 #include <QStringList>
 #include <QVector>
@@ -149,6 +150,10 @@ class VAbstractPattern : public QObject, public VDomDocument
 
     virtual void                   UpdateToolData(const quint32 &id, VContainer *data)=0;
 
+    void                           MarkObjectChanged(quint32 id, bool formulasChanged = false);
+    void                           MarkVariableChanged(const QString &name);
+    bool                           IsToolUpdateRequired(quint32 id) const;
+
     static VDataTool              *getTool(quint32 id);
     static void                    AddTool(quint32 id, VDataTool *tool);
     static void                    RemoveTool(quint32 id);
@@ -492,6 +497,18 @@ public slots:
     /** @brief modified keep state of the document for cases that do not cover QUndoStack*/
     mutable bool   modified;
 
+    /** @brief changedObjects objects whose attributes were changed since the last parse. */
+    QVector<quint32> changedObjects;
+
+    /** @brief changedFormulas changed objects whose formulas may refer to other objects now. */
+    QVector<quint32> changedFormulas;
+
+    /** @brief changedVariables custom variables whose formulas were changed since the last parse. */
+    QStringList      changedVariables;
+
+    /** @brief updatedTools tools to refresh on FullUpdateFromFile. Empty means all tools. */
+    QSet<quint32>  updatedTools;
+
     /** @brief tools list with pointer on tools. */
     static QHash<quint32, VDataTool*> tools;
     /** @brief patternLabelLines list to speed up reading a template by many pieces. */
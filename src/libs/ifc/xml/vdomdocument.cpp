@@ -66,12 +66,17 @@
 
 #include <QAbstractMessageHandler>
 #include <QByteArray>
+#include <QCryptographicHash>
 #include <QDomNodeList>
 #include <QDomText>
 #include <QFile>
 #include <QIODevice>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QMessageLogger>
 #include <QObject>
+#include <QSet>
 #include <QSourceLocation>
 #include <QStringList>
 #include <QTemporaryFile>
@@ -82,10 +87,68 @@
 #include <QXmlSchema>
 #include <QXmlSchemaValidator>
 #include <QtDebug>
+#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 namespace
 {
+//---------------------------------------------------------------------------------------------------------------------
+QDomElement CreateStreamElement(const QXmlStreamReader &reader, QDomDocument &doc)
+{
+    QDomElement element = doc.createElement(reader.qualifiedName().toString());
+    const QXmlStreamAttributes attributes = reader.attributes();
+    for (int i = 0; i < attributes.size(); ++i)
+    {
+        element.setAttribute(attributes.at(i).qualifiedName().toString(), attributes.at(i).value().toString());
+    }
+    return element;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadStreamChildren read nodes up to the end of current element (or document) and append them to parent.
+ * Elements with a tag from the skipped list are not read at all. Like QDomDocument::setContent() whitespace-only text
+ * is ignored.
+ */
+void ReadStreamChildren(QXmlStreamReader &reader, QDomDocument &doc, QDomNode &parent, const QStringList &skipped)
+{
+    while (not reader.atEnd())
+    {
+        switch (reader.readNext())
+        {
+            case QXmlStreamReader::StartElement:
+                if (skipped.contains(reader.name().toString()))
+                {
+                    reader.skipCurrentElement();
+                }
+                else
+                {
+                    QDomElement element = CreateStreamElement(reader, doc);
+                    parent.appendChild(element);
+                    ReadStreamChildren(reader, doc, element, skipped);
+                }
+                break;
+            case QXmlStreamReader::EndElement:
+                return;
+            case QXmlStreamReader::Characters:
+                if (reader.isCDATA())
+                {
+                    parent.appendChild(doc.createCDATASection(reader.text().toString()));
+                }
+                else if (not reader.isWhitespace())
+                {
+                    parent.appendChild(doc.createTextNode(reader.text().toString()));
+                }
+                break;
+            case QXmlStreamReader::Comment:
+                parent.appendChild(doc.createComment(reader.text().toString()));
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void SaveNodeCanonically(QXmlStreamWriter &stream, const QDomNode &domNode)
 {
@@ -200,6 +263,210 @@ void MessageHandler::handleMessage(QtMsgType type, const QString &description, c
     m_sourceLocation = sourceLocation;
 }
 
+namespace
+{
+const int maxValidationStamps = 1000;
+
+/**
+ * @brief The ValidationCache class keeps compiled schemas for the whole process and stamps of content that passed
+ * validation before.
+ *
+ * A stamp is a hash of schema and content, so the same file is accepted without validation only while the schema is
+ * the same. Stamps are shared between processes through a file, that saves validation in short console runs.
+ */
+class ValidationCache
+{
+public:
+    static ValidationCache *Instance();
+
+    QByteArray SchemaHash(const QString &path);
+    QXmlSchema Schema(const QString &path);
+
+    void SetStampsFile(const QString &fileName);
+    bool IsStamped(const QByteArray &stamp);
+    void AddStamp(const QByteArray &stamp);
+
+private:
+    ValidationCache();
+    Q_DISABLE_COPY(ValidationCache)
+
+    QMutex                     mutex;
+    MessageHandler             schemaHandler;
+    QHash<QString, QByteArray> schemaTexts;
+    QHash<QString, QByteArray> schemaHashes;
+    QHash<QString, QXmlSchema> schemas;
+    QString                    stampsFile;
+    bool                       stampsLoaded;
+    QSet<QByteArray>           stamps;
+
+    QByteArray SchemaText(const QString &path);
+    void       LoadStamps();
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+ValidationCache::ValidationCache()
+    : mutex(),
+      schemaHandler(),
+      schemaTexts(),
+      schemaHashes(),
+      schemas(),
+      stampsFile(),
+      stampsLoaded(false),
+      stamps()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+ValidationCache *ValidationCache::Instance()
+{
+    static ValidationCache cache;
+    return &cache;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray ValidationCache::SchemaHash(const QString &path)
+{
+    QMutexLocker locker(&mutex);
+    if (not schemaHashes.contains(path))
+    {
+        schemaHashes.insert(path, QCryptographicHash::hash(SchemaText(path), QCryptographicHash::Sha256));
+    }
+    return schemaHashes.value(path);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QXmlSchema ValidationCache::Schema(const QString &path)
+{
+    QMutexLocker locker(&mutex);
+    if (schemas.contains(path))
+    {
+        return schemas.value(path);
+    }
+
+    QXmlSchema schema;
+    schema.setMessageHandler(&schemaHandler);
+    if (schema.load(SchemaText(path), QUrl::fromLocalFile(path)) == false)
+    {
+        VException e(schemaHandler.statusMessage());
+        e.AddMoreInformation(VDomDocument::tr("Could not load schema file '%1'.").arg(path));
+        throw e;
+    }
+    qCDebug(vXML, "Schema loaded.");
+
+    if (schema.isValid() == false)
+    {
+        throw VException(schemaHandler.statusMessage());
+    }
+
+    schemas.insert(path, schema);
+    return schema;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray ValidationCache::SchemaText(const QString &path)
+{
+    if (schemaTexts.contains(path))
+    {
+        return schemaTexts.value(path);
+    }
+
+    QFile fileSchema(path);
+    // cppcheck-suppress ConfigurationNotChecked
+    if (fileSchema.open(QIODevice::ReadOnly) == false)
+    {
+        const QString errorMsg(VDomDocument::tr("Can't open schema file %1:\n%2.").arg(path)
+                               .arg(fileSchema.errorString()));
+        throw VException(errorMsg);
+    }
+
+    const QByteArray text = fileSchema.readAll();
+    schemaTexts.insert(path, text);
+    return text;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void ValidationCache::SetStampsFile(const QString &fileName)
+{
+    QMutexLocker locker(&mutex);
+    stampsFile = fileName;
+    stampsLoaded = false;
+    stamps.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool ValidationCache::IsStamped(const QByteArray &stamp)
+{
+    QMutexLocker locker(&mutex);
+    LoadStamps();
+    return stamps.contains(stamp);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void ValidationCache::AddStamp(const QByteArray &stamp)
+{
+    QMutexLocker locker(&mutex);
+    if (stampsFile.isEmpty())
+    {
+        return;
+    }
+
+    LoadStamps();
+    if (stamps.contains(stamp))
+    {
+        return;
+    }
+    stamps.insert(stamp);
+
+    // Other processes can append at the same time. A broken line is just a stamp that never matches.
+    QFile file(stampsFile);
+    if (file.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        file.write(stamp + '\n');
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void ValidationCache::LoadStamps()
+{
+    if (stampsLoaded || stampsFile.isEmpty())
+    {
+        return;
+    }
+    stampsLoaded = true;
+
+    QFile file(stampsFile);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    QList<QByteArray> lines = file.readAll().split('\n');
+    file.close();
+
+    if (lines.size() > maxValidationStamps)
+    { // Keep the file small, the newest stamps are at the end.
+        lines = lines.mid(lines.size() - maxValidationStamps / 2);
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            for (int i = 0; i < lines.size(); ++i)
+            {
+                if (not lines.at(i).isEmpty())
+                {
+                    file.write(lines.at(i) + '\n');
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        if (not lines.at(i).isEmpty())
+        {
+            stamps.insert(lines.at(i));
+        }
+    }
+}
+}
+
 Q_LOGGING_CATEGORY(vXML, "v.xml")
 
 const QString VDomDocument::AttrId          = QStringLiteral("id");
@@ -229,44 +496,48 @@ QDomElement VDomDocument::elementById(quint32 id, const QString &tagName)
 
     if (map.contains(id))
     {
-       const QDomElement e = map[id];
-       if (e.parentNode().nodeType() != QDomNode::BaseNode)
-       {
-           return e;
-       }
-       map.remove(id);
+        const QDomElement e = map.value(id);
+        if (IsIndexedElement(e, id))
+        {
+            if (tagName.isEmpty() || e.tagName() == tagName)
+            {
+                return e;
+            }
+        }
+        else
+        {
+            map.remove(id);
+        }
     }
 
     if (tagName.isEmpty())
     {
-        if (this->find(this->documentElement(), id))
-        {
-           return map[id];
-        }
+        // The element was added after the last walk or the cached one was moved away. One walk re-indexes all of
+        // them, so the following lookups hit the cache again.
+        RefreshElementIdCache();
+        return map.value(id);
     }
-    else
+
+    const QDomNodeList list = elementsByTagName(tagName);
+    for (int i=0; i < list.size(); ++i)
     {
-        const QDomNodeList list = elementsByTagName(tagName);
-        for (int i=0; i < list.size(); ++i)
+        const QDomElement domElement = list.at(i).toElement();
+        if (not domElement.isNull() && domElement.hasAttribute(AttrId))
         {
-            const QDomElement domElement = list.at(i).toElement();
-            if (not domElement.isNull() && domElement.hasAttribute(AttrId))
+            try
             {
-                try
-                {
-                    const quint32 elementId = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+                const quint32 elementId = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
 
-                    this->map[elementId] = domElement;
-                    if (elementId == id)
-                    {
-                        return domElement;
-                    }
-                }
-                catch (const VExceptionConversionError &)
+                this->map[elementId] = domElement;
+                if (elementId == id)
                 {
-                    // do nothing
+                    return domElement;
                 }
             }
+            catch (const VExceptionConversionError &)
+            {
+                // do nothing
+            }
         }
     }
 
@@ -275,24 +546,22 @@ QDomElement VDomDocument::elementById(quint32 id, const QString &tagName)
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Find element by id.
- * @param node node
- * @param id id value
- * @return true if found
+ * @brief RefreshElementIdCache rebuild the id index with a single walk over the whole document.
  */
-bool VDomDocument::find(const QDomElement &node, quint32 id)
+void VDomDocument::RefreshElementIdCache()
+{
+    map.clear();
+    IndexElement(documentElement());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDomDocument::IndexElement(const QDomElement &node)
 {
     if (node.hasAttribute(AttrId))
     {
         try
         {
-            const quint32 elementId = GetParametrUInt(node, AttrId, NULL_ID_STR);
-
-            this->map[elementId] = node;
-            if (elementId == id)
-            {
-                return true;
-            }
+            map.insert(GetParametrUInt(node, AttrId, NULL_ID_STR), node);
         }
         catch (const VExceptionConversionError &)
         {
@@ -300,16 +569,40 @@ bool VDomDocument::find(const QDomElement &node, quint32 id)
         }
     }
 
-    for (qint32 i=0; i<node.childNodes().length(); ++i)
+    for (QDomElement child = node.firstChildElement(); not child.isNull(); child = child.nextSiblingElement())
     {
-        const QDomNode n = node.childNodes().at(i);
-        if (n.isElement())
+        IndexElement(child);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsIndexedElement check if cached element still belongs to the document and still has the same id.
+ *
+ * Tools and undo commands edit the tree through QDomNode directly, so the index can't be kept in sync with every
+ * insert or remove. Instead a hit is checked before it is returned.
+ */
+bool VDomDocument::IsIndexedElement(const QDomElement &element, quint32 id) const
+{
+    if (element.isNull())
+    {
+        return false;
+    }
+
+    bool ok = false;
+    if (element.attribute(AttrId).toUInt(&ok) != id || not ok)
+    {
+        return false;
+    }
+
+    QDomNode parent = element.parentNode();
+    while (not parent.isNull())
+    {
+        if (parent.isDocument())
         {
-            if (this->find(n.toElement(), id))
-            {
-                return true;
-            }
+            return parent == *this;
         }
+        parent = parent.parentNode();
     }
     return false;
 }
@@ -606,30 +899,26 @@ QString VDomDocument::UniqueTagText(const QString &tagName, const QString &defVa
  */
 void VDomDocument::TestUniqueId() const
 {
-    QVector<quint32> vector;
-    CollectId(documentElement(), vector);
+    QSet<quint32> ids;
+    CollectId(documentElement(), ids);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VDomDocument::CollectId(const QDomElement &node, QVector<quint32> &vector) const
+void VDomDocument::CollectId(const QDomElement &node, QSet<quint32> &ids) const
 {
     if (node.hasAttribute(VDomDocument::AttrId))
     {
         const quint32 id = getParameterId(node);
-        if (vector.contains(id))
+        if (ids.contains(id))
         {
             throw VExceptionWrongId(tr("This id is not unique."), node);
         }
-        vector.append(id);
+        ids.insert(id);
     }
 
-    for (qint32 i=0; i<node.childNodes().length(); ++i)
+    for (QDomElement child = node.firstChildElement(); not child.isNull(); child = child.nextSiblingElement())
     {
-        const QDomNode n = node.childNodes().at(i);
-        if (n.isElement())
-        {
-            CollectId(n.toElement(), vector);
-        }
+        CollectId(child, ids);
     }
 }
 
@@ -641,7 +930,6 @@ void VDomDocument::CollectId(const QDomElement &node, QVector<quint32> &vector)
  */
 void VDomDocument::ValidateXML(const QString &schema, const QString &fileName)
 {
-    qCDebug(vXML, "Validation xml file %s.", qUtf8Printable(fileName));
     QFile pattern(fileName);
     // cppcheck-suppress ConfigurationNotChecked
     if (pattern.open(QIODevice::ReadOnly) == false)
@@ -650,53 +938,63 @@ void VDomDocument::ValidateXML(const QString &schema, const QString &fileName)
         throw VException(errorMsg);
     }
 
-    QFile fileSchema(schema);
+    ValidateXML(schema, &pattern, fileName);
+    pattern.close();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ValidateXML validate xml content by xsd schema. Content validated before by the same schema is accepted
+ * without validation if validation stamps are enabled.
+ * @param schema path to schema file.
+ * @param xml device with xml content, will be opened for reading if closed.
+ * @param fileName name of xml file for messages.
+ */
+void VDomDocument::ValidateXML(const QString &schema, QIODevice *xml, const QString &fileName)
+{
+    SCASSERT(xml != nullptr)
+    qCDebug(vXML, "Validation xml file %s.", qUtf8Printable(fileName));
     // cppcheck-suppress ConfigurationNotChecked
-    if (fileSchema.open(QIODevice::ReadOnly) == false)
+    if (not xml->isOpen() && xml->open(QIODevice::ReadOnly) == false)
     {
-        pattern.close();
-        const QString errorMsg(tr("Can't open schema file %1:\n%2.").arg(schema).arg(fileSchema.errorString()));
+        const QString errorMsg(tr("Can't open file %1:\n%2.").arg(fileName).arg(xml->errorString()));
         throw VException(errorMsg);
     }
+    const QByteArray content = xml->readAll();
 
-    MessageHandler messageHandler;
-    QXmlSchema sch;
-    sch.setMessageHandler(&messageHandler);
-    if (sch.load(&fileSchema, QUrl::fromLocalFile(fileSchema.fileName()))==false)
+    ValidationCache *cache = ValidationCache::Instance();
+    const QByteArray stamp = QCryptographicHash::hash(cache->SchemaHash(schema) + content,
+                                                      QCryptographicHash::Sha256).toHex();
+    if (cache->IsStamped(stamp))
     {
-        pattern.close();
-        fileSchema.close();
-        VException e(messageHandler.statusMessage());
-        e.AddMoreInformation(tr("Could not load schema file '%1'.").arg(fileSchema.fileName()));
-        throw e;
+        qCDebug(vXML, "Content was validated before.");
+        return;
     }
-    qCDebug(vXML, "Schema loaded.");
 
-    bool errorOccurred = false;
-    if (sch.isValid() == false)
-    {
-        errorOccurred = true;
-    }
-    else
-    {
-        QXmlSchemaValidator validator(sch);
-        if (validator.validate(&pattern, QUrl::fromLocalFile(pattern.fileName())) == false)
-        {
-            errorOccurred = true;
-        }
-    }
-
-    if (errorOccurred)
+    const QXmlSchema sch = cache->Schema(schema);
+    MessageHandler messageHandler;
+    QXmlSchemaValidator validator(sch);
+    validator.setMessageHandler(&messageHandler);
+    if (validator.validate(content, QUrl::fromLocalFile(fileName)) == false)
     {
-        pattern.close();
-        fileSchema.close();
         VException e(messageHandler.statusMessage());
         e.AddMoreInformation(tr("Validation error file %3 in line %1 column %2").arg(messageHandler.line())
                              .arg(messageHandler.column()).arg(fileName));
         throw e;
     }
-    pattern.close();
-    fileSchema.close();
+
+    cache->AddStamp(stamp);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetValidationStampsFile keep stamps of validated content in the file. Content with a stamp is not validated
+ * again, also by other processes using the same file.
+ * @param fileName path to stamps file, empty string disables stamps.
+ */
+void VDomDocument::SetValidationStampsFile(const QString &fileName)
+{
+    ValidationCache::Instance()->SetStampsFile(fileName);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -721,6 +1019,62 @@ void VDomDocument::setXMLContent(const QString &fileName)
                              .arg(fileName));
         throw e;
     }
+
+    RefreshElementIdCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief setXMLContentSkipping load file without elements with listed tags.
+ *
+ * The file is read with QXmlStreamReader, skipped elements never reach the tree. Used when big parts of a file are
+ * handled in a streaming pass (see ReadElement) and only the rest should stay in memory.
+ * @param fileName file to load.
+ * @param skippedTags tags of elements to leave out together with their content.
+ */
+void VDomDocument::setXMLContentSkipping(const QString &fileName, const QStringList &skippedTags)
+{
+    QFile file(fileName);
+    // cppcheck-suppress ConfigurationNotChecked
+    if (file.open(QIODevice::ReadOnly) == false)
+    {
+        const QString errorMsg(tr("Can't open file %1:\n%2.").arg(fileName).arg(file.errorString()));
+        throw VException(errorMsg);
+    }
+
+    clear();
+    map.clear();
+
+    QXmlStreamReader reader(&file);
+    ReadStreamChildren(reader, *this, *this, skippedTags);
+
+    if (reader.hasError() || documentElement().isNull())
+    {
+        VException e(reader.hasError() ? reader.errorString() : tr("Empty document."));
+        e.AddMoreInformation(tr("Parsing error file %3 in line %1 column %2").arg(reader.lineNumber())
+                             .arg(reader.columnNumber()).arg(fileName));
+        throw e;
+    }
+
+    RefreshElementIdCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadElement read current element of a stream with all its content.
+ *
+ * The element is created by the document, but isn't inserted anywhere and is freed with the last reference to it.
+ * @param reader stream positioned at the start of element. On return it is positioned at the end of element.
+ * @param doc document that owns the element.
+ * @return read element.
+ */
+QDomElement VDomDocument::ReadElement(QXmlStreamReader &reader, QDomDocument &doc)
+{
+    SCASSERT(reader.isStartElement())
+
+    QDomElement element = CreateStreamElement(reader, doc);
+    ReadStreamChildren(reader, doc, element, QStringList());
+    return element;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
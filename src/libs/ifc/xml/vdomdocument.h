@@ -58,8 +58,10 @@
 #include <QDomNode>
 #include <QHash>
 #include <QLatin1String>
+#include <QSet>
 #include <QStaticStringData>
 #include <QString>
+#include <QStringList>
 #include <QStringData>
 #include <QStringDataPtr>
 #include <QtGlobal>
@@ -72,6 +74,8 @@
 
 class QDomElement;
 class QDomNode;
+class QIODevice;
+class QXmlStreamReader;
 template <typename T> class QVector;
 
 Q_DECLARE_LOGGING_CATEGORY(vXML)
@@ -138,7 +142,11 @@ class VDomDocument : public QDomDocument
     Unit           measurementUnits() const;
 
     static void    ValidateXML(const QString &schema, const QString &fileName);
+    static void    ValidateXML(const QString &schema, QIODevice *xml, const QString &fileName);
+    static void    SetValidationStampsFile(const QString &fileName);
     virtual void   setXMLContent(const QString &fileName);
+    void           setXMLContentSkipping(const QString &fileName, const QStringList &skippedTags);
+    static QDomElement ReadElement(QXmlStreamReader &reader, QDomDocument &doc);
     static QString UnitsHelpString();
 
     virtual bool   SaveDocument(const QString &fileName, QString &error);
@@ -162,14 +170,16 @@ class VDomDocument : public QDomDocument
     QString        UniqueTagText(const QString &tagName, const QString &defVal = QString()) const;
 
     void           TestUniqueId() const;
-    void           CollectId(const QDomElement &node, QVector<quint32> &vector)const;
+    void           CollectId(const QDomElement &node, QSet<quint32> &ids)const;
 
 private:
     Q_DISABLE_COPY(VDomDocument)
     /** @brief Map used for finding element by id. */
     QHash<quint32, QDomElement> map;
 
-    bool           find(const QDomElement &node, quint32 id);
+    void           RefreshElementIdCache();
+    void           IndexElement(const QDomElement &node);
+    bool           IsIndexedElement(const QDomElement &element, quint32 id) const;
 
     bool SaveCanonicalXML(QIODevice *file, int indent, QString &error) const;
 };
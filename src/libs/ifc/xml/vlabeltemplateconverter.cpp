@@ -128,5 +128,4 @@ void VLabelTemplateConverter::applyPatches()
 void VLabelTemplateConverter::downgradeToCurrentMaxVersion()
 {
     setVersion(LabelTemplateMaxVerStr);
-    Save();
 }
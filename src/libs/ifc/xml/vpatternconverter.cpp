@@ -358,171 +358,171 @@ void VPatternConverter::applyPatches()
     {
         case (0x000100):
             toVersion0_1_1();
-            ValidateXML(getSchema(0x000101), m_convertedFileName);
+            ValidateStep(0x000101);
             V_FALLTHROUGH
         case (0x000101):
             toVersion0_1_2();
-            ValidateXML(getSchema(0x000102), m_convertedFileName);
+            ValidateStep(0x000102);
             V_FALLTHROUGH
         case (0x000102):
             toVersion0_1_3();
-            ValidateXML(getSchema(0x000103), m_convertedFileName);
+            ValidateStep(0x000103);
             V_FALLTHROUGH
         case (0x000103):
             toVersion0_1_4();
-            ValidateXML(getSchema(0x000104), m_convertedFileName);
+            ValidateStep(0x000104);
             V_FALLTHROUGH
         case (0x000104):
             toVersion0_2_0();
-            ValidateXML(getSchema(0x000200), m_convertedFileName);
+            ValidateStep(0x000200);
             V_FALLTHROUGH
         case (0x000200):
             toVersion0_2_1();
-            ValidateXML(getSchema(0x000201), m_convertedFileName);
+            ValidateStep(0x000201);
             V_FALLTHROUGH
         case (0x000201):
             toVersion0_2_2();
-            ValidateXML(getSchema(0x000202), m_convertedFileName);
+            ValidateStep(0x000202);
             V_FALLTHROUGH
         case (0x000202):
             toVersion0_2_3();
-            ValidateXML(getSchema(0x000203), m_convertedFileName);
+            ValidateStep(0x000203);
             V_FALLTHROUGH
         case (0x000203):
             toVersion0_2_4();
-            ValidateXML(getSchema(0x000204), m_convertedFileName);
+            ValidateStep(0x000204);
             V_FALLTHROUGH
         case (0x000204):
             toVersion0_2_5();
-            ValidateXML(getSchema(0x000205), m_convertedFileName);
+            ValidateStep(0x000205);
             V_FALLTHROUGH
         case (0x000205):
             toVersion0_2_6();
-            ValidateXML(getSchema(0x000206), m_convertedFileName);
+            ValidateStep(0x000206);
             V_FALLTHROUGH
         case (0x000206):
             toVersion0_2_7();
-            ValidateXML(getSchema(0x000207), m_convertedFileName);
+            ValidateStep(0x000207);
             V_FALLTHROUGH
         case (0x000207):
             toVersion0_3_0();
-            ValidateXML(getSchema(0x000300), m_convertedFileName);
+            ValidateStep(0x000300);
             V_FALLTHROUGH
         case (0x000300):
             toVersion0_3_1();
-            ValidateXML(getSchema(0x000301), m_convertedFileName);
+            ValidateStep(0x000301);
             V_FALLTHROUGH
         case (0x000301):
             toVersion0_3_2();
-            ValidateXML(getSchema(0x000302), m_convertedFileName);
+            ValidateStep(0x000302);
             V_FALLTHROUGH
         case (0x000302):
             toVersion0_3_3();
-            ValidateXML(getSchema(0x000303), m_convertedFileName);
+            ValidateStep(0x000303);
             V_FALLTHROUGH
         case (0x000303):
             toVersion0_3_4();
-            ValidateXML(getSchema(0x000304), m_convertedFileName);
+            ValidateStep(0x000304);
             V_FALLTHROUGH
         case (0x000304):
             toVersion0_3_5();
-            ValidateXML(getSchema(0x000305), m_convertedFileName);
+            ValidateStep(0x000305);
             V_FALLTHROUGH
         case (0x000305):
             toVersion0_3_6();
-            ValidateXML(getSchema(0x000306), m_convertedFileName);
+            ValidateStep(0x000306);
             V_FALLTHROUGH
         case (0x000306):
             toVersion0_3_7();
-            ValidateXML(getSchema(0x000307), m_convertedFileName);
+            ValidateStep(0x000307);
             V_FALLTHROUGH
         case (0x000307):
             toVersion0_3_8();
-            ValidateXML(getSchema(0x000308), m_convertedFileName);
+            ValidateStep(0x000308);
             V_FALLTHROUGH
         case (0x000308):
             toVersion0_3_9();
-            ValidateXML(getSchema(0x000309), m_convertedFileName);
+            ValidateStep(0x000309);
             V_FALLTHROUGH
         case (0x000309):
             toVersion0_4_0();
-            ValidateXML(getSchema(0x000400), m_convertedFileName);
+            ValidateStep(0x000400);
             V_FALLTHROUGH
         case (0x000400):
             toVersion0_4_1();
-            ValidateXML(getSchema(0x000401), m_convertedFileName);
+            ValidateStep(0x000401);
             V_FALLTHROUGH
         case (0x000401):
             toVersion0_4_2();
-            ValidateXML(getSchema(0x000402), m_convertedFileName);
+            ValidateStep(0x000402);
             V_FALLTHROUGH
         case (0x000402):
             toVersion0_4_3();
-            ValidateXML(getSchema(0x000403), m_convertedFileName);
+            ValidateStep(0x000403);
             V_FALLTHROUGH
         case (0x000403):
             toVersion0_4_4();
-            ValidateXML(getSchema(0x000404), m_convertedFileName);
+            ValidateStep(0x000404);
             V_FALLTHROUGH
         case (0x000404):
             toVersion0_4_5();
-            ValidateXML(getSchema(0x000405), m_convertedFileName);
+            ValidateStep(0x000405);
             V_FALLTHROUGH
         case (0x000405):
             toVersion0_4_6();
-            ValidateXML(getSchema(0x000406), m_convertedFileName);
+            ValidateStep(0x000406);
             V_FALLTHROUGH
         case (0x000406):
             toVersion0_4_7();
-            ValidateXML(getSchema(0x000407), m_convertedFileName);
+            ValidateStep(0x000407);
             V_FALLTHROUGH
         case (0x000407):
             toVersion0_4_8();
-            ValidateXML(getSchema(0x000408), m_convertedFileName);
+            ValidateStep(0x000408);
             V_FALLTHROUGH
         case (0x000408):
             toVersion0_5_0();
-            ValidateXML(getSchema(0x000500), m_convertedFileName);
+            ValidateStep(0x000500);
             V_FALLTHROUGH
         case (0x000500):
             toVersion0_5_1();
-            ValidateXML(getSchema(0x000501), m_convertedFileName);
+            ValidateStep(0x000501);
             V_FALLTHROUGH
         case (0x000501):
             toVersion0_6_0();
-            ValidateXML(getSchema(0x000600), m_convertedFileName);
+            ValidateStep(0x000600);
             V_FALLTHROUGH
         case (0x000600):
             toVersion0_6_1();
-            ValidateXML(getSchema(0x000601), m_convertedFileName);
+            ValidateStep(0x000601);
             V_FALLTHROUGH
         case (0x000601):
             toVersion0_6_2();
-            ValidateXML(getSchema(0x000602), m_convertedFileName);
+            ValidateStep(0x000602);
             V_FALLTHROUGH
         case (0x000602):
             toVersion0_6_3();
-            ValidateXML(getSchema(0x000603), m_convertedFileName);
+            ValidateStep(0x000603);
             V_FALLTHROUGH
         case (0x000603):
             toVersion0_6_4();
-            ValidateXML(getSchema(0x000604), m_convertedFileName);
+            ValidateStep(0x000604);
             V_FALLTHROUGH
         case (0x000604):
             toVersion0_6_5();
-            ValidateXML(getSchema(0x000605), m_convertedFileName);
+            ValidateStep(0x000605);
             V_FALLTHROUGH
         case (0x000605):
             toVersion0_6_6();
-            ValidateXML(getSchema(0x000606), m_convertedFileName);
+            ValidateStep(0x000606);
             V_FALLTHROUGH
         case (0x000606):
             toVersion0_6_7();
-            ValidateXML(getSchema(0x000607), m_convertedFileName);
+            ValidateStep(0x000607);
             V_FALLTHROUGH
         case (0x000607):
             toVersion0_6_8();
-            ValidateXML(getSchema(0x000608), m_convertedFileName);
+            ValidateStep(0x000608);
             V_FALLTHROUGH
         case (0x000608):
             break;
@@ -536,7 +536,6 @@ void VPatternConverter::applyPatches()
 void VPatternConverter::downgradeToCurrentMaxVersion()
 {
     setVersion(PatternMaxVerStr);
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -568,7 +567,6 @@ void VPatternConverter::toVersion0_1_1()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.1.1"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -579,7 +577,6 @@ void VPatternConverter::toVersion0_1_2()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.1.2"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -590,7 +587,6 @@ void VPatternConverter::toVersion0_1_3()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.1.3"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -601,7 +597,6 @@ void VPatternConverter::toVersion0_1_4()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.1.4"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -616,7 +611,6 @@ void VPatternConverter::toVersion0_2_0()
     TagIncrementToV0_2_0();
     ConvertMeasurementsToV0_2_0();
     TagMeasurementsToV0_2_0();//Alwayse last!!!
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -628,7 +622,6 @@ void VPatternConverter::toVersion0_2_1()
 
     setVersion(QStringLiteral("0.2.1"));
     ConvertMeasurementsToV0_2_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -639,7 +632,6 @@ void VPatternConverter::toVersion0_2_2()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.2.2"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -650,7 +642,6 @@ void VPatternConverter::toVersion0_2_3()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.2.3"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -662,7 +653,6 @@ void VPatternConverter::toVersion0_2_4()
 
     FixToolUnionToV0_2_4();
     setVersion(QStringLiteral("0.2.4"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -673,7 +663,6 @@ void VPatternConverter::toVersion0_2_5()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.2.5"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -684,7 +673,6 @@ void VPatternConverter::toVersion0_2_6()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.2.6"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -695,7 +683,6 @@ void VPatternConverter::toVersion0_2_7()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.2.7"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -709,7 +696,6 @@ void VPatternConverter::toVersion0_3_0()
     FixCutPoint();
     FixCutPoint();
     setVersion(QStringLiteral("0.3.0"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -721,7 +707,6 @@ void VPatternConverter::toVersion0_3_1()
 
     setVersion(QStringLiteral("0.3.1"));
     RemoveColorToolCutV0_3_1();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -732,7 +717,6 @@ void VPatternConverter::toVersion0_3_2()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.3.2"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -743,7 +727,6 @@ void VPatternConverter::toVersion0_3_3()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.3.3"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -754,7 +737,6 @@ void VPatternConverter::toVersion0_3_4()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.3.4"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -765,7 +747,6 @@ void VPatternConverter::toVersion0_3_5()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.3.5"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -776,7 +757,6 @@ void VPatternConverter::toVersion0_3_6()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.3.6"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -787,7 +767,6 @@ void VPatternConverter::toVersion0_3_7()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.3.7"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -798,7 +777,6 @@ void VPatternConverter::toVersion0_3_8()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.3.8"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -809,7 +787,6 @@ void VPatternConverter::toVersion0_3_9()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.3.9"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -823,7 +800,6 @@ void VPatternConverter::toVersion0_4_0()
     TagRemoveAttributeTypeObjectInV0_4_0();
     TagDetailToV0_4_0();
     TagUnionDetailsToV0_4_0();
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -834,7 +810,6 @@ void VPatternConverter::toVersion0_4_1()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.4.1"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -845,7 +820,6 @@ void VPatternConverter::toVersion0_4_2()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.4.2"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -856,7 +830,6 @@ void VPatternConverter::toVersion0_4_3()
                       "Time to refactor the code.");
 
     setVersion(QStringLiteral("0.4.3"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -869,7 +842,6 @@ void VPatternConverter::toVersion0_4_4()
     setVersion(QStringLiteral("0.4.4"));
     LabelTagToV0_4_4(strData);
     LabelTagToV0_4_4(strPatternInfo);
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -879,7 +851,6 @@ void VPatternConverter::toVersion0_4_5()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 4, 5),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.4.5"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -889,7 +860,6 @@ void VPatternConverter::toVersion0_4_6()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 4, 6),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.4.6"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -899,7 +869,6 @@ void VPatternConverter::toVersion0_4_7()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 4, 7),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.4.7"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -909,7 +878,6 @@ void VPatternConverter::toVersion0_4_8()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 4, 8),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.4.8"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -919,7 +887,6 @@ void VPatternConverter::toVersion0_5_0()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 5, 0),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.5.0"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -929,7 +896,6 @@ void VPatternConverter::toVersion0_5_1()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 5, 1),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.5.1"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -943,7 +909,6 @@ void VPatternConverter::toVersion0_6_0()
     PortPatternLabeltoV0_6_0(label);
     PortPieceLabelstoV0_6_0();
     RemoveUnusedTagsV0_6_0();
-    Save();
 }
 
 
@@ -1080,7 +1045,6 @@ void VPatternConverter::toVersion0_6_1()
             }
         }
     }
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1090,7 +1054,6 @@ void VPatternConverter::toVersion0_6_2()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 6, 2),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.6.2"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1100,7 +1063,6 @@ void VPatternConverter::toVersion0_6_3()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 6, 3),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.6.3"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1129,7 +1091,6 @@ void VPatternConverter::toVersion0_6_4()
             }
         }
     }
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1243,7 +1204,6 @@ void VPatternConverter::toVersion0_6_5()
             }
         }
     }
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1312,7 +1272,6 @@ void VPatternConverter::toVersion0_6_6()
             element.setTagName(QStringLiteral("unionPiece"));
         }
     }
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1322,7 +1281,6 @@ void VPatternConverter::toVersion0_6_7()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 6, 7),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.6.7"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1332,7 +1290,6 @@ void VPatternConverter::toVersion0_6_8()
     Q_STATIC_ASSERT_X(VPatternConverter::PatternMinVer < CONVERTER_VERSION_CHECK(0, 6, 8),
                       "Time to refactor the code.");
     setVersion(QStringLiteral("0.6.8"));
-    Save();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
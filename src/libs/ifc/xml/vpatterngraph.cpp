@@ -0,0 +1,242 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "vpatterngraph.h"
+#include "../ifcdef.h"
+
+#include <algorithm>
+
+//---------------------------------------------------------------------------------------------------------------------
+VPatternGraph::VPatternGraph()
+    : vertices()
+    , order()
+    , blocks()
+    , children()
+    , parents()
+    , incomplete()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPatternGraph::Clear()
+{
+    vertices.clear();
+    order.clear();
+    blocks.clear();
+    children.clear();
+    parents.clear();
+    variableUsers.clear();
+    usedVariables.clear();
+    incomplete.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VPatternGraph::IsEmpty() const
+{
+    return order.isEmpty();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddVertex add pattern element. Elements must be added in parse order.
+ * @param id element id.
+ * @param draftBlock name of draft block the element belongs to.
+ */
+void VPatternGraph::AddVertex(quint32 id, const QString &draftBlock)
+{
+    if (id == NULL_ID || vertices.contains(id))
+    {
+        return;
+    }
+
+    vertices.insert(id, order.size());
+    order.append(id);
+    blocks.insert(id, draftBlock);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddEdge add dependency of element on object.
+ * @param objectId id of used object.
+ * @param child id of element that uses the object.
+ */
+void VPatternGraph::AddEdge(quint32 objectId, quint32 child)
+{
+    const quint32 parent = Owner(objectId);
+    if (parent == NULL_ID || parent == child || not vertices.contains(child))
+    {
+        return;
+    }
+
+    children[parent].insert(child);
+    parents[child].insert(parent);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RemoveEdgesTo forget dependencies of element. Use before adding edges of an edited element again.
+ * @param child element id.
+ */
+void VPatternGraph::RemoveEdgesTo(quint32 child)
+{
+    const QSet<quint32> dependencies = parents.take(child);
+    for (auto i = dependencies.constBegin(); i != dependencies.constEnd(); ++i)
+    {
+        auto edges = children.find(*i);
+        if (edges != children.end())
+        {
+            edges->remove(child);
+        }
+    }
+
+    const QSet<QString> variables = usedVariables.take(child);
+    for (auto i = variables.constBegin(); i != variables.constEnd(); ++i)
+    {
+        auto users = variableUsers.find(*i);
+        if (users != variableUsers.end())
+        {
+            users->remove(child);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddVariableUse add dependency of element on custom variable.
+ * @param name variable name.
+ * @param child id of element whose formula uses the variable.
+ */
+void VPatternGraph::AddVariableUse(const QString &name, quint32 child)
+{
+    if (not vertices.contains(child))
+    {
+        return;
+    }
+
+    variableUsers[name].insert(child);
+    usedVariables[child].insert(name);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Owner return id of element that created object.
+ * @param objectId object id.
+ * @return element id or NULL_ID if object is unknown.
+ */
+quint32 VPatternGraph::Owner(quint32 objectId) const
+{
+    if (objectId == NULL_ID)
+    {
+        return NULL_ID;
+    }
+
+    auto i = vertices.upperBound(objectId);
+    if (i == vertices.constBegin())
+    {
+        return NULL_ID;
+    }
+    --i;
+    return i.key();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VPatternGraph::DraftBlock(quint32 id) const
+{
+    return blocks.value(id);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPatternGraph::SetIncomplete(const QString &draftBlock)
+{
+    incomplete.insert(draftBlock);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VPatternGraph::IsComplete(const QString &draftBlock) const
+{
+    return not incomplete.contains(draftBlock);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Dependents return element that owns object and all elements that depend on it directly or indirectly.
+ * @param id object id.
+ * @return element ids in parse order, so each element follows everything it depends on. Empty if object is unknown.
+ */
+QVector<quint32> VPatternGraph::Dependents(quint32 id) const
+{
+    const quint32 owner = Owner(id);
+    if (owner == NULL_ID)
+    {
+        return QVector<quint32>();
+    }
+
+    QSet<quint32> visited;
+    visited.insert(owner);
+
+    QVector<quint32> stack;
+    stack.append(owner);
+    while (not stack.isEmpty())
+    {
+        const quint32 current = stack.takeLast();
+        const QSet<quint32> next = children.value(current);
+        for (auto i = next.constBegin(); i != next.constEnd(); ++i)
+        {
+            if (not visited.contains(*i))
+            {
+                visited.insert(*i);
+                stack.append(*i);
+            }
+        }
+    }
+
+    QVector<quint32> dependents;
+    dependents.reserve(visited.size());
+    for (auto i = visited.constBegin(); i != visited.constEnd(); ++i)
+    {
+        dependents.append(*i);
+    }
+
+    std::sort(dependents.begin(), dependents.end(), [this](quint32 a, quint32 b)
+    {
+        return vertices.value(a) < vertices.value(b);
+    });
+    return dependents;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VariableUsers return elements whose formulas use custom variable directly.
+ * @param name variable name.
+ * @return element ids in parse order.
+ */
+QVector<quint32> VPatternGraph::VariableUsers(const QString &name) const
+{
+    const QSet<quint32> users = variableUsers.value(name);
+
+    QMap<int, quint32> sorted;
+    for (auto i = users.constBegin(); i != users.constEnd(); ++i)
+    {
+        sorted.insert(vertices.value(*i), *i);
+    }
+    return sorted.values().toVector();
+}
@@ -0,0 +1,89 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#ifndef VPATTERNGRAPH_H
+#define VPATTERNGRAPH_H
+
+#include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VPatternGraph class dependency graph of pattern objects.
+ *
+ * Vertices are pattern elements (tools, nodes, pieces) in parse order. An edge goes from an element to every element
+ * that uses one of its objects or a variable calculated from them. Objects created by a tool get ids right after the
+ * tool's id, so an object belongs to the vertex with the greatest id not bigger than the object id.
+ */
+class VPatternGraph
+{
+public:
+    VPatternGraph();
+
+    void             Clear();
+    bool             IsEmpty() const;
+
+    void             AddVertex(quint32 id, const QString &draftBlock);
+    void             AddEdge(quint32 objectId, quint32 child);
+    void             RemoveEdgesTo(quint32 child);
+    void             AddVariableUse(const QString &name, quint32 child);
+
+    quint32          Owner(quint32 objectId) const;
+    QString          DraftBlock(quint32 id) const;
+
+    void             SetIncomplete(const QString &draftBlock);
+    bool             IsComplete(const QString &draftBlock) const;
+
+    QVector<quint32> Dependents(quint32 id) const;
+    QVector<quint32> VariableUsers(const QString &name) const;
+
+private:
+    /** @brief vertices vertex id and its position in parse order. */
+    QMap<quint32, int>            vertices;
+
+    /** @brief order vertex ids in parse order. */
+    QVector<quint32>              order;
+
+    /** @brief blocks draft block name of each vertex. */
+    QHash<quint32, QString>       blocks;
+
+    /** @brief children direct dependents of each vertex. */
+    QHash<quint32, QSet<quint32>> children;
+
+    /** @brief parents direct dependencies of each vertex. */
+    QHash<quint32, QSet<quint32>> parents;
+
+    /** @brief variableUsers elements whose formulas use each custom variable. */
+    QHash<QString, QSet<quint32>> variableUsers;
+
+    /** @brief usedVariables custom variables used in formulas of each element. */
+    QHash<quint32, QSet<QString>> usedVariables;
+
+    /** @brief incomplete draft blocks with dependencies the graph can't describe (e.g. union tool). */
+    QSet<QString>                 incomplete;
+};
+
+#endif // VPATTERNGRAPH_H
@@ -9,6 +9,7 @@ HEADERS += \
     $$PWD/vpatternconverter.h \
     $$PWD/vtoolrecord.h \
     $$PWD/vabstractpattern.h \
+    $$PWD/vpatterngraph.h \
     $$PWD//abstract_m_converter.h \
     $$PWD/vlabeltemplateconverter.h
 
@@ -20,5 +21,6 @@ SOURCES += \
     $$PWD/vpatternconverter.cpp \
     $$PWD/vtoolrecord.cpp \
     $$PWD/vabstractpattern.cpp \
+    $$PWD/vpatterngraph.cpp \
     $$PWD//abstract_m_converter.cpp \
     $$PWD/vlabeltemplateconverter.cpp
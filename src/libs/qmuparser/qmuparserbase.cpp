@@ -257,6 +257,101 @@ void QmuParserBase::OnDetectVar(const QString &pExpr, int &nStart, int &nEnd)
     Q_UNUSED(nEnd)
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Save parsed expression for reuse by other parser objects.
+ *
+ * Must be called after successful evaluation.
+ * @param a_Compiled [out] parsed expression.
+ * @return false if the expression can't be reused.
+ */
+bool QmuParserBase::SaveCompiled(QmuParserCompiled &a_Compiled) const
+{
+    if (m_pParseFormula != &QmuParserBase::ParseCmdCode || not m_vRPN.IsRelocatable())
+    {
+        return false;
+    }
+
+    const QVector<qreal *> ptrs = m_vRPN.GetVarPtrs();
+
+    QMap<qreal *, QString> names;
+    for (varmap_type::const_iterator it = m_VarDef.begin(); it != m_VarDef.end(); ++it)
+    {
+        if (ptrs.contains(it->second))
+        {
+            if (names.contains(it->second))
+            {
+                return false; // Several variables share the same value, can't tell them apart.
+            }
+            names.insert(it->second, it->first);
+        }
+    }
+
+    QVector<QString> vars;
+    vars.reserve(ptrs.size());
+    for (int i = 0; i < ptrs.size(); ++i)
+    {
+        if (ptrs.at(i) == nullptr)
+        {
+            vars.append(QString());
+        }
+        else if (names.contains(ptrs.at(i)))
+        {
+            vars.append(names.value(ptrs.at(i)));
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    a_Compiled.expr = m_pTokenReader->GetExpr();
+    a_Compiled.byteCode = m_vRPN;
+    a_Compiled.vars = vars;
+    a_Compiled.finalResultIdx = m_nFinalResultIdx;
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Load expression parsed by other parser object and bind it to variables of this parser.
+ *
+ * After this Eval() uses the bytecode directly without parsing the expression string.
+ * @param a_Compiled parsed expression.
+ * @return false if some variable is not defined in this parser. Parser stays in string parsing mode.
+ */
+bool QmuParserBase::LoadCompiled(const QmuParserCompiled &a_Compiled)
+{
+    QVector<qreal *> ptrs;
+    ptrs.reserve(a_Compiled.vars.size());
+    for (int i = 0; i < a_Compiled.vars.size(); ++i)
+    {
+        const QString &name = a_Compiled.vars.at(i);
+        if (name.isEmpty())
+        {
+            ptrs.append(nullptr);
+            continue;
+        }
+
+        const varmap_type::const_iterator item = m_VarDef.find(name);
+        if (item == m_VarDef.end())
+        {
+            return false;
+        }
+        ptrs.append(item->second);
+    }
+
+    m_pTokenReader->SetFormula(a_Compiled.expr);
+    ReInit();
+
+    m_vRPN = a_Compiled.byteCode;
+    m_vRPN.SetVarPtrs(ptrs);
+    m_nFinalResultIdx = a_Compiled.finalResultIdx;
+    m_vStackBuffer.resize(m_vRPN.GetMaxStackSize() * s_MaxNumOpenMPThreads);
+    m_pParseFormula = &QmuParserBase::ParseCmdCode;
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void QmuParserBase::setAllowSubexpressions(bool value)
 {
@@ -51,6 +51,23 @@ namespace qmu
  * @brief This file contains the class definition of the qmuparser engine.
  */
 
+/**
+ * @brief Parsed expression that can be reused by other parser objects.
+ *
+ * Variables are kept by name, a parser binds them to own variables when loads the expression.
+ */
+struct QmuParserCompiled
+{
+    QmuParserCompiled()
+        : expr(), byteCode(), vars(), finalResultIdx(0)
+    {}
+
+    QString           expr;
+    QmuParserByteCode byteCode;
+    QVector<QString>  vars;           ///< Names of variables in bytecode order.
+    int               finalResultIdx;
+};
+
 /**
  * @brief Mathematical expressions parser (base parser engine).
  * @author (C) 2013 Ingo Berg
@@ -145,6 +162,8 @@ class QmuParserBase
     virtual void InitConst() = 0;
     virtual void InitOprt() = 0;
     virtual void OnDetectVar(const QString &pExpr, int &nStart, int &nEnd);
+    bool SaveCompiled(QmuParserCompiled &a_Compiled) const;
+    bool LoadCompiled(const QmuParserCompiled &a_Compiled);
     /**
      * @brief A facet class used to change decimal and thousands separator.
      */
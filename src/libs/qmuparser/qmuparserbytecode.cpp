@@ -678,4 +678,66 @@ void QmuParserByteCode::AsciiDump()
 
     qInfo() << "END";
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Check if the bytecode can be bound to other variables.
+ *
+ * String functions keep indexes into the string buffer of the parser and assignments write to the variable, bytecode
+ * with such tokens is valid only for the parser that created it.
+ */
+bool QmuParserByteCode::IsRelocatable() const
+{
+    for (int i = 0; i < m_vRPN.size(); ++i)
+    {
+        const ECmdCode cmd = m_vRPN.at(i).Cmd;
+        if (cmd == cmFUNC_STR || cmd == cmSTRING || cmd == cmASSIGN || cmd == cmFUNC_BULK)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Return variable pointers of all variable tokens in bytecode order.
+ */
+QVector<qreal *> QmuParserByteCode::GetVarPtrs() const
+{
+    QVector<qreal *> vars;
+    for (int i = 0; i < m_vRPN.size(); ++i)
+    {
+        if (IsVarToken(m_vRPN.at(i).Cmd))
+        {
+            vars.append(m_vRPN.at(i).Val.ptr);
+        }
+    }
+    return vars;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Replace variable pointers of all variable tokens.
+ * @param a_vVars new pointers in the order returned by GetVarPtrs().
+ */
+void QmuParserByteCode::SetVarPtrs(const QVector<qreal *> &a_vVars)
+{
+    int var = 0;
+    for (int i = 0; i < m_vRPN.size(); ++i)
+    {
+        if (IsVarToken(m_vRPN.at(i).Cmd))
+        {
+            Q_ASSERT(var < a_vVars.size());
+            m_vRPN[i].Val.ptr = a_vVars.at(var++);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool QmuParserByteCode::IsVarToken(ECmdCode a_Cmd)
+{
+    return a_Cmd == cmVAR || a_Cmd == cmVARPOW2 || a_Cmd == cmVARPOW3 || a_Cmd == cmVARPOW4 || a_Cmd == cmVARMUL;
+}
+
 } // namespace qmu
@@ -105,6 +105,9 @@ class QmuParserByteCode
     int           GetSize() const;
     const SToken* GetBase() const;
     void          AsciiDump();
+    bool          IsRelocatable() const;
+    QVector<qreal*> GetVarPtrs() const;
+    void          SetVarPtrs(const QVector<qreal*> &a_vVars);
 private:
     /** @brief Token type for internal use only. */
     typedef QmuParserToken<qreal, string_type> token_type;
@@ -124,6 +127,7 @@ class QmuParserByteCode
     bool     m_bEnableOptimizer;
 
     void ConstantFolding(ECmdCode a_Oprt);
+    static bool IsVarToken(ECmdCode a_Cmd);
 };
 
 //---------------------------------------------------------------------------------------------------------------------
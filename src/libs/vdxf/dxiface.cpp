@@ -22,7 +22,8 @@
 dx_iface::dx_iface(const std::string &file, DRW::Version v, VarMeasurement varMeasurement, VarInsunits varInsunits)
     : dxfW(new dxfRW(file.c_str())),
       cData(),
-      version(v)
+      version(v),
+      streaming(false)
 {
     InitHeader(varMeasurement, varInsunits);
     InitTextstyles();
@@ -40,6 +41,24 @@ bool dx_iface::fileExport(bool binary)
     return success;
 }
 
+bool dx_iface::BeginStreaming(bool binary)
+{
+    streaming = dxfW->beginWrite(this, version, binary);
+    return streaming;
+}
+
+bool dx_iface::EndStreaming()
+{
+    if (not streaming)
+    {
+        return false;
+    }
+
+    writeEntities(); // entities added with AddEntity() while streaming
+    streaming = false;
+    return dxfW->endWrite();
+}
+
 void dx_iface::writeEntity(DRW_Entity* e){
     switch (e->eType) {
         case DRW::POINT:
@@ -339,6 +358,12 @@ UTF8STRING dx_iface::AddFont(const QFont &f)
         }
     }
 
+    if (streaming)
+    {
+        // The style table is already written, unknown fonts fall back to the default style.
+        return cData.textStyles.front().name;
+    }
+
     ts.font = f.family().toStdString();
 
     cData.textStyles.push_back(ts);
@@ -101,6 +101,11 @@ class dx_iface : public DRW_Interface
     bool fileExport(bool binary);
     void writeEntity(DRW_Entity* e);
 
+    // Streaming export: header, tables and blocks are written by BeginStreaming(), after that entities go straight
+    // to the file with writeEntity(). Text styles must be added before BeginStreaming().
+    bool BeginStreaming(bool binary);
+    bool EndStreaming();
+
 //reimplement virtual DRW_Interface functions
 //writer part, send all in class dx_data to writer
     virtual void writeHeader(DRW_Header& data);
@@ -130,6 +135,7 @@ class dx_iface : public DRW_Interface
     dxfRW* dxfW; //pointer to writer, needed to send data
     dx_data cData; // class to store or read data
     DRW::Version version;
+    bool streaming;
 
     void InitHeader(VarMeasurement varMeasurement, VarInsunits varInsunits);
     void InitTextstyles();
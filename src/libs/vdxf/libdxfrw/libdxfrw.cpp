@@ -52,6 +52,8 @@ dxfRW::dxfRW(const char* name)
       elParts(128), //parts munber when convert ellipse to polyline
       blockMap(),
       imageDef(),
+      outStream(),
+      outBuffer(),
       currHandle()
 {
     DRW_DBGSL(DRW_dbg::NONE);
@@ -121,20 +123,32 @@ bool dxfRW::read(DRW_Interface *interface_, bool ext){
 }
 
 bool dxfRW::write(DRW_Interface *interface_, DRW::Version ver, bool bin){
-    bool isOk = false;
-    std::ofstream filestr;
+    if (!beginWrite(interface_, ver, bin))
+        return false;
+    iface->writeEntities();
+    return endWrite();
+}
+
+bool dxfRW::beginWrite(DRW_Interface *interface_, DRW::Version ver, bool bin){
     version = ver;
     binFile = bin;
     iface = interface_;
+    //the buffer must be set before open() to take effect
+    outBuffer.resize(1024 * 1024);
+    outStream.rdbuf()->pubsetbuf(outBuffer.data(), static_cast<std::streamsize>(outBuffer.size()));
     if (binFile) {
-        filestr.open (fileName.c_str(), std::ios_base::out | std::ios::binary | std::ios::trunc);
+        outStream.open (fileName.c_str(), std::ios_base::out | std::ios::binary | std::ios::trunc);
+        if (!outStream.is_open())
+            return false;
         //write sentinel
-        filestr << "AutoCAD Binary DXF\r\n" << static_cast<char>(26) << '\0';
-        writer = new dxfWriterBinary(&filestr);
+        outStream << "AutoCAD Binary DXF\r\n" << static_cast<char>(26) << '\0';
+        writer = new dxfWriterBinary(&outStream);
         DRW_DBG("dxfRW::read binary file\n");
     } else {
-        filestr.open (fileName.c_str(), std::ios_base::out | std::ios::trunc);
-        writer = new dxfWriterAscii(&filestr);
+        outStream.open (fileName.c_str(), std::ios_base::out | std::ios::trunc);
+        if (!outStream.is_open())
+            return false;
+        writer = new dxfWriterAscii(&outStream);
         std::string comm = std::string("dxfrw ") + std::string(DRW_VERSION);
         writer->writeString(999, comm);
     }
@@ -160,7 +174,12 @@ bool dxfRW::write(DRW_Interface *interface_, DRW::Version ver, bool bin){
 
     writer->writeString(0, "SECTION");
     writer->writeString(2, "ENTITIES");
-    iface->writeEntities();
+    return outStream.good();
+}
+
+bool dxfRW::endWrite(){
+    if (writer == nullptr)
+        return false;
     writer->writeString(0, "ENDSEC");
 
     if (version > DRW::AC1009) {
@@ -170,9 +189,9 @@ bool dxfRW::write(DRW_Interface *interface_, DRW::Version ver, bool bin){
         writer->writeString(0, "ENDSEC");
     }
     writer->writeString(0, "EOF");
-    filestr.flush();
-    filestr.close();
-    isOk = true;
+    outStream.flush();
+    const bool isOk = outStream.good();
+    outStream.close();
     delete writer;
     writer = nullptr;
     return isOk;
@@ -13,7 +13,9 @@
 #ifndef LIBDXFRW_H
 #define LIBDXFRW_H
 
+#include <fstream>
 #include <string>
+#include <vector>
 #include "drw_entities.h"
 #include "drw_objects.h"
 #include "drw_header.h"
@@ -43,6 +45,15 @@ class dxfRW {
     void setBinary(bool b) {binFile = b;}
 
     bool write(DRW_Interface *interface_, DRW::Version ver, bool bin);
+    /// starts a streamed write
+    /*!
+     * Writes header, classes, tables and blocks and opens the entities section. Entities can be sent
+     * with the write* functions until endWrite() is called.
+     * @return true for success
+     */
+    bool beginWrite(DRW_Interface *interface_, DRW::Version ver, bool bin);
+    /// closes the entities section, writes objects and finishes the file started by beginWrite()
+    bool endWrite();
     bool writeLineType(DRW_LType *ent);
     bool writeLayer(DRW_Layer *ent);
     bool writeDimstyle(DRW_Dimstyle *ent);
@@ -143,6 +154,8 @@ class dxfRW {
     int elParts;  /*!< parts munber when convert ellipse to polyline */
     std::map<std::string,int> blockMap;
     std::vector<DRW_ImageDef*> imageDef;  /*!< imageDef list */
+    std::ofstream outStream;
+    std::vector<char> outBuffer;  /*!< large buffer for outStream, entities are written one by one */
 
     int currHandle;
 
@@ -83,6 +83,8 @@ VDxfEngine::VDxfEngine()
     , varMeasurement(VarMeasurement::Metric)
     , varInsunits(VarInsunits::Millimeters)
     , textBuffer(new DRW_Text())
+    , fonts()
+    , streaming(true)
 {
 }
 
@@ -92,6 +94,23 @@ VDxfEngine::~VDxfEngine()
     delete textBuffer;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WriteEntity write the entity to the file or keep a copy of it until end() if streaming is off.
+ */
+template<class E>
+void VDxfEngine::WriteEntity(E &entity)
+{
+    if (streaming)
+    {
+        input->writeEntity(&entity);
+    }
+    else
+    {
+        input->AddEntity(new E(entity));
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VDxfEngine::begin(QPaintDevice *pdev)
 {
@@ -112,13 +131,27 @@ bool VDxfEngine::begin(QPaintDevice *pdev)
     input = QSharedPointer<dx_iface>(new dx_iface(fileName.toStdString(), m_version, varMeasurement, varInsunits));
     input->AddQtLTypes();
     input->AddDefLayers();
+
+    for (int i = 0; i < fonts.size(); ++i)
+    {
+        input->AddFont(fonts.at(i));
+    }
+
+    // Entities are written to the file as they are painted, so header and tables go first.
+    if (streaming && not input->BeginStreaming(m_binary))
+    {
+        qWarning() << "VDxfEngine::begin(), cannot open file" << fileName;
+        input.reset();
+        return false;
+    }
     return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VDxfEngine::end()
 {
-    const bool res = input->fileExport(m_binary);
+    const bool res = streaming ? input->EndStreaming() : input->fileExport(m_binary);
+    input.reset();
     return res;
 }
 
@@ -153,48 +186,48 @@ void VDxfEngine::drawPath(const QPainterPath &path)
 
         if (m_version > DRW::AC1009)
         { // Use lwpolyline
-            DRW_LWPolyline *poly = new DRW_LWPolyline();
-            poly->layer = "0";
-            poly->color = getPenColor();
-            poly->lWeight = DRW_LW_Conv::widthByLayer;
-            poly->lineType = getPenStyle();
+            DRW_LWPolyline poly;
+            poly.layer = "0";
+            poly.color = getPenColor();
+            poly.lWeight = DRW_LW_Conv::widthByLayer;
+            poly.lineType = getPenStyle();
 
             if (polygon.size() > 1 && polygon.first() == polygon.last())
             {
-                poly->flags |= 0x1; // closed
+                poly.flags |= 0x1; // closed
             }
 
-            poly->flags |= 0x80; // plinegen
+            poly.flags |= 0x80; // plinegen
 
             for (int i=0; i < polygon.count(); ++i)
             {
-                poly->addVertex(DRW_Vertex2D(FromPixel(polygon.at(i).x(), varInsunits),
-                                             FromPixel(getSize().height() - polygon.at(i).y(), varInsunits), 0));
+                poly.addVertex(DRW_Vertex2D(FromPixel(polygon.at(i).x(), varInsunits),
+                                            FromPixel(getSize().height() - polygon.at(i).y(), varInsunits), 0));
             }
 
-            input->AddEntity(poly);
+            WriteEntity(poly);
         }
         else
         { // Use polyline
-            DRW_Polyline *poly = new DRW_Polyline();
-            poly->layer = "0";
-            poly->color = getPenColor();
-            poly->lWeight = DRW_LW_Conv::widthByLayer;
-            poly->lineType = getPenStyle();
+            DRW_Polyline poly;
+            poly.layer = "0";
+            poly.color = getPenColor();
+            poly.lWeight = DRW_LW_Conv::widthByLayer;
+            poly.lineType = getPenStyle();
             if (polygon.size() > 1 && polygon.first() == polygon.last())
             {
-                poly->flags |= 0x1; // closed
+                poly.flags |= 0x1; // closed
             }
 
-            poly->flags |= 0x80; // plinegen
+            poly.flags |= 0x80; // plinegen
 
             for (int i=0; i < polygon.count(); ++i)
             {
-                poly->addVertex(DRW_Vertex(FromPixel(polygon.at(i).x(), varInsunits),
-                                           FromPixel(getSize().height() - polygon.at(i).y(), varInsunits), 0, 0));
+                poly.addVertex(DRW_Vertex(FromPixel(polygon.at(i).x(), varInsunits),
+                                          FromPixel(getSize().height() - polygon.at(i).y(), varInsunits), 0, 0));
             }
 
-            input->AddEntity(poly);
+            WriteEntity(poly);
         }
     }
 }
@@ -207,17 +240,17 @@ void VDxfEngine::drawLines(const QLineF * lines, int lineCount)
         const QPointF p1 = transform.map(lines[i].p1());
         const QPointF p2 = transform.map(lines[i].p2());
 
-        DRW_Line *line = new DRW_Line();
-        line->basePoint = DRW_Coord(FromPixel(p1.x(), varInsunits),
-                                    FromPixel(getSize().height() - p1.y(), varInsunits), 0);
-        line->secPoint =  DRW_Coord(FromPixel(p2.x(), varInsunits),
-                                    FromPixel(getSize().height() - p2.y(), varInsunits), 0);
-        line->layer = "0";
-        line->color = getPenColor();
-        line->lWeight = DRW_LW_Conv::widthByLayer;
-        line->lineType = getPenStyle();
+        DRW_Line line;
+        line.basePoint = DRW_Coord(FromPixel(p1.x(), varInsunits),
+                                   FromPixel(getSize().height() - p1.y(), varInsunits), 0);
+        line.secPoint =  DRW_Coord(FromPixel(p2.x(), varInsunits),
+                                   FromPixel(getSize().height() - p2.y(), varInsunits), 0);
+        line.layer = "0";
+        line.color = getPenColor();
+        line.lWeight = DRW_LW_Conv::widthByLayer;
+        line.lineType = getPenStyle();
 
-        input->AddEntity(line);
+        WriteEntity(line);
     }
 }
 
@@ -239,51 +272,51 @@ void VDxfEngine::drawPolygon(const QPointF *points, int pointCount, PolygonDrawM
 
     if (m_version > DRW::AC1009)
     { // Use lwpolyline
-        DRW_LWPolyline *poly = new DRW_LWPolyline();
-        poly->layer = "0";
-        poly->color = getPenColor();
-        poly->lWeight = DRW_LW_Conv::widthByLayer;
-        poly->lineType = getPenStyle();
+        DRW_LWPolyline poly;
+        poly.layer = "0";
+        poly.color = getPenColor();
+        poly.lWeight = DRW_LW_Conv::widthByLayer;
+        poly.lineType = getPenStyle();
 
         if (pointCount > 1 && points[0] == points[pointCount])
         {
-            poly->flags |= 0x1; // closed
+            poly.flags |= 0x1; // closed
         }
 
-        poly->flags |= 0x80; // plinegen
+        poly.flags |= 0x80; // plinegen
 
         for (int i = 0; i < pointCount; ++i)
         {
             const QPointF p = transform.map(points[i]);
-            poly->addVertex(DRW_Vertex2D(FromPixel(p.x(), varInsunits),
-                                         FromPixel(getSize().height() - p.y(), varInsunits), 0));
+            poly.addVertex(DRW_Vertex2D(FromPixel(p.x(), varInsunits),
+                                        FromPixel(getSize().height() - p.y(), varInsunits), 0));
         }
 
-        input->AddEntity(poly);
+        WriteEntity(poly);
     }
     else
     { // Use polyline
-        DRW_Polyline *poly = new DRW_Polyline();
-        poly->layer = "0";
-        poly->color = getPenColor();
-        poly->lWeight = DRW_LW_Conv::widthByLayer;
-        poly->lineType = getPenStyle();
+        DRW_Polyline poly;
+        poly.layer = "0";
+        poly.color = getPenColor();
+        poly.lWeight = DRW_LW_Conv::widthByLayer;
+        poly.lineType = getPenStyle();
 
         if (pointCount > 1 && points[0] == points[pointCount])
         {
-            poly->flags |= 0x1; // closed
+            poly.flags |= 0x1; // closed
         }
 
-        poly->flags |= 0x80; // plinegen
+        poly.flags |= 0x80; // plinegen
 
         for (int i = 0; i < pointCount; ++i)
         {
             const QPointF p = transform.map(points[i]);
-            poly->addVertex(DRW_Vertex(FromPixel(p.x(), varInsunits),
-                                       FromPixel(getSize().height() - p.y(), varInsunits), 0, 0));
+            poly.addVertex(DRW_Vertex(FromPixel(p.x(), varInsunits),
+                                      FromPixel(getSize().height() - p.y(), varInsunits), 0, 0));
         }
 
-        input->AddEntity(poly);
+        WriteEntity(poly);
     }
 }
 
@@ -318,20 +351,20 @@ void VDxfEngine::drawEllipse(const QRectF & rect)
         ratio  = rect.height()/rect.width();
     }
 
-    DRW_Ellipse *ellipse = new DRW_Ellipse();
-    ellipse->basePoint = DRW_Coord(FromPixel(newRect.center().x(), varInsunits),
-                                   FromPixel(getSize().height() - newRect.center().y(), varInsunits), 0);
-    ellipse->secPoint = DRW_Coord(FromPixel(majorX, varInsunits), FromPixel(majorY, varInsunits), 0);
-    ellipse->ratio = ratio;
-    ellipse->staparam = 0;
-    ellipse->endparam = 2*M_PI;
+    DRW_Ellipse ellipse;
+    ellipse.basePoint = DRW_Coord(FromPixel(newRect.center().x(), varInsunits),
+                                  FromPixel(getSize().height() - newRect.center().y(), varInsunits), 0);
+    ellipse.secPoint = DRW_Coord(FromPixel(majorX, varInsunits), FromPixel(majorY, varInsunits), 0);
+    ellipse.ratio = ratio;
+    ellipse.staparam = 0;
+    ellipse.endparam = 2*M_PI;
 
-    ellipse->layer = "0";
-    ellipse->color = getPenColor();
-    ellipse->lWeight = DRW_LW_Conv::widthByLayer;
-    ellipse->lineType = getPenStyle();
+    ellipse.layer = "0";
+    ellipse.color = getPenColor();
+    ellipse.lWeight = DRW_LW_Conv::widthByLayer;
+    ellipse.lineType = getPenStyle();
 
-    input->AddEntity(ellipse);
+    WriteEntity(ellipse);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -380,7 +413,8 @@ void VDxfEngine::drawTextItem(const QPointF & p, const QTextItem & textItem)
 
     if (foundEndOfString)
     {
-        input->AddEntity(textBuffer);
+        WriteEntity(*textBuffer);
+        delete textBuffer;
         textBuffer = new DRW_Text();
     }
 }
@@ -464,6 +498,31 @@ bool VDxfEngine::IsBinaryFormat() const
     return m_binary;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetStreaming write entities to the file while painting (default) or keep them until end().
+ *
+ * Without streaming the text style table is written at the end, so it has styles of all fonts painted text uses.
+ */
+void VDxfEngine::SetStreaming(bool value)
+{
+    Q_ASSERT(not isActive());
+    streaming = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VDxfEngine::IsStreaming() const
+{
+    return streaming;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDxfEngine::AddFont(const QFont &font)
+{
+    Q_ASSERT(not isActive());
+    fonts.append(font);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 std::string VDxfEngine::getPenStyle()
 {
@@ -30,6 +30,8 @@
 #define VDXFENGINE_H
 
 #include <qcompilerdetection.h>
+#include <QFont>
+#include <QList>
 #include <QMatrix>
 #include <QPaintEngine>
 #include <QPointF>
@@ -86,6 +88,11 @@ class VDxfEngine : public QPaintEngine
     void SetBinaryFormat(bool binary);
     bool IsBinaryFormat() const;
 
+    void SetStreaming(bool value);
+    bool IsStreaming() const;
+
+    void AddFont(const QFont &font);
+
     std::string getPenStyle();
     int getPenColor();
 
@@ -104,6 +111,8 @@ class VDxfEngine : public QPaintEngine
     VarMeasurement varMeasurement;
     VarInsunits varInsunits;
     DRW_Text *textBuffer;
+    QList<QFont> fonts;
+    bool streaming;
 
     Q_REQUIRED_RESULT double FromPixel(double pix, const VarInsunits &unit) const;
     Q_REQUIRED_RESULT double ToPixel(double val, const VarInsunits &unit) const;
@@ -121,6 +130,9 @@ class VDxfEngine : public QPaintEngine
     Q_REQUIRED_RESULT DRW_Entity *AAMALine(const QLineF &line, const QString &layer);
     Q_REQUIRED_RESULT DRW_Entity *AAMAText(const QPointF &pos, const QString &text, const QString &layer);
 
+    template<class E>
+    void WriteEntity(E &entity);
+
     template<class P, class V>
     Q_REQUIRED_RESULT P *CreateAAMAPolygon(const QVector<QPointF> &polygon, const QString &layer, bool forceClosed);
 };
@@ -140,6 +140,39 @@ bool VDxfPaintDevice::IsBinaryFormat() const
     return engine->IsBinaryFormat();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VDxfPaintDevice::SetStreaming(bool value)
+{
+    if (engine->isActive())
+    {
+        qWarning("VDxfPaintDevice::SetStreaming(), cannot change streaming while Dxf is being generated");
+        return;
+    }
+    engine->SetStreaming(value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VDxfPaintDevice::IsStreaming() const
+{
+    return engine->IsStreaming();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddFont registers a text style for text that will be painted. Entities are written while painting, after the
+ * style table, so fonts that were not registered before begin() fall back to the default style unless streaming is
+ * off.
+ */
+void VDxfPaintDevice::AddFont(const QFont &font)
+{
+    if (engine->isActive())
+    {
+        qWarning("VDxfPaintDevice::AddFont(), cannot add font while Dxf is being generated");
+        return;
+    }
+    engine->AddFont(font);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VDxfPaintDevice::setMeasurement(const VarMeasurement &var)
 {
@@ -38,6 +38,7 @@
 #include "dxfdef.h"
 #include "libdxfrw/drw_base.h"
 
+class QFont;
 class VDxfEngine;
 class VLayoutPiece;
 
@@ -63,6 +64,11 @@ class VDxfPaintDevice : public QPaintDevice
     void SetBinaryFormat(bool binary);
     bool IsBinaryFormat() const;
 
+    void SetStreaming(bool value);
+    bool IsStreaming() const;
+
+    void AddFont(const QFont &font);
+
     void setMeasurement(const VarMeasurement &var);
     void setInsunits(const VarInsunits &var);
 
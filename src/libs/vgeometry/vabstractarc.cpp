@@ -131,6 +131,7 @@ void VAbstractArc::SetFormulaF1(const QString &formula, qreal value)
 {
     d->formulaF1 = formula;
     d->f1 = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -150,6 +151,7 @@ void VAbstractArc::SetFormulaF2(const QString &formula, qreal value)
 {
     d->formulaF2 = formula;
     d->f2 = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -168,6 +170,7 @@ VPointF VAbstractArc::GetCenter() const
 void VAbstractArc::SetCenter(const VPointF &point)
 {
     d->center = point;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -242,6 +245,7 @@ qreal VAbstractArc::AngleArc() const
 void VAbstractArc::SetFlipped(bool value)
 {
     d->isFlipped = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
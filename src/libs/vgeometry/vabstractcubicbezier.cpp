@@ -60,6 +60,18 @@
 #include "../vmisc/vmath.h"
 #include "../vgeometry/vpointf.h"
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+inline void AppendParam(QVector<qreal> *pt, qreal t1, qreal t4, qreal fraction)
+{
+    if (pt != nullptr)
+    {
+        pt->append(t1 + (t4 - t1) * fraction);
+    }
+}
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractCubicBezier::VAbstractCubicBezier(const GOType &type, const quint32 &idObject, const Draw &mode)
     : VAbstractBezier(type, idObject, mode)
@@ -179,7 +191,31 @@ qreal VAbstractCubicBezier::GetParmT(qreal length) const
     }
 
     const qreal eps = 0.001 * length;
-    qreal parT = 0.5;
+
+    // The flattened curve gives a close first guess. Newton's method on LengthT() usually needs one or two steps
+    // from there to reach the same precision the bisection below gets.
+    qreal parT = ParamByLength(length);
+    if (parT >= 0)
+    {
+        const int maxSteps = 5;
+        for (int i = 0; i < maxSteps; ++i)
+        {
+            const qreal diff = LengthT(parT) - length;
+            if (qAbs(diff) <= eps)
+            {
+                return parT;
+            }
+
+            const qreal speed = Derivative(parT);
+            if (qFuzzyIsNull(speed))
+            {
+                break;
+            }
+            parT = qBound(0.0, parT - diff / speed, 1.0);
+        }
+    }
+
+    parT = 0.5;
     qreal step = parT;
     qreal splLength = LengthT(parT);
 
@@ -234,21 +270,14 @@ qreal VAbstractCubicBezier::CalcSqDistance(qreal x1, qreal y1, qreal x2, qreal y
  * @param level level of recursion. In the begin 0.
  * @param px list х coordinat spline points.
  * @param py list у coordinat spline points.
+ * @param pt if not null, list of approximate curve parameters of spline points.
+ * @param t1 curve parameter of the first point.
+ * @param t4 curve parameter of the last point.
  */
 void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2, qreal x3, qreal y3, qreal x4, qreal y4,
-                                         qint16 level, QVector<qreal> &px, QVector<qreal> &py)
+                                         qint16 level, QVector<qreal> &px, QVector<qreal> &py, QVector<qreal> *pt,
+                                         qreal t1, qreal t4)
 {
-    if (px.size() >= 2)
-    {
-        for (int i=1; i < px.size(); ++i)
-        {
-            if (QPointF(px.at(i-1), py.at(i-1)) == QPointF(px.at(i), py.at(i)))
-            {
-                qDebug("All neighbors points in path must be unique.");
-            }
-        }
-    }
-
     const double curve_collinearity_epsilon                 = 1e-30;
     const double curve_angle_tolerance_epsilon              = 0.01;
     const double m_angle_tolerance = 0.0;
@@ -353,6 +382,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                 {
                     px.append(x2);
                     py.append(y2);
+                    AppendParam(pt, t1, t4, 1.0/3.0);
                     return;
                 }
             }
@@ -362,6 +392,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                 {
                     px.append(x3);
                     py.append(y3);
+                    AppendParam(pt, t1, t4, 2.0/3.0);
                     return;
                 }
             }
@@ -377,6 +408,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                 {
                     px.append(x23);
                     py.append(y23);
+                    AppendParam(pt, t1, t4, 0.5);
                     return;
                 }
 
@@ -392,9 +424,11 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                 {
                     px.append(x2);
                     py.append(y2);
+                    AppendParam(pt, t1, t4, 1.0/3.0);
 
                     px.append(x3);
                     py.append(y3);
+                    AppendParam(pt, t1, t4, 2.0/3.0);
                     return;
                 }
 
@@ -404,6 +438,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                     {
                         px.append(x3);
                         py.append(y3);
+                        AppendParam(pt, t1, t4, 2.0/3.0);
                         return;
                     }
                 }
@@ -420,6 +455,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                 {
                     px.append(x23);
                     py.append(y23);
+                    AppendParam(pt, t1, t4, 0.5);
                     return;
                 }
 
@@ -435,9 +471,11 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                 {
                     px.append(x2);
                     py.append(y2);
+                    AppendParam(pt, t1, t4, 1.0/3.0);
 
                     px.append(x3);
                     py.append(y3);
+                    AppendParam(pt, t1, t4, 2.0/3.0);
                     return;
                 }
 
@@ -447,6 +485,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                     {
                         px.append(x2);
                         py.append(y2);
+                        AppendParam(pt, t1, t4, 1.0/3.0);
                         return;
                     }
                 }
@@ -466,6 +505,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                 {
                     px.append(x23);
                     py.append(y23);
+                    AppendParam(pt, t1, t4, 0.5);
                     return;
                 }
 
@@ -490,6 +530,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
 
                     px.append(x23);
                     py.append(y23);
+                    AppendParam(pt, t1, t4, 0.5);
                     return;
                 }
 
@@ -499,6 +540,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                     {
                         px.append(x2);
                         py.append(y2);
+                        AppendParam(pt, t1, t4, 1.0/3.0);
                         return;
                     }
 
@@ -506,6 +548,7 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
                     {
                         px.append(x3);
                         py.append(y3);
+                        AppendParam(pt, t1, t4, 2.0/3.0);
                         return;
                     }
                 }
@@ -518,8 +561,9 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
 
     // Continue subdivision
     //----------------------
-    PointBezier_r(x1, y1, x12, y12, x123, y123, x1234, y1234, static_cast<qint16>(level + 1), px, py);
-    PointBezier_r(x1234, y1234, x234, y234, x34, y34, x4, y4, static_cast<qint16>(level + 1), px, py);
+    const qreal t1234 = (t1 + t4) / 2;
+    PointBezier_r(x1, y1, x12, y12, x123, y123, x1234, y1234, static_cast<qint16>(level + 1), px, py, pt, t1, t1234);
+    PointBezier_r(x1234, y1234, x234, y234, x34, y34, x4, y4, static_cast<qint16>(level + 1), px, py, pt, t1234, t4);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -529,10 +573,11 @@ void VAbstractCubicBezier::PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2,
  * @param p2 first control point.
  * @param p3 second control point.
  * @param p4 last spline point.
+ * @param params if not null, receives approximate curve parameter of each point.
  * @return list of points.
  */
 QVector<QPointF> VAbstractCubicBezier::GetCubicBezierPoints(const QPointF &p1, const QPointF &p2, const QPointF &p3,
-                                                            const QPointF &p4)
+                                                            const QPointF &p4, QVector<qreal> *params)
 {
     QVector<QPointF> pvector;
     QVector<qreal> x;
@@ -541,14 +586,34 @@ QVector<QPointF> VAbstractCubicBezier::GetCubicBezierPoints(const QPointF &p1, c
     QVector<qreal>& wy = y;
     x.append ( p1.x () );
     y.append ( p1.y () );
+    if (params != nullptr)
+    {
+        params->clear();
+        params->append(0);
+    }
     PointBezier_r ( p1.x (), p1.y (), p2.x (), p2.y (),
-                    p3.x (), p3.y (), p4.x (), p4.y (), 0, wx, wy );
+                    p3.x (), p3.y (), p4.x (), p4.y (), 0, wx, wy, params );
     x.append ( p4.x () );
     y.append ( p4.y () );
+    if (params != nullptr)
+    {
+        params->append(1);
+    }
+
+    pvector.reserve(x.count());
     for ( qint32 i = 0; i < x.count(); ++i )
     {
         pvector.append( QPointF ( x.at(i), y.at(i)) );
     }
+
+    for (qint32 i = 1; i < pvector.count(); ++i)
+    {
+        if (pvector.at(i-1) == pvector.at(i))
+        {
+            qDebug("All neighbors points in path must be unique.");
+            break;
+        }
+    }
     return pvector;
 }
 
@@ -600,3 +665,21 @@ qreal VAbstractCubicBezier::LengthT(qreal t) const
 
     return LengthBezier ( static_cast<QPointF>(GetP1()), p12, p123, p1234);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Derivative return length of the curve derivative (speed) at t.
+ * @param t curve parameter.
+ * @return length of the derivative vector.
+ */
+qreal VAbstractCubicBezier::Derivative(qreal t) const
+{
+    const QPointF p1 = static_cast<QPointF>(GetP1());
+    const QPointF p2 = GetControlPoint1();
+    const QPointF p3 = GetControlPoint2();
+    const QPointF p4 = static_cast<QPointF>(GetP4());
+
+    const qreal mt = 1 - t;
+    const QPointF v = 3 * (mt * mt * (p2 - p1) + 2 * mt * t * (p3 - p2) + t * t * (p4 - p3));
+    return qSqrt(v.x() * v.x() + v.y() * v.y());
+}
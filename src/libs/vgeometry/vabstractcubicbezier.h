@@ -89,13 +89,17 @@ class VAbstractCubicBezier : public VAbstractBezier
 
     static qreal            CalcSqDistance(qreal x1, qreal y1, qreal x2, qreal y2);
     static void             PointBezier_r(qreal x1, qreal y1, qreal x2, qreal y2, qreal x3, qreal y3, qreal x4,
-                                          qreal y4, qint16 level, QVector<qreal> &px, QVector<qreal> &py);
+                                          qreal y4, qint16 level, QVector<qreal> &px, QVector<qreal> &py,
+                                          QVector<qreal> *pt = nullptr, qreal t1 = 0, qreal t4 = 1);
     static QVector<QPointF> GetCubicBezierPoints(const QPointF &p1, const QPointF &p2, const QPointF &p3,
-                                                 const QPointF &p4);
+                                                 const QPointF &p4, QVector<qreal> *params = nullptr);
     static qreal            LengthBezier(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4);
 
     virtual QPointF GetControlPoint1() const =0;
     virtual QPointF GetControlPoint2() const =0;
+
+private:
+    qreal Derivative(qreal t) const;
 };
 
 #endif // VABSTRACTCUBICBEZIER_H
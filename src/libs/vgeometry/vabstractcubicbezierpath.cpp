@@ -104,11 +104,14 @@ QPainterPath VAbstractCubicBezierPath::GetPath() const
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief GetPathPoints return list of points what located on path.
+ * @brief CalculatePoints return list of points what located on path.
+ * @param params not used, path points have no single curve parameter.
  * @return list.
  */
-QVector<QPointF> VAbstractCubicBezierPath::getPoints() const
+QVector<QPointF> VAbstractCubicBezierPath::CalculatePoints(QVector<qreal> &params) const
 {
+    Q_UNUSED(params)
+
     QVector<QPointF> pathPoints;
     for (qint32 i = 1; i <= CountSubSpl(); ++i)
     {
@@ -129,12 +132,7 @@ QVector<QPointF> VAbstractCubicBezierPath::getPoints() const
  */
 qreal VAbstractCubicBezierPath::GetLength() const
 {
-    qreal length = 0;
-    for (qint32 i = 1; i <= CountSubSpl(); ++i)
-    {
-        length += GetSpline(i).GetLength();
-    }
-    return length;
+    return CachedLength();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -80,7 +80,6 @@ class VAbstractCubicBezierPath : public VAbstractBezier
     virtual QVector<VSplinePoint>   GetSplinePath() const =0;
 
     virtual QPainterPath            GetPath() const Q_DECL_OVERRIDE;
-    virtual QVector<QPointF>        getPoints() const Q_DECL_OVERRIDE;
     virtual qreal                   GetLength() const Q_DECL_OVERRIDE;
 
     virtual QVector<DirectionArrow> DirectionArrows() const Q_DECL_OVERRIDE;
@@ -97,6 +96,7 @@ class VAbstractCubicBezierPath : public VAbstractBezier
 
 protected:
     virtual void CreateName() Q_DECL_OVERRIDE;
+    virtual QVector<QPointF> CalculatePoints(QVector<qreal> &params) const Q_DECL_OVERRIDE;
 };
 
 #endif // VABSTRACTCUBICBEZIERPATH_H
@@ -54,9 +54,11 @@
 #include <QLine>
 #include <QLineF>
 #include <QMessageLogger>
+#include <QMutexLocker>
 #include <QPainterPath>
 #include <QPoint>
 #include <QtDebug>
+#include <algorithm>
 
 #include "vabstractcurve_p.h"
 
@@ -95,6 +97,19 @@ VAbstractCurve &VAbstractCurve::operator=(const VAbstractCurve &curve)
 VAbstractCurve::~VAbstractCurve()
 {}
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getPoints return list of points needed for drawing curve.
+ *
+ * Points are calculated only once and kept until the curve changes.
+ * @return list of points.
+ */
+QVector<QPointF> VAbstractCurve::getPoints() const
+{
+    UpdateCache();
+    return d->points;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VAbstractCurve::GetSegmentPoints(const QVector<QPointF> &points, const QPointF &begin,
                                                   const QPointF &end, bool reverse)
@@ -225,7 +240,8 @@ QPainterPath VAbstractCurve::GetPath() const
 //---------------------------------------------------------------------------------------------------------------------
 qreal VAbstractCurve::GetLengthByPoint(const QPointF &point) const
 {
-    const QVector<QPointF> points = getPoints();
+    UpdateCache();
+    const QVector<QPointF> &points = d->points;
     if (points.size() < 2)
     {
         return -1;
@@ -236,13 +252,24 @@ qreal VAbstractCurve::GetLengthByPoint(const QPointF &point) const
         return 0;
     }
 
-    bool ok = false;
-    const QVector<QPointF> segment = ToEnd(points, point, &ok);
-    if (not ok)
+    if (points.last().toPoint() == point.toPoint())
     {
-        return -1;
+        return d->lengths.last();
     }
-    return PathLength(segment);
+
+    // Like ToEnd() take the last segment that contains the point.
+    for (qint32 i = points.count()-2; i >= 0; --i)
+    {
+        if (IsPointOnLineSegment(point, points.at(i), points.at(i+1)))
+        {
+            if (point == points.at(i))
+            {
+                return d->lengths.at(i);
+            }
+            return d->lengths.at(i) + QLineF(points.at(i), point).length();
+        }
+    }
+    return -1;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -477,3 +504,93 @@ QPointF VAbstractCurve::getLastPoint()
     const QVector<QPointF> points = getPoints();
     return points.at(points.count() - 1);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ResetCache drop calculated points. Must be called by every method that changes the curve geometry.
+ */
+void VAbstractCurve::ResetCache()
+{
+    d->ResetCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CachedLength return length of the flattened curve. The same value as PathLength(getPoints()).
+ * @return length.
+ */
+qreal VAbstractCurve::CachedLength() const
+{
+    UpdateCache();
+    return d->lengths.isEmpty() ? 0 : d->lengths.last();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParamByLength find curve parameter for length from the first point by binary search over the flattened curve.
+ *
+ * The result is an approximation, precision is the same as precision of the curve points.
+ * @param length length from the first point.
+ * @return curve parameter or -1 if the curve doesn't provide parameters of its points.
+ */
+qreal VAbstractCurve::ParamByLength(qreal length) const
+{
+    UpdateCache();
+    const QVector<qreal> &lengths = d->lengths;
+    const QVector<qreal> &params = d->params;
+
+    if (params.isEmpty())
+    {
+        return -1;
+    }
+
+    if (length <= lengths.first())
+    {
+        return params.first();
+    }
+
+    if (length >= lengths.last())
+    {
+        return params.last();
+    }
+
+    // lengths.at(i-1) <= length < lengths.at(i)
+    const auto upper = std::upper_bound(lengths.constBegin(), lengths.constEnd(), length);
+    const qint32 i = static_cast<qint32>(upper - lengths.constBegin());
+
+    const qreal k = (length - lengths.at(i-1)) / (lengths.at(i) - lengths.at(i-1));
+    return params.at(i-1) + k * (params.at(i) - params.at(i-1));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VAbstractCurve::UpdateCache() const
+{
+    if (d->cacheValid.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    QMutexLocker locker(&d->cacheMutex);
+    if (d->cacheValid.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    QVector<qreal> params;
+    d->points = CalculatePoints(params);
+    d->params = params.size() == d->points.size() ? params : QVector<qreal>();
+
+    d->lengths.clear();
+    d->lengths.reserve(d->points.size());
+    qreal length = 0;
+    for (qint32 i = 0; i < d->points.count(); ++i)
+    {
+        if (i > 0)
+        {
+            length += QLineF(d->points.at(i-1), d->points.at(i)).length();
+        }
+        d->lengths.append(length);
+    }
+
+    d->cacheValid.store(true, std::memory_order_release);
+}
@@ -80,7 +80,7 @@ class VAbstractCurve :public VGObject
 
 	void                     Swap(VAbstractCurve &curve) Q_DECL_NOTHROW;
 
-    virtual QVector<QPointF> getPoints() const =0;
+    QVector<QPointF>         getPoints() const;
     static QVector<QPointF>  GetSegmentPoints(const QVector<QPointF> &points, const QPointF &begin, const QPointF &end,
                                               bool reverse = false);
     QVector<QPointF>         GetSegmentPoints(const QPointF &begin, const QPointF &end, bool reverse = false) const;
@@ -124,10 +124,17 @@ class VAbstractCurve :public VGObject
 
 protected:
     virtual void             CreateName() =0;
+    virtual QVector<QPointF> CalculatePoints(QVector<qreal> &params) const =0;
+
+    void                     ResetCache();
+    qreal                    CachedLength() const;
+    qreal                    ParamByLength(qreal length) const;
 
 private:
     QSharedDataPointer<VAbstractCurveData> d;
 
+    void                     UpdateCache() const;
+
     static QVector<QPointF>  FromBegin(const QVector<QPointF> &points, const QPointF &begin, bool *ok = nullptr);
     static QVector<QPointF>  ToEnd(const QVector<QPointF> &points, const QPointF &end, bool *ok = nullptr);
 };
@@ -53,6 +53,10 @@
 #define VABSTRACTCURVE_P_H
 
 #include <QSharedData>
+#include <QMutex>
+#include <QPointF>
+#include <QVector>
+#include <atomic>
 
 #include "../ifc/ifcdef.h"
 #include "../vmisc/diagnostic.h"
@@ -70,6 +74,16 @@ class VAbstractCurveData : public QSharedData
         , color(ColorBlack)
         , penStyle(LineTypeSolidLine)
         , lineWeight("0.35")
+        , cacheMutex()
+#ifdef Q_CC_MSVC
+        // See https://stackoverflow.com/questions/15750917/initializing-stdatomic-bool
+        , cacheValid(ATOMIC_VAR_INIT(false))
+#else
+        , cacheValid(false)
+#endif
+        , points()
+        , lengths()
+        , params()
     {}
 
     VAbstractCurveData(const VAbstractCurveData &curve)
@@ -78,7 +92,17 @@ class VAbstractCurveData : public QSharedData
         , color(curve.color)
         , penStyle(curve.penStyle)
         , lineWeight(curve.lineWeight)
-
+        , cacheMutex()
+        // A copy is made to change the curve, so it never inherits the cache of the source.
+#ifdef Q_CC_MSVC
+        // See https://stackoverflow.com/questions/15750917/initializing-stdatomic-bool
+        , cacheValid(ATOMIC_VAR_INIT(false))
+#else
+        , cacheValid(false)
+#endif
+        , points()
+        , lengths()
+        , params()
     {}
 
     virtual ~VAbstractCurveData();
@@ -90,6 +114,18 @@ class VAbstractCurveData : public QSharedData
     QString penStyle;
     QString lineWeight;
 
+    /**
+     * Cache of the flattened curve. Filled on the first read and reset by every change of the curve geometry. Copies
+     * of a curve share it, so filling is guarded by cacheMutex and cacheValid publishes the result.
+     */
+    void ResetCache() { cacheValid.store(false); }
+
+    mutable QMutex           cacheMutex;
+    mutable std::atomic_bool cacheValid;
+    mutable QVector<QPointF> points;  //! @brief points flattened curve.
+    mutable QVector<qreal>   lengths; //! @brief lengths curve length from the first point to each point.
+    mutable QVector<qreal>   params;  //! @brief params curve parameter of each point, empty if curve has none.
+
 private:
     VAbstractCurveData &operator=(const VAbstractCurveData &) Q_DECL_EQ_DELETE;
 };
@@ -256,11 +256,14 @@ QPointF VArc::GetP2 () const
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief GetPoints return list of points needed for drawing arc.
+ * @brief CalculatePoints return list of points needed for drawing arc.
+ * @param params not used.
  * @return list of points
  */
-QVector<QPointF> VArc::getPoints() const
+QVector<QPointF> VArc::CalculatePoints(QVector<qreal> &params) const
 {
+    Q_UNUSED(params)
+
     QVector<QPointF> points;
     QVector<qreal> sectionAngle;
 
@@ -472,6 +475,7 @@ void VArc::SetFormulaRadius(const QString &formula, qreal value)
 {
     d->formulaRadius = formula;
     d->radius = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
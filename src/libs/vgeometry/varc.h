@@ -105,7 +105,6 @@ class VArc: public VAbstractArc
     QPointF                      GetP1() const;
     QPointF                      GetP2 () const;
 
-    virtual QVector<QPointF>     getPoints() const Q_DECL_OVERRIDE;
     QVector<QLineF>              getSegments() const;
 
     QPointF                      CutArc (qreal length, VArc &segment1, VArc &segment2) const;
@@ -114,6 +113,7 @@ class VArc: public VAbstractArc
 protected:
     virtual void                 CreateName() Q_DECL_OVERRIDE;
     virtual void                 FindF2(qreal length) Q_DECL_OVERRIDE;
+    virtual QVector<QPointF>     CalculatePoints(QVector<qreal> &params) const Q_DECL_OVERRIDE;
 
 private:
     QSharedDataPointer<VArcData> d;
@@ -155,6 +155,7 @@ VPointF VCubicBezier::GetP1() const
 void VCubicBezier::SetP1(const VPointF &p)
 {
     d->p1 = p;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -167,6 +168,7 @@ VPointF VCubicBezier::GetP2() const
 void VCubicBezier::SetP2(const VPointF &p)
 {
     d->p2 = p;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -179,6 +181,7 @@ VPointF VCubicBezier::GetP3() const
 void VCubicBezier::SetP3(const VPointF &p)
 {
     d->p3 = p;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -191,6 +194,7 @@ VPointF VCubicBezier::GetP4() const
 void VCubicBezier::SetP4(const VPointF &p)
 {
     d->p4 = p;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -212,19 +216,19 @@ qreal VCubicBezier::GetEndAngle() const
  */
 qreal VCubicBezier::GetLength() const
 {
-    return LengthBezier (static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()),
-                         static_cast<QPointF>(GetP3()), static_cast<QPointF>(GetP4()));
+    return CachedLength();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief GetPoints return list with cubic bezier curve points.
+ * @brief CalculatePoints return list with cubic bezier curve points.
+ * @param params curve parameter of each point.
  * @return list of points.
  */
-QVector<QPointF> VCubicBezier::getPoints() const
+QVector<QPointF> VCubicBezier::CalculatePoints(QVector<qreal> &params) const
 {
     return GetCubicBezierPoints(static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()),
-                                static_cast<QPointF>(GetP3()), static_cast<QPointF>(GetP4()));
+                                static_cast<QPointF>(GetP3()), static_cast<QPointF>(GetP4()), &params);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
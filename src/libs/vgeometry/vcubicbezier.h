@@ -100,7 +100,6 @@ class VCubicBezier : public VAbstractCubicBezier
     virtual qreal            GetStartAngle() const Q_DECL_OVERRIDE;
     virtual qreal            GetEndAngle() const Q_DECL_OVERRIDE;
     virtual qreal            GetLength() const Q_DECL_OVERRIDE;
-    virtual QVector<QPointF> getPoints() const Q_DECL_OVERRIDE;
 
     virtual qreal GetC1Length() const Q_DECL_OVERRIDE;
     virtual qreal GetC2Length() const Q_DECL_OVERRIDE;
@@ -108,6 +107,7 @@ class VCubicBezier : public VAbstractCubicBezier
 protected:
     virtual QPointF GetControlPoint1() const Q_DECL_OVERRIDE;
     virtual QPointF GetControlPoint2() const Q_DECL_OVERRIDE;
+    virtual QVector<QPointF> CalculatePoints(QVector<qreal> &params) const Q_DECL_OVERRIDE;
 
 private:
     QSharedDataPointer<VCubicBezierData> d;
@@ -165,6 +165,8 @@ VCubicBezierPath::~VCubicBezierPath()
 //---------------------------------------------------------------------------------------------------------------------
 VPointF &VCubicBezierPath::operator[](int indx)
 {
+    // The point can be changed through the reference.
+    ResetCache();
     return d->path[indx];
 }
 
@@ -178,6 +180,7 @@ const VPointF &VCubicBezierPath::at(int indx) const
 void VCubicBezierPath::append(const VPointF &point)
 {
     d->path.append(point);
+    ResetCache();
     CreateName();
 }
 
@@ -197,6 +200,7 @@ qint32 VCubicBezierPath::CountPoints() const
 void VCubicBezierPath::Clear()
 {
     d->path.clear();
+    ResetCache();
     SetDuplicate(0);
 }
 
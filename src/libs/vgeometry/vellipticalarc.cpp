@@ -200,7 +200,7 @@ VEllipticalArc::~VEllipticalArc()
  */
 qreal VEllipticalArc::GetLength() const
 {
-    qreal length = PathLength(getPoints());
+    qreal length = CachedLength();
 
     if (IsFlipped())
     {
@@ -240,6 +240,7 @@ QTransform VEllipticalArc::getTransform() const
 void VEllipticalArc::setTransform(const QTransform &matrix, bool combine)
 {
     d->m_transform = combine ? d->m_transform * matrix : matrix;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -287,11 +288,14 @@ QPointF VEllipticalArc::getPoint(qreal angle) const
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief GetPoints return list of points needed for drawing arc.
+ * @brief CalculatePoints return list of points needed for drawing arc.
+ * @param params not used.
  * @return list of points
  */
-QVector<QPointF> VEllipticalArc::getPoints() const
+QVector<QPointF> VEllipticalArc::CalculatePoints(QVector<qreal> &params) const
 {
+    Q_UNUSED(params)
+
     const QPointF center = VAbstractArc::GetCenter().toQPointF();
     QRectF box(center.x() - d->radius1, center.y() - d->radius2, d->radius1*2, d->radius2*2);
 
@@ -516,6 +520,7 @@ void VEllipticalArc::SetFormulaRadius1(const QString &formula, qreal value)
 {
     d->formulaRadius1 = formula;
     d->radius1 = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -523,6 +528,7 @@ void VEllipticalArc::SetFormulaRadius2(const QString &formula, qreal value)
 {
     d->formulaRadius2 = formula;
     d->radius2 = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -530,6 +536,7 @@ void VEllipticalArc::SetFormulaRotationAngle(const QString &formula, qreal value
 {
     d->formulaRotationAngle = formula;
     d->rotationAngle = value;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -101,7 +101,6 @@ class VEllipticalArc : public VAbstractArc
     void            setTransform(const QTransform &matrix, bool combine = false);
 
     virtual VPointF GetCenter () const Q_DECL_OVERRIDE;
-    virtual QVector<QPointF> getPoints() const Q_DECL_OVERRIDE;
     virtual qreal   GetStartAngle () const Q_DECL_OVERRIDE;
     virtual qreal   GetEndAngle () const Q_DECL_OVERRIDE;
 
@@ -113,6 +112,7 @@ class VEllipticalArc : public VAbstractArc
 protected:
     virtual void    CreateName() Q_DECL_OVERRIDE;
     virtual void    FindF2(qreal length) Q_DECL_OVERRIDE;
+    virtual QVector<QPointF> CalculatePoints(QVector<qreal> &params) const Q_DECL_OVERRIDE;
 
 private:
     QSharedDataPointer<VEllipticalArcData> d;
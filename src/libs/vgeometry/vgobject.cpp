@@ -237,6 +237,23 @@ quint32 VGObject::getIdTool() const
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief revision return stamp of the object geometry. Container gives a new stamp every time it stores the object,
+ * so equal stamps mean the same geometry.
+ * @return revision stamp, 0 if the object was never stored in a container.
+ */
+quint64 VGObject::revision() const
+{
+    return d->revision;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGObject::setRevision(quint64 revision)
+{
+    d->revision = revision;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VGObject::BuildLine(const QPointF &p1, const qreal &length, const qreal &angle)
 {
@@ -102,6 +102,9 @@ class VGObject
 
     quint32         getIdTool() const;
 
+    quint64         revision() const;
+    void            setRevision(quint64 revision);
+
     static QLineF  BuildLine(const QPointF &p1, const qreal& length, const qreal &angle);
     static QPointF BuildRay(const QPointF &firstPoint, const qreal &angle, const QRectF &scRect);
     static QLineF  BuildAxis(const QPointF &p, const qreal &angle, const QRectF &scRect);
@@ -65,15 +65,16 @@ class VGObjectData : public QSharedData
 {
 public:
     VGObjectData()
-        :_id(NULL_ID), type(GOType::Unknown), idObject(NULL_ID), _name(QString()), mode(Draw::Calculation)
+        :_id(NULL_ID), type(GOType::Unknown), idObject(NULL_ID), _name(QString()), mode(Draw::Calculation), revision(0)
     {}
 
     VGObjectData(const GOType &type, const quint32 &idObject, const Draw &mode)
-        :_id(NULL_ID), type(type), idObject(idObject), _name(QString()), mode(mode)
+        :_id(NULL_ID), type(type), idObject(idObject), _name(QString()), mode(mode), revision(0)
     {}
 
     VGObjectData(const VGObjectData &obj)
-        :QSharedData(obj), _id(obj._id), type(obj.type), idObject(obj.idObject), _name(obj._name), mode(obj.mode)
+        :QSharedData(obj), _id(obj._id), type(obj.type), idObject(obj.idObject), _name(obj._name), mode(obj.mode),
+          revision(obj.revision)
     {}
 
     virtual ~VGObjectData();
@@ -93,6 +94,9 @@ class VGObjectData : public QSharedData
     /** @brief mode object created in calculation or drawing mode */
     Draw    mode;
 
+    /** @brief revision stamp of the geometry stored in container. */
+    quint64 revision;
+
 private:
     VGObjectData &operator=(const VGObjectData &) Q_DECL_EQ_DELETE;
 };
@@ -202,8 +202,7 @@ VSpline::~VSpline()
  */
 qreal VSpline::GetLength () const
 {
-    return LengthBezier ( static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()), static_cast<QPointF>(GetP3()),
-                          static_cast<QPointF>(GetP4()));
+    return CachedLength();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -222,13 +221,14 @@ QPointF VSpline::CutSpline(qreal length, VSpline &spl1, VSpline &spl2) const
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief GetPoints return list with spline points.
+ * @brief CalculatePoints return list with spline points.
+ * @param params curve parameter of each point.
  * @return list of points.
  */
-QVector<QPointF> VSpline::getPoints() const
+QVector<QPointF> VSpline::CalculatePoints(QVector<qreal> &params) const
 {
     return GetCubicBezierPoints(static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()),
-                                static_cast<QPointF>(GetP3()), static_cast<QPointF>(GetP4()));
+                                static_cast<QPointF>(GetP3()), static_cast<QPointF>(GetP4()), &params);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -287,6 +287,7 @@ VPointF VSpline::GetP1() const
 void VSpline::SetP1(const VPointF &p)
 {
     d->p1 = p;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -327,6 +328,7 @@ VPointF VSpline::GetP4() const
 void VSpline::SetP4(const VPointF &p)
 {
     d->p4 = p;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -366,6 +368,7 @@ void VSpline::SetStartAngle(qreal angle, const QString &formula)
 {
     d->angle1 = angle;
     d->angle1F = formula;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -373,6 +376,7 @@ void VSpline::SetEndAngle(qreal angle, const QString &formula)
 {
     d->angle2 = angle;
     d->angle2F = formula;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -404,6 +408,7 @@ void VSpline::SetC1Length(qreal length, const QString &formula)
 {
     d->c1Length = length;
     d->c1LengthF = formula;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -411,6 +416,7 @@ void VSpline::SetC2Length(qreal length, const QString &formula)
 {
     d->c2Length = length;
     d->c2LengthF = formula;
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -130,7 +130,6 @@ class VSpline :public VAbstractCubicBezier
     using VAbstractCubicBezier::CutSpline;
     QPointF CutSpline ( qreal length, VSpline &spl1, VSpline &spl2) const;
 
-    virtual QVector<QPointF> getPoints() const Q_DECL_OVERRIDE;
     // cppcheck-suppress unusedFunction
     static QVector<QPointF> SplinePoints(const QPointF &p1, const QPointF &p4, qreal angle1, qreal angle2, qreal kAsm1,
                                          qreal kAsm2, qreal kCurve);
@@ -139,6 +138,7 @@ class VSpline :public VAbstractCubicBezier
 protected:
     virtual QPointF GetControlPoint1() const Q_DECL_OVERRIDE;
     virtual QPointF GetControlPoint2() const Q_DECL_OVERRIDE;
+    virtual QVector<QPointF> CalculatePoints(QVector<qreal> &params) const Q_DECL_OVERRIDE;
 private:
     QSharedDataPointer<VSplineData> d;
     QVector<qreal> CalcT(qreal curveCoord1, qreal curveCoord2, qreal curveCoord3, qreal curveCoord4,
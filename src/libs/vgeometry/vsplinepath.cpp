@@ -222,6 +222,7 @@ void VSplinePath::append(const VSplinePoint &point)
     }
 
     d->path.append(point);
+    ResetCache();
     CreateName();
 }
 
@@ -288,6 +289,7 @@ void VSplinePath::UpdatePoint(qint32 indexSpline, const SplinePointPosition &pos
     {
         d->path[indexSpline] = point;
     }
+    ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -338,6 +340,8 @@ VSplinePath &VSplinePath::operator =(const VSplinePath &path)
  */
 VSplinePoint & VSplinePath::operator[](int indx)
 {
+    // The point can be changed through the reference.
+    ResetCache();
     return d->path[indx];
 }
 
@@ -483,5 +487,6 @@ QVector<VFSplinePoint> VSplinePath::GetFSplinePath() const
 void VSplinePath::Clear()
 {
     d->path.clear();
+    ResetCache();
     SetDuplicate(0);
 }
@@ -55,12 +55,163 @@
 #include "../vgeometry/vpointf.h"
 
 #include <QLineF>
+#include <QRectF>
 #include <QSet>
 #include <QVector>
 #include <QPainterPath>
+#include <QtMath>
+#include <algorithm>
+#include <functional>
 
 const qreal maxL = 2.4;
 
+namespace
+{
+/**
+ * @brief The SegmentGrid class buckets segments of a path by their bounding boxes.
+ *
+ * Two segments can intersect only if their bounding boxes touch, so only segments sharing a grid cell need the exact
+ * test. Segment j goes from point j to point j+1, the last one closes the path to the first point. Short paths skip
+ * the grid and return all segments.
+ */
+class SegmentGrid
+{
+public:
+    explicit SegmentGrid(const QVector<QPointF> &points);
+
+    QVector<qint32> Candidates(qint32 i) const;
+
+private:
+    Q_DISABLE_COPY(SegmentGrid)
+
+    qint32                   count;
+    QVector<QRectF>          boxes;
+    QRectF                   bounds;
+    qint32                   columns;
+    qint32                   rows;
+    QVector<QVector<qint32>> cells;
+    mutable QVector<qint32>  marks;
+    mutable qint32           mark;
+
+    void CellRange(const QRectF &box, qint32 &left, qint32 &top, qint32 &right, qint32 &bottom) const;
+};
+
+// Below this size checking every pair is cheaper than building the grid.
+const qint32 gridMinSegments = 64;
+
+//---------------------------------------------------------------------------------------------------------------------
+SegmentGrid::SegmentGrid(const QVector<QPointF> &points)
+    : count(points.size()),
+      boxes(),
+      bounds(),
+      columns(0),
+      rows(0),
+      cells(),
+      marks(),
+      mark(0)
+{
+    if (count < gridMinSegments)
+    {
+        return;
+    }
+
+    // Parallel segments on the same line are tested with tolerance, the margin keeps them in touching boxes.
+    const qreal margin = VGObject::accuracyPointOnLine * 2;
+
+    boxes.reserve(count);
+    for (qint32 j = 0; j < count; ++j)
+    {
+        const QPointF &p1 = points.at(j);
+        const QPointF &p2 = points.at(j == count-1 ? 0 : j+1);
+        const QRectF box = QRectF(p1, p2).normalized().adjusted(-margin, -margin, margin, margin);
+        boxes.append(box);
+        bounds = bounds.united(box);
+    }
+
+    const qint32 side = qMax(1, qCeil(qSqrt(count)));
+    columns = side;
+    rows = side;
+    cells.resize(columns * rows);
+    marks.fill(-1, count);
+
+    for (qint32 j = 0; j < count; ++j)
+    {
+        qint32 left, top, right, bottom;
+        CellRange(boxes.at(j), left, top, right, bottom);
+        for (qint32 row = top; row <= bottom; ++row)
+        {
+            for (qint32 column = left; column <= right; ++column)
+            {
+                cells[row * columns + column].append(j);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Candidates return segments that can intersect segment i.
+ * @param i index of segment.
+ * @return indexes starting from i+2 in descending order, the order CheckLoops checks them.
+ */
+QVector<qint32> SegmentGrid::Candidates(qint32 i) const
+{
+    QVector<qint32> candidates;
+    if (cells.isEmpty())
+    {
+        for (qint32 j = count-1; j >= i+2; --j)
+        {
+            candidates.append(j);
+        }
+        return candidates;
+    }
+
+    ++mark;
+    const QRectF &box = boxes.at(i);
+    qint32 left, top, right, bottom;
+    CellRange(box, left, top, right, bottom);
+    for (qint32 row = top; row <= bottom; ++row)
+    {
+        for (qint32 column = left; column <= right; ++column)
+        {
+            const QVector<qint32> &cell = cells.at(row * columns + column);
+            for (qint32 c = 0; c < cell.size(); ++c)
+            {
+                const qint32 j = cell.at(c);
+                if (j >= i+2 && marks.at(j) != mark)
+                {
+                    marks[j] = mark;
+                    if (boxes.at(j).intersects(box))
+                    {
+                        candidates.append(j);
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), std::greater<qint32>());
+    return candidates;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SegmentGrid::CellRange(const QRectF &box, qint32 &left, qint32 &top, qint32 &right, qint32 &bottom) const
+{
+    const qreal cellWidth = bounds.width() / columns;
+    const qreal cellHeight = bounds.height() / rows;
+
+    auto Cell = [](qreal value, qreal cellSize, qint32 cellCount)
+    {
+        return qBound(0, static_cast<qint32>(value / cellSize), cellCount - 1);
+    };
+
+    left = Cell(box.left() - bounds.left(), cellWidth, columns);
+    right = Cell(box.right() - bounds.left(), cellWidth, columns);
+    top = Cell(box.top() - bounds.top(), cellHeight, rows);
+    bottom = Cell(box.bottom() - bounds.top(), cellHeight, rows);
+}
+}
+
 #ifdef Q_COMPILER_RVALUE_REFS
 VAbstractPiece &VAbstractPiece::operator=(VAbstractPiece &&piece) Q_DECL_NOTHROW
 { Swap(piece); return *this; }
@@ -324,6 +475,7 @@ QVector<QPointF> VAbstractPiece::CheckLoops(const QVector<QPointF> &points)
     const bool pathClosed = (points.first() == points.last());
 
     QVector<QPointF> ekvPoints;
+    const SegmentGrid grid(points);
 
     qint32 i, j, jNext = 0;
     for (i = 0; i < count; ++i)
@@ -342,9 +494,11 @@ QVector<QPointF> VAbstractPiece::CheckLoops(const QVector<QPointF> &points)
         LoopIntersectType status = NoIntersection;
         const QLineF line1(points.at(i), points.at(i+1));
         // Because a path can contains several loops we will seek the last and only then remove the loop(s)
-        // That's why we parse from the end
-        for (j = count-1; j >= i+2; --j)
+        // That's why we parse from the end. Segments that can't touch line1 are skipped.
+        const QVector<qint32> candidates = grid.Candidates(i);
+        for (qint32 c = 0; c < candidates.size(); ++c)
         {
+            j = candidates.at(c);
             j == count-1 ? jNext = 0 : jNext = j+1;
             QLineF line2(points.at(j), points.at(jNext));
 
@@ -58,11 +58,141 @@
 #include <QPolygonF>
 #include <QRectF>
 #include <Qt>
+#include <algorithm>
 
 #include "vcontour_p.h"
 #include "vlayoutpiece.h"
 #include "../vmisc/vmath.h"
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ClipSegment Liang-Barsky clipping of the segment p1p2 by the rect. Returns false if no part of the segment is
+ * inside the rect.
+ */
+bool ClipSegment(const QPointF &p1, const QPointF &p2, const QRectF &rect, QPointF &start, QPointF &end)
+{
+    const qreal dx = p2.x() - p1.x();
+    const qreal dy = p2.y() - p1.y();
+    const qreal p[] = {-dx, dx, -dy, dy};
+    const qreal q[] = {p1.x() - rect.left(), rect.right() - p1.x(), p1.y() - rect.top(), rect.bottom() - p1.y()};
+
+    qreal t0 = 0;
+    qreal t1 = 1;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (p[i] == 0)
+        {
+            if (q[i] < 0)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        const qreal t = q[i] / p[i];
+        if (p[i] < 0)
+        {
+            t0 = qMax(t0, t);
+        }
+        else
+        {
+            t1 = qMin(t1, t);
+        }
+    }
+
+    if (t0 > t1)
+    {
+        return false;
+    }
+
+    // Keep points that leave the rect exactly on its side
+    start = t0 > 0 ? QPointF(qBound(rect.left(), p1.x() + t0 * dx, rect.right()),
+                             qBound(rect.top(), p1.y() + t0 * dy, rect.bottom())) : p1;
+    end = t1 < 1 ? QPointF(qBound(rect.left(), p1.x() + t1 * dx, rect.right()),
+                           qBound(rect.top(), p1.y() + t1 * dy, rect.bottom())) : p2;
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PerimeterPosition position of a point on the side of the rect. Goes clockwise from the top left corner, each
+ * side takes 1, so corners are at 0, 1, 2 and 3.
+ */
+qreal PerimeterPosition(const QPointF &p, const QRectF &rect)
+{
+    const qreal toLeft = qAbs(p.x() - rect.left());
+    const qreal toRight = qAbs(rect.right() - p.x());
+    const qreal toTop = qAbs(p.y() - rect.top());
+    const qreal toBottom = qAbs(rect.bottom() - p.y());
+    const qreal nearest = qMin(qMin(toLeft, toRight), qMin(toTop, toBottom));
+
+    if (nearest == toTop)
+    {
+        return (p.x() - rect.left()) / rect.width();
+    }
+    else if (nearest == toRight)
+    {
+        return 1 + (p.y() - rect.top()) / rect.height();
+    }
+    else if (nearest == toBottom)
+    {
+        return 2 + (rect.right() - p.x()) / rect.width();
+    }
+    return 3 + (rect.bottom() - p.y()) / rect.height();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AppendCorners go clockwise along sides of the rect from the point exit to the point entry, append corners
+ * between them.
+ */
+void AppendCorners(QVector<QPointF> &points, const QPointF &exit, const QPointF &entry, const QRectF &rect)
+{
+    const QPointF corners[] = {rect.topLeft(), rect.topRight(), rect.bottomRight(), rect.bottomLeft()};
+
+    const qreal from = PerimeterPosition(exit, rect);
+    qreal to = PerimeterPosition(entry, rect);
+    if (to < from)
+    {
+        to += 4;
+    }
+
+    for (int corner = qFloor(from) + 1; corner < to; ++corner)
+    {
+        points.append(corners[corner % 4]);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolygonWinding winding number of a closed polygon around the point. Uses the same ray to the right as
+ * VContour::IsInside().
+ */
+int PolygonWinding(const QVector<QPointF> &polygon, const QPointF &point)
+{
+    int winding = 0;
+    for (int i = 0; i < polygon.size(); ++i)
+    {
+        const QPointF &p1 = polygon.at(i);
+        const QPointF &p2 = polygon.at(i + 1 < polygon.size() ? i + 1 : 0);
+
+        const bool upward = p1.y() <= point.y() && p2.y() > point.y();
+        const bool downward = p2.y() <= point.y() && p1.y() > point.y();
+        if (upward || downward)
+        {
+            const qreal x = p1.x() + (point.y() - p1.y()) * (p2.x() - p1.x()) / (p2.y() - p1.y());
+            if (x > point.x())
+            {
+                winding += upward ? 1 : -1;
+            }
+        }
+    }
+    return winding;
+}
+}
+
 #ifdef Q_COMPILER_RVALUE_REFS
 VContour &VContour::operator=(VContour &&contour) Q_DECL_NOTHROW { Swap(contour); return *this; }
 #endif
@@ -104,6 +234,7 @@ VContour::~VContour()
 void VContour::SetContour(const QVector<QPointF> &contour)
 {
     d->globalContour = contour;
+    BuildEdgesIndex();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -336,13 +467,7 @@ const QPointF &VContour::at(int i) const
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VContour::BoundingRect() const
 {
-    QVector<QPointF> points = GetContour();
-    if (points.isEmpty())
-    {
-        return QRectF();
-    }
-    points.append(points.first());
-    return QPolygonF(points).boundingRect();
+    return d->boundingRect;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -362,6 +487,249 @@ QPainterPath VContour::ContourPath() const
     return path;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ContourPath return path of the global contour only inside clipRect. Inside the rect the filled area is the
+ * same as the area of the whole contour, but the path is much smaller to test.
+ *
+ * Only edges from the cells of the edges index under the rect are clipped. Between the clipped pieces the path goes
+ * along the sides of the rect, and whole loops around the rect fix the winding number the skipped edges had inside
+ * the rect.
+ */
+QPainterPath VContour::ContourPath(const QRectF &clipRect) const
+{
+    QPainterPath path;
+    path.setFillRule(Qt::WindingFill);
+
+    if (d->cells.isEmpty() || not d->boundingRect.intersects(clipRect))
+    {
+        return path;
+    }
+
+    QVector<int> edges;
+    const int lastColumn = CellColumn(clipRect.right());
+    const int lastRow = CellRow(clipRect.bottom());
+    for (int row = CellRow(clipRect.top()); row <= lastRow; ++row)
+    {
+        for (int column = CellColumn(clipRect.left()); column <= lastColumn; ++column)
+        {
+            edges += d->cells.at(row * d->columns + column);
+        }
+    }
+
+    // Keep the contour order, an edge can be registered in several cells
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    const int count = d->globalContour.count();
+    QVector<QPointF> starts;
+    QVector<QPointF> ends;
+    for (int i = 0; i < edges.size(); ++i)
+    {
+        const int edge = edges.at(i);
+        QPointF start;
+        QPointF end;
+        if (ClipSegment(d->globalContour.at(edge), d->globalContour.at(edge + 1 < count ? edge + 1 : 0), clipRect,
+                        start, end))
+        {
+            starts.append(start);
+            ends.append(end);
+        }
+    }
+
+    QVector<QPointF> points;
+    for (int i = 0; i < starts.size(); ++i)
+    {
+        const QPointF &previousEnd = ends.at((i > 0 ? i : starts.size()) - 1);
+        if (previousEnd != starts.at(i))
+        {
+            // The contour goes outside of the rect between the pieces
+            AppendCorners(points, previousEnd, starts.at(i), clipRect);
+        }
+        points.append(starts.at(i));
+        points.append(ends.at(i));
+    }
+
+    const QPointF center = clipRect.center();
+    const int winding = Winding(center) - PolygonWinding(points, center);
+
+    if (not points.isEmpty())
+    {
+        path.addPolygon(QPolygonF(points));
+        path.closeSubpath();
+    }
+
+    if (winding != 0)
+    {
+        QVector<QPointF> loop{clipRect.topLeft(), clipRect.topRight(), clipRect.bottomRight(), clipRect.bottomLeft()};
+        if (PolygonWinding(loop, center) != (winding > 0 ? 1 : -1))
+        {
+            std::reverse(loop.begin(), loop.end());
+        }
+
+        for (int i = 0; i < qAbs(winding); ++i)
+        {
+            path.addPolygon(QPolygonF(loop));
+            path.closeSubpath();
+        }
+    }
+
+    return path;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief HasEdgesIn check if any edge of the global contour may cross the rect. Uses the edges index, so only edges
+ * around the rect are checked.
+ */
+bool VContour::HasEdgesIn(const QRectF &rect) const
+{
+    if (d->cells.isEmpty() || not d->boundingRect.intersects(rect))
+    {
+        return false;
+    }
+
+    const int count = d->globalContour.count();
+    const int firstColumn = CellColumn(rect.left());
+    const int lastColumn = CellColumn(rect.right());
+    const int firstRow = CellRow(rect.top());
+    const int lastRow = CellRow(rect.bottom());
+
+    for (int row = firstRow; row <= lastRow; ++row)
+    {
+        for (int column = firstColumn; column <= lastColumn; ++column)
+        {
+            const QVector<int> &edges = d->cells.at(row * d->columns + column);
+            for (int i = 0; i < edges.size(); ++i)
+            {
+                const int edge = edges.at(i);
+                const QPointF &p1 = d->globalContour.at(edge);
+                const QPointF &p2 = d->globalContour.at(edge + 1 < count ? edge + 1 : 0);
+
+                if (qMax(p1.x(), p2.x()) >= rect.left() && qMin(p1.x(), p2.x()) <= rect.right() &&
+                    qMax(p1.y(), p2.y()) >= rect.top() && qMin(p1.y(), p2.y()) <= rect.bottom())
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsInside check if point is inside the global contour using the non-zero winding rule (same as
+ * ContourPath()).
+ */
+bool VContour::IsInside(const QPointF &point) const
+{
+    return Winding(point) != 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Winding winding number of the global contour around the point. Only edges in the cells to the right of the
+ * point are checked.
+ */
+int VContour::Winding(const QPointF &point) const
+{
+    if (d->cells.isEmpty() || not d->boundingRect.contains(point))
+    {
+        return 0;
+    }
+
+    const int count = d->globalContour.count();
+    const int row = CellRow(point.y());
+    int winding = 0;
+
+    for (int column = CellColumn(point.x()); column < d->columns; ++column)
+    {
+        const QVector<int> &edges = d->cells.at(row * d->columns + column);
+        for (int i = 0; i < edges.size(); ++i)
+        {
+            const int edge = edges.at(i);
+            const QPointF &p1 = d->globalContour.at(edge);
+            const QPointF &p2 = d->globalContour.at(edge + 1 < count ? edge + 1 : 0);
+
+            const bool upward = p1.y() <= point.y() && p2.y() > point.y();
+            const bool downward = p2.y() <= point.y() && p1.y() > point.y();
+            if (not upward && not downward)
+            {
+                continue;
+            }
+
+            const qreal x = p1.x() + (point.y() - p1.y()) * (p2.x() - p1.x()) / (p2.y() - p1.y());
+            // An edge can be registered in several cells, count it only in the cell where it crosses the ray.
+            if (x > point.x() && CellColumn(x) == column)
+            {
+                winding += upward ? 1 : -1;
+            }
+        }
+    }
+    return winding;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BuildEdgesIndex distribute edges of the global contour over a uniform grid. Called once for each new contour,
+ * so collision tests for all candidates of the next piece can look only at edges near the piece.
+ */
+void VContour::BuildEdgesIndex()
+{
+    d->cells.clear();
+    d->columns = 0;
+    d->rows = 0;
+
+    const QVector<QPointF> &points = d->globalContour;
+    if (points.isEmpty())
+    {
+        d->boundingRect = QRectF();
+        return;
+    }
+
+    d->boundingRect = QPolygonF(points).boundingRect();
+
+    // About one edge per cell on average, but not too many cells for a flat contour
+    const qreal area = d->boundingRect.width() * d->boundingRect.height();
+    const qreal longestSide = qMax(d->boundingRect.width(), d->boundingRect.height());
+    d->cellSize = qMax(qMax(qSqrt(area / points.count()), longestSide / (4 * points.count())), 1.0);
+    d->columns = qMax(qCeil(d->boundingRect.width() / d->cellSize), 1);
+    d->rows = qMax(qCeil(d->boundingRect.height() / d->cellSize), 1);
+    d->cells.resize(d->columns * d->rows);
+
+    const int count = points.count();
+    for (int i = 0; i < count; ++i)
+    {
+        const QPointF &p1 = points.at(i);
+        const QPointF &p2 = points.at(i + 1 < count ? i + 1 : 0);
+
+        const int lastColumn = CellColumn(qMax(p1.x(), p2.x()));
+        const int lastRow = CellRow(qMax(p1.y(), p2.y()));
+        for (int row = CellRow(qMin(p1.y(), p2.y())); row <= lastRow; ++row)
+        {
+            for (int column = CellColumn(qMin(p1.x(), p2.x())); column <= lastColumn; ++column)
+            {
+                d->cells[row * d->columns + column].append(i);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VContour::CellColumn(qreal x) const
+{
+    const int column = qFloor((x - d->boundingRect.left()) / d->cellSize);
+    return qBound(0, column, d->columns - 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VContour::CellRow(qreal y) const
+{
+    const int row = qFloor((y - d->boundingRect.top()) / d->cellSize);
+    return qBound(0, row, d->rows - 1);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VContour::AppendWhole(QVector<QPointF> &contour, const VLayoutPiece &detail, int detJ) const
 {
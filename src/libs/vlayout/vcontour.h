@@ -110,11 +110,20 @@ class VContour
     QRectF BoundingRect() const;
 
     QPainterPath ContourPath() const;
+    QPainterPath ContourPath(const QRectF &clipRect) const;
+
+    bool HasEdgesIn(const QRectF &rect) const;
+    bool IsInside(const QPointF &point) const;
 
 private:
     QSharedDataPointer<VContourData> d;
 
     void AppendWhole(QVector<QPointF> &contour, const VLayoutPiece &detail, int detJ) const;
+
+    void BuildEdgesIndex();
+    int  CellColumn(qreal x) const;
+    int  CellRow(qreal y) const;
+    int  Winding(const QPointF &point) const;
 };
 
 Q_DECLARE_TYPEINFO(VContour, Q_MOVABLE_TYPE);
@@ -54,6 +54,8 @@
 
 #include <QSharedData>
 #include <QPointF>
+#include <QRectF>
+#include <QVector>
 
 #include "../vmisc/diagnostic.h"
 
@@ -65,16 +67,19 @@ class VContourData : public QSharedData
 {
 public:
     VContourData()
-        :globalContour(QVector<QPointF>()), paperHeight(0), paperWidth(0), shift(0)
+        :globalContour(QVector<QPointF>()), paperHeight(0), paperWidth(0), shift(0), boundingRect(), cellSize(1),
+          columns(0), rows(0), cells()
     {}
 
     VContourData(int height, int width)
-        :globalContour(QVector<QPointF>()), paperHeight(height), paperWidth(width), shift(0)
+        :globalContour(QVector<QPointF>()), paperHeight(height), paperWidth(width), shift(0), boundingRect(),
+          cellSize(1), columns(0), rows(0), cells()
     {}
 
     VContourData(const VContourData &contour)
         :QSharedData(contour), globalContour(contour.globalContour), paperHeight(contour.paperHeight),
-          paperWidth(contour.paperWidth), shift(contour.shift)
+          paperWidth(contour.paperWidth), shift(contour.shift), boundingRect(contour.boundingRect),
+          cellSize(contour.cellSize), columns(contour.columns), rows(contour.rows), cells(contour.cells)
     {}
 
     ~VContourData() {}
@@ -90,6 +95,21 @@ class VContourData : public QSharedData
 
     quint32 shift;
 
+    /** @brief boundingRect bounding rect of the global contour. */
+    QRectF boundingRect;
+
+    /** @brief cellSize side of a square cell of the edges index. */
+    qreal cellSize;
+
+    int columns;
+    int rows;
+
+    /**
+     * @brief cells uniform grid over boundingRect, row by row. Each cell keeps indexes of edges whose bounding rect
+     * overlaps the cell. Edge i goes from point i to point i+1 (last edge closes the contour).
+     */
+    QVector<QVector<int>> cells;
+
 private:
     VContourData &operator=(const VContourData &) Q_DECL_EQ_DELETE;
 };
@@ -56,6 +56,8 @@
     #include <ciso646>
 #endif /* Q_CC_MSVC */
 
+#include <QMetaType>
+
 enum class LayoutErrors : char
 {
     NoError,
@@ -63,6 +65,7 @@ enum class LayoutErrors : char
     ProcessStoped,
     EmptyPaperError
 };
+Q_DECLARE_METATYPE(LayoutErrors)
 
 enum class BestFrom : char
 {
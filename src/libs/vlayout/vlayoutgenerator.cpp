@@ -53,13 +53,38 @@
 
 #include <QGraphicsRectItem>
 #include <QRectF>
-#include <QThreadPool>
+#include <QThread>
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
 #include "vlayoutpiece.h"
 #include "vlayoutpaper.h"
 
+namespace
+{
+/**
+ * @brief The LayoutWorker class runs VLayoutGenerator::Generate() outside of the GUI thread.
+ */
+class LayoutWorker : public QThread
+{
+public:
+    explicit LayoutWorker(VLayoutGenerator *generator)
+        : QThread(),
+          generator(generator)
+    {}
+
+protected:
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        generator->Generate();
+    }
+
+private:
+    Q_DISABLE_COPY(LayoutWorker)
+    VLayoutGenerator *generator;
+};
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutGenerator::VLayoutGenerator(QObject *parent)
     : QObject(parent),
@@ -85,12 +110,23 @@ VLayoutGenerator::VLayoutGenerator(QObject *parent)
       stripOptimizationEnabled(false),
       multiplier(1),
       stripOptimization(false),
-      textAsPaths(false)
-{}
+      textAsPaths(false),
+      headless(false),
+      worker(nullptr)
+{
+    // Signals cross the thread boundary when the generation runs in background
+    qRegisterMetaType<LayoutErrors>("LayoutErrors");
+    qRegisterMetaType<VLayoutPaper>("VLayoutPaper");
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutGenerator::~VLayoutGenerator()
 {
+    if (IsRunning())
+    {
+        Abort();
+    }
+    Wait();
     delete bank;
 }
 
@@ -165,6 +201,8 @@ void VLayoutGenerator::Generate()
             paper.SetRotate(rotate);
             paper.SetRotationIncrease(rotationIncrease);
             paper.SetSaveLength(saveLength);
+            // A worker thread has no events to process, waiting for the candidates can block
+            paper.SetHeadless(headless || QThread::currentThread() != thread());
             do
             {
                 const int index = bank->GetTiket();
@@ -192,6 +230,7 @@ void VLayoutGenerator::Generate()
             if (paper.Count() > 0)
             {
                 papers.append(paper);
+                emit PaperArranged(papers.size() - 1, paper);
             }
             else
             {
@@ -208,6 +247,11 @@ void VLayoutGenerator::Generate()
         return;
     }
 
+    if (stopGeneration.load())
+    {
+        state = LayoutErrors::ProcessStoped;
+    }
+
     if (stripOptimizationEnabled)
     {
         GatherPages();
@@ -221,12 +265,60 @@ void VLayoutGenerator::Generate()
     emit Finished();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GenerateInBackground runs Generate() in a worker thread and returns immediately.
+ *
+ * All signals are emitted from the worker thread, receivers that live in the GUI thread get them queued. Results
+ * can be read after Finished or Error was received. Call Wait() before reading them from any other thread.
+ */
+void VLayoutGenerator::GenerateInBackground()
+{
+    SCASSERT(not IsRunning())
+
+    delete worker;
+    worker = new LayoutWorker(this);
+    worker->start();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutGenerator::IsRunning() const
+{
+    return worker != nullptr && worker->isRunning();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Wait blocks until the background generation is over. Does nothing if it was not started.
+ */
+void VLayoutGenerator::Wait()
+{
+    if (worker != nullptr)
+    {
+        worker->wait();
+        delete worker;
+        worker = nullptr;
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 LayoutErrors VLayoutGenerator::State() const
 {
     return state;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsPaperStreamFinal return true if sheets sent by PaperArranged are the final result.
+ *
+ * Strip optimization and uniting pages rearrange the sheets after the last one is done. In that case streamed sheets
+ * are good for a preview only and the result must be taken after Finished.
+ */
+bool VLayoutGenerator::IsPaperStreamFinal() const
+{
+    return not stripOptimization && not unitePages;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QList<QGraphicsItem *> VLayoutGenerator::GetPapersItems() const
 {
@@ -264,8 +356,13 @@ QVector<QVector<VLayoutPiece> > VLayoutGenerator::getAllPieces() const
 void VLayoutGenerator::Abort()
 {
     stopGeneration.store(true);
+    if (IsRunning())
+    {
+        // The worker owns the state while running, it reports the stop itself
+        return;
+    }
     state = LayoutErrors::ProcessStoped;
-    QThreadPool::globalInstance()->clear();
+    // Don't clear the thread pool. Queued tasks see the stop flag, return immediately and release the paper's latch.
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -292,6 +389,22 @@ void VLayoutGenerator::SetTestAsPaths(bool value)
     textAsPaths = value;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutGenerator::IsHeadless() const
+{
+    return headless;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetHeadless in headless mode generation never processes application events while waiting for the candidate
+ * search. Use it when there is no GUI to keep responsive (console mode, tests).
+ */
+void VLayoutGenerator::SetHeadless(bool value)
+{
+    headless = value;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 quint8 VLayoutGenerator::GetMultiplier() const
 {
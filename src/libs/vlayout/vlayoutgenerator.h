@@ -66,10 +66,11 @@
 
 #include "vbank.h"
 #include "vlayoutdef.h"
+#include "vlayoutpaper.h"
 
 class QMarginsF;
 class QGraphicsItem;
-class VLayoutPaper;
+class QThread;
 
 class VLayoutGenerator :public QObject
 {
@@ -97,8 +98,12 @@ class VLayoutGenerator :public QObject
     void         SetShift(quint32 shift);
 
     void         Generate();
+    void         GenerateInBackground();
+    bool         IsRunning() const;
+    void         Wait();
 
     LayoutErrors State() const;
+    bool         IsPaperStreamFinal() const;
 
     Q_REQUIRED_RESULT QList<QGraphicsItem *> GetPapersItems() const;
     Q_REQUIRED_RESULT QList<QList<QGraphicsItem *>> getAllPieceItems() const;
@@ -129,9 +134,13 @@ class VLayoutGenerator :public QObject
     bool         IsTestAsPaths() const;
     void         SetTestAsPaths(bool value);
 
+    bool         IsHeadless() const;
+    void         SetHeadless(bool value);
+
 signals:
     void         Start();
     void         Arranged(int count);
+    void         PaperArranged(int index, const VLayoutPaper &paper);
     void         Error(const LayoutErrors &state);
     void         Finished();
 
@@ -158,6 +167,8 @@ public slots:
     quint8           multiplier;
     bool             stripOptimization;
     bool             textAsPaths;
+    bool             headless;
+    QThread         *worker;
 
     int                 PageHeight() const;
     int                 PageWidth() const;
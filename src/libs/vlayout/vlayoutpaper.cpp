@@ -61,18 +61,28 @@
 #include <QPointF>
 #include <QRect>
 #include <QRectF>
-#include <QThread>
+#include <QSemaphore>
 #include <QThreadPool>
 #include <QVector>
 #include <Qt>
 #include <QtAlgorithms>
 
+#include "../vmisc/vtrace.h"
 #include "vbestsquare.h"
 #include "vcontour.h"
 #include "vlayoutpiece.h"
 #include "vlayoutpaper_p.h"
 #include "vposition.h"
 
+namespace
+{
+/** @brief eventPumpInterval how long (ms) to wait for candidates before processing GUI events again. */
+const int eventPumpInterval = 50;
+
+/** @brief chunksPerThread how many chunks of candidate pairs to queue for each pool thread. */
+const int chunksPerThread = 4;
+}
+
 #ifdef Q_COMPILER_RVALUE_REFS
 VLayoutPaper &VLayoutPaper::operator=(VLayoutPaper &&paper) Q_DECL_NOTHROW { Swap(paper); return *this; }
 #endif
@@ -207,6 +217,18 @@ void VLayoutPaper::SetSaveLength(bool value)
     d->saveLength = value;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutPaper::IsHeadless() const
+{
+    return d->headless;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPaper::SetHeadless(bool value)
+{
+    d->headless = value;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPaper::SetPaperIndex(quint32 index)
 {
@@ -216,6 +238,7 @@ void VLayoutPaper::SetPaperIndex(quint32 index)
 //---------------------------------------------------------------------------------------------------------------------
 bool VLayoutPaper::arrangePiece(const VLayoutPiece &piece, std::atomic_bool &stop)
 {
+    V_TRACE_SCOPE("layout", "VLayoutPaper::arrangePiece");
     // First need set size of paper
     if (d->globalContour.GetHeight() <= 0 || d->globalContour.GetWidth() <= 0)
     {
@@ -256,10 +279,14 @@ bool VLayoutPaper::AddToSheet(const VLayoutPiece &piece, std::atomic_bool &stop)
     QThreadPool *thread_pool = QThreadPool::globalInstance();
     thread_pool->setExpiryTimeout(1000);
     QVector<VPosition *> threads;
+    QSemaphore finished; // Each task releases it once, acts as a latch for this round
+
+    // All tasks read the same contour. A local copy guarantees nobody detaches it while the round is running.
+    const VContour contour = d->globalContour;
 
     int pieceEdgesCount = 0;
 
-    if (d->globalContour.GetContour().isEmpty())
+    if (contour.GetContour().isEmpty())
     {
         pieceEdgesCount = piece.pieceEdgesCount();
     }
@@ -268,52 +295,61 @@ bool VLayoutPaper::AddToSheet(const VLayoutPiece &piece, std::atomic_bool &stop)
         pieceEdgesCount = piece.LayoutEdgesCount();
     }
 
-    for (int j=1; j <= d->globalContour.GlobalEdgesCount(); ++j)
+    const int pairsCount = contour.GlobalEdgesCount() * pieceEdgesCount;
+    QVector<VBestSquare> results(pairsCount, bestResult);
+
+    // Several chunks per thread let a thread that is done early pick up the work left in the queue.
+    const int chunksCount = qMin(pairsCount, qMax(1, thread_pool->maxThreadCount()) * chunksPerThread);
+    const quint32 frameStep = 3 + static_cast<quint32>(360/d->localRotationIncrease*2);
+
+    for (int chunk = 0; chunk < chunksCount; ++chunk)
+    {
+        const int begin = static_cast<int>(static_cast<qint64>(pairsCount) * chunk / chunksCount);
+        const int end = static_cast<int>(static_cast<qint64>(pairsCount) * (chunk + 1) / chunksCount);
+
+        VPosition *thread = new VPosition(contour, piece, pieceEdgesCount, begin, end, results.data(), &stop,
+                                          d->localRotate, d->localRotationIncrease, d->saveLength, &finished);
+        //Info for debug
+        #ifdef LAYOUT_DEBUG
+            thread->setPaperIndex(d->paperIndex);
+            thread->setFrame(d->frame + static_cast<quint32>(begin) * frameStep);
+            thread->setPieceCount(d->pieces.count());
+            thread->setPieces(d->pieces);
+        #endif
+
+        thread->setAutoDelete(false);
+        threads.append(thread);
+        thread_pool->start(thread);
+    }
+    d->frame = d->frame + static_cast<quint32>(pairsCount) * frameStep;
+
+    // Wait for done. Stopped tasks release the latch too, so we never leave while a task still uses the data.
+    if (d->headless)
+    {
+        finished.acquire(threads.size());
+    }
+    else
     {
-        for (int i=1; i<= pieceEdgesCount; ++i)
+        while (not finished.tryAcquire(threads.size(), eventPumpInterval))
         {
-            VPosition *thread = new VPosition(d->globalContour, j, piece, i, &stop, d->localRotate,
-                                              d->localRotationIncrease,
-                                              d->saveLength);
-            //Info for debug
-            #ifdef LAYOUT_DEBUG
-                thread->setPaperIndex(d->paperIndex);
-                thread->setFrame(d->frame);
-                thread->setPieceCount(d->pieces.count());
-                thread->setPieces(d->pieces);
-            #endif
-
-            thread->setAutoDelete(false);
-            threads.append(thread);
-            thread_pool->start(thread);
-
-            d->frame = d->frame + 3 + static_cast<quint32>(360/d->localRotationIncrease*2);
+            QCoreApplication::processEvents();
         }
     }
 
-    // Wait for done
-    do
-    {
-        QCoreApplication::processEvents();
-        QThread::msleep(250);
-    }
-    while(thread_pool->activeThreadCount() > 0 && not stop.load());
+    qDeleteAll(threads.begin(), threads.end());
+    threads.clear();
 
     if (stop.load())
     {
-        qDeleteAll(threads.begin(), threads.end());
-        threads.clear();
         return false;
     }
 
-    for (int i=0; i < threads.size(); ++i)
+    // VBestSquare::NewResult is order sensitive, so reduce per pair results in the same order they were created.
+    for (int i=0; i < results.size(); ++i)
     {
-        bestResult.NewResult(threads.at(i)->getBestResult());
+        bestResult.NewResult(results.at(i));
     }
 
-    qDeleteAll(threads.begin(), threads.end());
-    threads.clear();
-
     return SaveResult(bestResult, piece);
 }
 
@@ -54,6 +54,7 @@
 #define VLAYOUTPAPER_H
 
 #include <qcompilerdetection.h>
+#include <QMetaType>
 #include <QSharedDataPointer>
 #include <QTypeInfo>
 #include <QtGlobal>
@@ -107,6 +108,9 @@ class VLayoutPaper
     bool    IsSaveLength() const;
     void    SetSaveLength(bool value);
 
+    bool    IsHeadless() const;
+    void    SetHeadless(bool value);
+
     void    SetPaperIndex(quint32 index);
 
     bool    arrangePiece(const VLayoutPiece &piece, std::atomic_bool &stop);
@@ -126,5 +130,6 @@ class VLayoutPaper
 };
 
 Q_DECLARE_TYPEINFO(VLayoutPaper, Q_MOVABLE_TYPE);
+Q_DECLARE_METATYPE(VLayoutPaper)
 
 #endif // VLAYOUTPAPER_H
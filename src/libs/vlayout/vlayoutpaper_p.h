@@ -77,7 +77,8 @@ class VLayoutPaperData : public QSharedData
           localRotate(true),
           globalRotationIncrease(180),
           localRotationIncrease(180),
-          saveLength(false)
+          saveLength(false),
+          headless(false)
     {}
 
     VLayoutPaperData(int height, int width)
@@ -90,7 +91,8 @@ class VLayoutPaperData : public QSharedData
           localRotate(true),
           globalRotationIncrease(180),
           localRotationIncrease(180),
-          saveLength(false)
+          saveLength(false),
+          headless(false)
     {}
 
     VLayoutPaperData(const VLayoutPaperData &paper)
@@ -104,7 +106,8 @@ class VLayoutPaperData : public QSharedData
           localRotate(paper.localRotate),
           globalRotationIncrease(paper.globalRotationIncrease),
           localRotationIncrease(paper.localRotationIncrease),
-          saveLength(paper.saveLength)
+          saveLength(paper.saveLength),
+          headless(paper.headless)
     {}
 
     ~VLayoutPaperData() {}
@@ -124,6 +127,9 @@ class VLayoutPaperData : public QSharedData
     int      localRotationIncrease;
     bool     saveLength;
 
+    /** @brief headless never pump the event loop while waiting for candidates. */
+    bool     headless;
+
 private:
     VLayoutPaperData& operator=(const VLayoutPaperData&) Q_DECL_EQ_DELETE;
 };
@@ -465,13 +465,15 @@ VLayoutPiece VLayoutPiece::Create(const VPiece &piece, const VContainer *pattern
 // cppcheck-suppress unusedFunction
 QVector<QPointF> VLayoutPiece::getContourPoints() const
 {
-    return Map(d->contour);
+    updateCache();
+    return d->mappedContour;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPiece::SetCountourPoints(const QVector<QPointF> &points, bool hideMainPath)
 {
     d->contour = RemoveDublicates(points, false);
+    d->ResetCache();
     setHideSeamLine(hideMainPath);
 }
 
@@ -479,7 +481,8 @@ void VLayoutPiece::SetCountourPoints(const QVector<QPointF> &points, bool hideMa
 // cppcheck-suppress unusedFunction
 QVector<QPointF> VLayoutPiece::GetSeamAllowancePoints() const
 {
-    return Map(d->seamAllowance);
+    updateCache();
+    return d->mappedSeamAllowance;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -490,6 +493,7 @@ void VLayoutPiece::setSeamAllowancePoints(const QVector<QPointF> &points, bool s
         SetSeamAllowance(seamAllowance);
         SetSeamAllowanceBuiltIn(seamAllowanceBuiltIn);
         d->seamAllowance = points;
+        d->ResetCache();
         if (not d->seamAllowance.isEmpty())
         {
             d->seamAllowance = RemoveDublicates(d->seamAllowance, false);
@@ -505,7 +509,8 @@ void VLayoutPiece::setSeamAllowancePoints(const QVector<QPointF> &points, bool s
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VLayoutPiece::getLayoutAllowancePoints() const
 {
-    return Map(d->layoutAllowance);
+    updateCache();
+    return d->mappedLayoutAllowance;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -697,6 +702,7 @@ QTransform VLayoutPiece::getTransform() const
 void VLayoutPiece::setTransform(const QTransform &transform)
 {
     d->transform = transform;
+    d->ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -717,6 +723,7 @@ void VLayoutPiece::Translate(qreal dx, qreal dy)
     QTransform m;
     m.translate(dx, dy);
     d->transform *= m;
+    d->ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -727,6 +734,7 @@ void VLayoutPiece::Rotate(const QPointF &originPoint, qreal degrees)
     m.rotate(-degrees);
     m.translate(-originPoint.x(), -originPoint.y());
     d->transform *= m;
+    d->ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -760,6 +768,7 @@ void VLayoutPiece::Mirror(const QLineF &edge)
     d->transform *= m;
 
     d->mirror = !d->mirror;
+    d->ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -777,50 +786,48 @@ int VLayoutPiece::LayoutEdgesCount() const
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VLayoutPiece::pieceEdge(int i) const
 {
-    return Edge(piecePath(), i);
+    return Edge(mappedPiecePath(), i);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VLayoutPiece::LayoutEdge(int i) const
 {
-    return Edge(d->layoutAllowance, i);
+    updateCache();
+    return Edge(d->mappedLayoutAllowance, i);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VLayoutPiece::pieceEdgeByPoint(const QPointF &p1) const
 {
-    return EdgeByPoint(piecePath(), p1);
+    return EdgeByPoint(mappedPiecePath(), p1);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VLayoutPiece::LayoutEdgeByPoint(const QPointF &p1) const
 {
-    return EdgeByPoint(d->layoutAllowance, p1);
+    updateCache();
+    return EdgeByPoint(d->mappedLayoutAllowance, p1);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VLayoutPiece::pieceBoundingRect() const
 {
-    QVector<QPointF> points;
+    updateCache();
     if (IsSeamAllowance() && not IsSeamAllowanceBuiltIn())
     {
-        points = GetSeamAllowancePoints();
+        return d->seamAllowanceRect;
     }
     else
     {
-        points = getContourPoints();
+        return d->contourRect;
     }
-
-    points.append(points.first());
-    return QPolygonF(points).boundingRect();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VLayoutPiece::LayoutBoundingRect() const
 {
-    QVector<QPointF> points = getLayoutAllowancePoints();
-    points.append(points.first());
-    return QPolygonF(points).boundingRect();
+    updateCache();
+    return d->layoutAllowanceRect;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -890,6 +897,8 @@ void VLayoutPiece::SetLayoutAllowancePoints()
     {
         d->layoutAllowance.clear();
     }
+    // Reset after assignment, computing the allowance above fills the cache with the previous one.
+    d->ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1242,6 +1251,53 @@ QVector<QPointF> VLayoutPiece::piecePath() const
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+const QVector<QPointF> &VLayoutPiece::mappedPiecePath() const
+{
+    updateCache();
+    if (IsSeamAllowance() && not IsSeamAllowanceBuiltIn())
+    {
+        return d->mappedSeamAllowance;
+    }
+    else
+    {
+        return d->mappedContour;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateCache map contour, seam allowance and layout allowance by the current transform once, so layout loops
+ * read ready arrays instead of mapping points on each call.
+ */
+void VLayoutPiece::updateCache() const
+{
+    if (d->cacheValid.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    QMutexLocker locker(&d->cacheMutex);
+    if (d->cacheValid.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    auto BoundingRect = [](const QVector<QPointF> &points)
+    {
+        return points.isEmpty() ? QRectF() : QPolygonF(points).boundingRect();
+    };
+
+    d->mappedContour = Map(d->contour);
+    d->contourRect = BoundingRect(d->mappedContour);
+    d->mappedSeamAllowance = Map(d->seamAllowance);
+    d->seamAllowanceRect = BoundingRect(d->mappedSeamAllowance);
+    d->mappedLayoutAllowance = Map(d->layoutAllowance);
+    d->layoutAllowanceRect = BoundingRect(d->mappedLayoutAllowance);
+
+    d->cacheValid.store(true, std::memory_order_release);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QGraphicsPathItem *VLayoutPiece::createMainItem() const
 {
@@ -1319,10 +1375,15 @@ bool VLayoutPiece::isMirror() const
 void VLayoutPiece::SetMirror(bool value)
 {
     d->mirror = value;
+    d->ResetCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const
+/**
+ * @brief Edge return edge of already mapped path. Mapped path of a mirrored piece is reversed, so edges keep the same
+ * direction as on the screen.
+ */
+QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i)
 {
     if (i < 1 || i > path.count())
     { // Doesn't exist such edge
@@ -1341,22 +1402,11 @@ QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const
         i2 = 0;
     }
 
-    if (d->mirror)
-    {
-        const int oldI1 = i1;
-        const int size = path.size()-1; //-V807
-        i1 = size - i2;
-        i2 = size - oldI1;
-        return QLineF(d->transform.map(path.at(i2)), d->transform.map(path.at(i1)));
-    }
-    else
-    {
-        return QLineF(d->transform.map(path.at(i1)), d->transform.map(path.at(i2)));
-    }
+    return QLineF(path.at(i1), path.at(i2));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const
+int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1)
 {
     if (p1.isNull())
     {
@@ -1368,10 +1418,9 @@ int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) c
         return 0;
     }
 
-    const QVector<QPointF> points = Map(path);
-    for (int i=0; i < points.size(); i++)
+    for (int i=0; i < path.size(); i++)
     {
-        if (points.at(i) == p1)
+        if (path.at(i) == p1)
         {
             return i+1;
         }
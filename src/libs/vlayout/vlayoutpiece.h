@@ -169,6 +169,8 @@ class VLayoutPiece :public VAbstractPiece
     QSharedDataPointer<VLayoutPieceData> d;
 
     QVector<QPointF>                     piecePath() const;
+    const QVector<QPointF>              &mappedPiecePath() const;
+    void                                 updateCache() const;
 
     Q_REQUIRED_RESULT QGraphicsPathItem *createMainItem() const;
     void                                 createAllowanceItem(QGraphicsItem *parent) const;
@@ -184,8 +186,8 @@ class VLayoutPiece :public VAbstractPiece
     template <class T>
     QVector<T>                           Map(const QVector<T> &points) const;
 
-    QLineF                               Edge(const QVector<QPointF> &path, int i) const;
-    int                                  EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const;
+    static QLineF                        Edge(const QVector<QPointF> &path, int i);
+    static int                           EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1);
 };
 
 Q_DECLARE_TYPEINFO(VLayoutPiece, Q_MOVABLE_TYPE);
@@ -54,9 +54,12 @@
 #define VLAYOUTDETAIL_P_H
 
 #include <QSharedData>
+#include <QMutex>
 #include <QPointF>
+#include <QRectF>
 #include <QVector>
 #include <QTransform>
+#include <atomic>
 
 #include "../vpatterndb/floatItemData/vpiecelabeldata.h"
 #include "../vpatterndb/floatItemData/vpatternlabeldata.h"
@@ -87,7 +90,20 @@ class VLayoutPieceData : public QSharedData
           patternInfo(),
           grainlinePoints(),
           m_tmPiece(),
-          m_tmPattern()
+          m_tmPattern(),
+          cacheMutex(),
+#ifdef Q_CC_MSVC
+          // See https://stackoverflow.com/questions/15750917/initializing-stdatomic-bool
+          cacheValid(ATOMIC_VAR_INIT(false)),
+#else
+          cacheValid(false),
+#endif
+          mappedContour(),
+          mappedSeamAllowance(),
+          mappedLayoutAllowance(),
+          contourRect(),
+          seamAllowanceRect(),
+          layoutAllowanceRect()
     {}
 
     VLayoutPieceData(const VLayoutPieceData &piece)
@@ -105,7 +121,21 @@ class VLayoutPieceData : public QSharedData
           patternInfo(piece.patternInfo),
           grainlinePoints(piece.grainlinePoints),
           m_tmPiece(piece.m_tmPiece),
-          m_tmPattern(piece.m_tmPattern)
+          m_tmPattern(piece.m_tmPattern),
+          cacheMutex(),
+          // Other threads may be filling the cache of the source right now, a copy always starts with an empty one.
+#ifdef Q_CC_MSVC
+          // See https://stackoverflow.com/questions/15750917/initializing-stdatomic-bool
+          cacheValid(ATOMIC_VAR_INIT(false)),
+#else
+          cacheValid(false),
+#endif
+          mappedContour(),
+          mappedSeamAllowance(),
+          mappedLayoutAllowance(),
+          contourRect(),
+          seamAllowanceRect(),
+          layoutAllowanceRect()
     {}
 
     ~VLayoutPieceData() {}
@@ -125,6 +155,22 @@ class VLayoutPieceData : public QSharedData
     VTextManager               m_tmPiece;          //! @brief m_tmPiece text manager for laying out piece info
     VTextManager               m_tmPattern;        //! @brief m_tmPattern text manager for laying out pattern info */
 
+    /**
+     * Cache of geometry mapped by transform. Filled lazily on the first read, reset only when transform, mirror or
+     * source points change. Several layout threads read the same piece, so filling is guarded by cacheMutex and
+     * cacheValid publishes the result.
+     */
+    void ResetCache() { cacheValid.store(false); }
+
+    mutable QMutex             cacheMutex;
+    mutable std::atomic_bool   cacheValid;
+    mutable QVector<QPointF>   mappedContour;
+    mutable QVector<QPointF>   mappedSeamAllowance;
+    mutable QVector<QPointF>   mappedLayoutAllowance;
+    mutable QRectF             contourRect;
+    mutable QRectF             seamAllowanceRect;
+    mutable QRectF             layoutAllowanceRect;
+
 private:
     VLayoutPieceData &operator=(const VLayoutPieceData &) Q_DECL_EQ_DELETE;
 };
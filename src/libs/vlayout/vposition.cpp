@@ -63,6 +63,7 @@
 #include <QPolygonF>
 #include <QRect>
 #include <QRectF>
+#include <QSemaphore>
 #include <QSizeF>
 #include <QStaticStringData>
 #include <QString>
@@ -74,19 +75,26 @@
 #include "../vmisc/vmath.h"
 
 //---------------------------------------------------------------------------------------------------------------------
-VPosition::VPosition(const VContour &gContour, int j, const VLayoutPiece &piece, int i, std::atomic_bool *stop,
-                     bool rotate, int rotationIncrease, bool saveLength)
+VPosition::VPosition(const VContour &gContour, const VLayoutPiece &piece, int pieceEdgesCount, int begin, int end,
+                     VBestSquare *results, std::atomic_bool *stop, bool rotate, int rotationIncrease, bool saveLength,
+                     QSemaphore *finished)
     : QRunnable(),
       bestResult(VBestSquare(gContour.GetSize(), saveLength)),
       gContour(gContour),
       piece(piece),
-      i(i),
-      j(j),
+      pieceEdgesCount(pieceEdgesCount),
+      begin(begin),
+      end(end),
+      results(results),
+      saveLength(saveLength),
+      i(0),
+      j(0),
       paperIndex(0),
       frame(0),
       piecesCount(0),
       pieces(),
       stop(stop),
+      finished(finished),
       rotate(rotate),
       rotationIncrease(rotationIncrease),
       angle_between(0)
@@ -99,6 +107,37 @@ VPosition::VPosition(const VContour &gContour, int j, const VLayoutPiece &piece,
 
 //---------------------------------------------------------------------------------------------------------------------
 void VPosition::run()
+{
+    const quint32 frameStep = 3 + static_cast<quint32>(360/rotationIncrease*2);
+    const quint32 startFrame = frame;
+
+    for (int index = begin; index < end; ++index)
+    {
+        if (stop->load())
+        {
+            break;
+        }
+
+        // Pairs are numbered row by row: all piece edges for the first global edge, then for the second one, etc.
+        j = index / pieceEdgesCount + 1;
+        i = index % pieceEdgesCount + 1;
+        frame = startFrame + static_cast<quint32>(index - begin) * frameStep;
+        angle_between = 0;
+        bestResult = VBestSquare(gContour.GetSize(), saveLength);
+
+        FindBestPosition();
+
+        results[index] = bestResult;
+    }
+
+    if (finished != nullptr)
+    {
+        finished->release();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPosition::FindBestPosition()
 {
     if (stop->load())
     {
@@ -179,12 +218,6 @@ void VPosition::setPieces(const QVector<VLayoutPiece> &pieces)
     this->pieces = pieces;
 }
 
-//---------------------------------------------------------------------------------------------------------------------
-VBestSquare VPosition::getBestResult() const
-{
-    return bestResult;
-}
-
 //---------------------------------------------------------------------------------------------------------------------
 void VPosition::DrawDebug(const VContour &contour, const VLayoutPiece &piece, int frame, quint32 paperIndex,
                           int piecesCount, const QVector<VLayoutPiece> &pieces)
@@ -414,13 +447,24 @@ bool VPosition::CheckRotationEdges(VLayoutPiece &piece, int j, int dEdge, int an
 VPosition::CrossingType VPosition::Crossing(const VLayoutPiece &piece) const
 {
     const QRectF gRect = gContour.BoundingRect();
-    if (not gRect.intersects(piece.LayoutBoundingRect()) && not gRect.contains(piece.pieceBoundingRect()))
+    const QRectF layoutRect = piece.LayoutBoundingRect();
+    const QRectF pieceRect = piece.pieceBoundingRect();
+    if (not gRect.intersects(layoutRect) && not gRect.contains(pieceRect))
     {
         // This we can determine efficiently.
         return CrossingType::NoIntersection;
     }
 
-    const QPainterPath gPath = gContour.ContourPath();
+    // Only the part of the global contour around the piece matters. The margin keeps clip edges away from the piece.
+    const qreal margin = 2;
+    const QRectF area = layoutRect.united(pieceRect).adjusted(-margin, -margin, margin, margin);
+    if (not gContour.HasEdgesIn(area))
+    {
+        // No edge crosses the area, so the piece is whole inside the global contour or whole outside.
+        return gContour.IsInside(area.center()) ? CrossingType::Intersection : CrossingType::NoIntersection;
+    }
+
+    const QPainterPath gPath = gContour.ContourPath(area);
     if (not gPath.intersects(piece.LayoutAllowancePath()) && not gPath.contains(piece.createMainPath()))
     {
         return CrossingType::NoIntersection;
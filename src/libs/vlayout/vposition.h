@@ -64,11 +64,14 @@
 #include "vlayoutdef.h"
 #include "vlayoutpiece.h"
 
+class QSemaphore;
+
 class VPosition : public QRunnable
 {
 public:
-    VPosition(const VContour &gContour, int j, const VLayoutPiece &piece, int i, std::atomic_bool *stop, bool rotate,
-              int rotationIncrease, bool saveLength);
+    VPosition(const VContour &gContour, const VLayoutPiece &piece, int pieceEdgesCount, int begin, int end,
+              VBestSquare *results, std::atomic_bool *stop, bool rotate, int rotationIncrease, bool saveLength,
+              QSemaphore *finished = nullptr);
     virtual ~VPosition() Q_DECL_OVERRIDE{}
 
     quint32 getPaperIndex() const;
@@ -82,8 +85,6 @@ class VPosition : public QRunnable
 
     void setPieces(const QVector<VLayoutPiece> &pieces);
 
-    VBestSquare getBestResult() const;
-
     static void DrawDebug(const VContour &contour, const VLayoutPiece &piece, int frame, quint32 paperIndex,
                           int piecesCount, const QVector<VLayoutPiece> &pieces = QVector<VLayoutPiece>());
 
@@ -92,8 +93,17 @@ class VPosition : public QRunnable
 private:
     Q_DISABLE_COPY(VPosition)
     VBestSquare bestResult;
-    const VContour gContour;
-    const VLayoutPiece piece;
+    /** @brief gContour shared by all tasks of a placement round, the paper keeps it alive until the round ends. */
+    const VContour &gContour;
+    const VLayoutPiece &piece;
+    int pieceEdgesCount;
+    /** @brief begin first (global edge × piece edge) pair index of the chunk. */
+    int begin;
+    /** @brief end one past the last pair index of the chunk. */
+    int end;
+    /** @brief results one slot per pair, a task writes only its own range. */
+    VBestSquare *results;
+    bool saveLength;
     int i;
     int j;
     quint32 paperIndex;
@@ -101,6 +111,11 @@ class VPosition : public QRunnable
     quint32 piecesCount;
     QVector<VLayoutPiece> pieces;
     std::atomic_bool *stop;
+    /**
+     * @brief finished released once when the task is done, even if it was stopped. Serves as a latch for a whole
+     * placement round.
+     */
+    QSemaphore *finished;
     bool rotate;
     int rotationIncrease;
     /**
@@ -124,6 +139,8 @@ class VPosition : public QRunnable
 
     virtual void run() Q_DECL_OVERRIDE;
 
+    void FindBestPosition();
+
     void SaveCandidate(VBestSquare &bestResult, const VLayoutPiece &piece, int globalI, int detJ, BestFrom type);
 
     bool CheckCombineEdges(VLayoutPiece &piece, int j, int &dEdge);
@@ -112,6 +112,14 @@ const QString SINGLE_OPTION_GROUPPING       = QStringLiteral("g");
 const QString LONG_OPTION_TEST              = QStringLiteral("test");
 const QString SINGLE_OPTION_TEST            = QStringLiteral("t");
 
+const QString LONG_OPTION_TRACE             = QStringLiteral("trace");
+
+const QString LONG_OPTION_TEST_VARIABLE     = QStringLiteral("testVariable");
+
+const QString LONG_OPTION_TEST_DATA         = QStringLiteral("testData");
+
+const QString LONG_OPTION_TEST_HEADLESS     = QStringLiteral("testHeadless");
+
 const QString LONG_OPTION_GRADATIONSIZE     = QStringLiteral("gsize");
 const QString SINGLE_OPTION_GRADATIONSIZE   = QStringLiteral("x");
 
@@ -155,6 +163,10 @@ QStringList AllKeys()
          << LONG_OPTION_GAPWIDTH << SINGLE_OPTION_GAPWIDTH
          << LONG_OPTION_GROUPPING << SINGLE_OPTION_GROUPPING
          << LONG_OPTION_TEST << SINGLE_OPTION_TEST
+         << LONG_OPTION_TRACE
+         << LONG_OPTION_TEST_VARIABLE
+         << LONG_OPTION_TEST_DATA
+         << LONG_OPTION_TEST_HEADLESS
          << LONG_OPTION_GRADATIONSIZE << SINGLE_OPTION_GRADATIONSIZE
          << LONG_OPTION_GRADATIONHEIGHT << SINGLE_OPTION_GRADATIONHEIGHT
          << LONG_OPTION_IGNORE_MARGINS << SINGLE_OPTION_IGNORE_MARGINS
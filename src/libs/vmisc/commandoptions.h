@@ -109,6 +109,14 @@ extern const QString SINGLE_OPTION_GROUPPING;
 extern const QString LONG_OPTION_TEST;
 extern const QString SINGLE_OPTION_TEST;
 
+extern const QString LONG_OPTION_TRACE;
+
+extern const QString LONG_OPTION_TEST_VARIABLE;
+
+extern const QString LONG_OPTION_TEST_DATA;
+
+extern const QString LONG_OPTION_TEST_HEADLESS;
+
 extern const QString LONG_OPTION_GRADATIONSIZE;
 extern const QString SINGLE_OPTION_GRADATIONSIZE;
 
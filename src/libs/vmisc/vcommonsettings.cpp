@@ -228,6 +228,9 @@ const QString settingLabelUserTimeFormats                = QStringLiteral("label
 
 int pointNameSize = 0;
 
+VSceneSettings sceneSettings;
+bool sceneSettingsValid = false;
+
 //---------------------------------------------------------------------------------------------------------------------
 QStringList ClearFormats(const QStringList &predefinedFormats, QStringList formats)
 {
@@ -337,6 +340,29 @@ VCommonSettings::VCommonSettings(Format format, Scope scope, const QString &orga
     :QSettings(format, scope, organization, application, parent)
 {}
 
+//---------------------------------------------------------------------------------------------------------------------
+VSceneSettings::VSceneSettings()
+    : pointNameColor(),
+      pointNameHoverColor(),
+      pointNameFontFamily(),
+      pointNameSize(32),
+      hidePointNames(true),
+      useToolColor(false),
+      wireframe(false),
+      showSeamAllowances(true),
+      cutColor(),
+      cutLinetype(),
+      cutLineweight(0),
+      seamColor(),
+      seamLinetype(),
+      seamLineweight(0),
+      internalLineweight(0),
+      notchColor(),
+      labelColor(),
+      grainlineColor(),
+      grainlineLineweight(0)
+{}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::SharePath(const QString &shareItem)
 {
@@ -1020,6 +1046,7 @@ QString VCommonSettings::getPointNameColor() const
 void VCommonSettings::setPointNameColor(const QString &value)
 {
     setValue(settingGraphicsViewPointNameColor, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1032,6 +1059,7 @@ QString VCommonSettings::getPointNameHoverColor() const
 void VCommonSettings::setPointNameHoverColor(const QString &value)
 {
     setValue(settingGraphicsViewPointNameHoverColor, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1534,6 +1562,7 @@ QString VCommonSettings::getDefaultNotchColor() const
 void VCommonSettings::setDefaultNotchColor(const QString &value)
 {
     setValue(settingDefaultNotchColor, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1683,6 +1712,7 @@ QString VCommonSettings::getDefaultSeamColor() const
 void VCommonSettings::setDefaultSeamColor(const QString &value)
 {
     setValue(settingDefaultSeamColor, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1695,6 +1725,7 @@ QString VCommonSettings::getDefaultSeamLinetype() const
 void VCommonSettings::setDefaultSeamLinetype(const QString &value)
 {
     setValue(settingDefaultSeamLinetype, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1707,6 +1738,7 @@ qreal VCommonSettings::getDefaultSeamLineweight() const
 void VCommonSettings::setDefaultSeamLineweight(const qreal &value)
 {
     setValue(settingDefaultSeamLineweight, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1719,6 +1751,7 @@ QString VCommonSettings::getDefaultCutColor() const
 void VCommonSettings::setDefaultCutColor(const QString &value)
 {
     setValue(settingDefaultCutColor, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1731,6 +1764,7 @@ QString VCommonSettings::getDefaultCutLinetype() const
 void VCommonSettings::setDefaultCutLinetype(const QString &value)
 {
     setValue(settingDefaultCutLinetype, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1743,6 +1777,7 @@ qreal VCommonSettings::getDefaultCutLineweight() const
 void VCommonSettings::setDefaultCutLineweight(const qreal &value)
 {
     setValue(settingDefaultCutLineweight, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1779,6 +1814,7 @@ qreal VCommonSettings::getDefaultInternalLineweight() const
 void VCommonSettings::setDefaultInternalLineweight(const qreal &value)
 {
     setValue(settingDefaultInternalLineweight, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1827,6 +1863,7 @@ bool VCommonSettings::showSeamAllowances() const
 void VCommonSettings::setShowSeamAllowances(const bool &value)
 {
     setValue(settingShowSeamAllowances, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1887,6 +1924,7 @@ QString VCommonSettings::getDefaultGrainlineColor() const
 void VCommonSettings::setDefaultGrainlineColor(const QString &value)
 {
     setValue(settingDefaultGrainlineColor, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1899,6 +1937,7 @@ qreal VCommonSettings::getDefaultGrainlineLineweight() const
 void VCommonSettings::setDefaultGrainlineLineweight(const qreal &value)
 {
     setValue(settingDefaultGrainlineLineweight, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1971,6 +2010,7 @@ QString VCommonSettings::getDefaultLabelColor() const
 void VCommonSettings::setDefaultLabelColor(const QString &value)
 {
     setValue(settingDefaultLabelColor, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2007,6 +2047,7 @@ QFont VCommonSettings::getPointNameFont() const
 void VCommonSettings::setPointNameFont(const QFont &f)
 {
     setValue(settingPatternPointNameFont, f);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2019,6 +2060,7 @@ bool VCommonSettings::getHidePointNames() const
 void VCommonSettings::setHidePointNames(bool value)
 {
     setValue(settingGraphicsViewHidePointNames, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2043,6 +2085,7 @@ bool VCommonSettings::isWireframe() const
 void VCommonSettings::setWireframe(bool value)
 {
     setValue(settingGraphicsViewWireframe, value);
+    sceneSettingsValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2079,6 +2122,44 @@ bool VCommonSettings::getUseToolColor() const
 void VCommonSettings::setUseToolColor(bool value)
 {
     setValue(settingGraphicsUseToolColor, value);
+    sceneSettingsValid = false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief getSceneSettings return settings scene items use in paint().
+ *
+ * The copy is read from QSettings once and again only after one of its settings was changed, e.g. when preferences
+ * are applied. Items are painted in the GUI thread, the same one that changes settings, so no lock is needed.
+ */
+const VSceneSettings &VCommonSettings::getSceneSettings() const
+{
+    if (not sceneSettingsValid)
+    {
+        sceneSettings.pointNameColor = QColor(getPointNameColor());
+        sceneSettings.pointNameHoverColor = QColor(getPointNameHoverColor());
+        sceneSettings.pointNameFontFamily = getPointNameFont().family();
+        sceneSettings.pointNameSize = getPointNameSize();
+        sceneSettings.hidePointNames = getHidePointNames();
+        sceneSettings.useToolColor = getUseToolColor();
+        sceneSettings.wireframe = isWireframe();
+        sceneSettings.showSeamAllowances = showSeamAllowances();
+
+        sceneSettings.cutColor = QColor(getDefaultCutColor());
+        sceneSettings.cutLinetype = getDefaultCutLinetype();
+        sceneSettings.cutLineweight = getDefaultCutLineweight();
+        sceneSettings.seamColor = QColor(getDefaultSeamColor());
+        sceneSettings.seamLinetype = getDefaultSeamLinetype();
+        sceneSettings.seamLineweight = getDefaultSeamLineweight();
+        sceneSettings.internalLineweight = getDefaultInternalLineweight();
+        sceneSettings.notchColor = QColor(getDefaultNotchColor());
+        sceneSettings.labelColor = QColor(getDefaultLabelColor());
+        sceneSettings.grainlineColor = QColor(getDefaultGrainlineColor());
+        sceneSettings.grainlineLineweight = getDefaultGrainlineLineweight();
+
+        sceneSettingsValid = true;
+    }
+    return sceneSettings;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2101,6 +2182,7 @@ void VCommonSettings::setPointNameSize(int value)
 {
     setValue(settingGraphicsViewPointNameSize, value);
     pointNameSize = value;
+    sceneSettingsValid = false;
 }
 
 int VCommonSettings::getGuiFontSize() const
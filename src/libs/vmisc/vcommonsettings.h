@@ -57,6 +57,7 @@
 #define VCOMMONSETTINGS_H
 
 #include <QByteArray>
+#include <QColor>
 #include <QMetaObject>
 #include <QObject>
 #include <QSettings>
@@ -67,6 +68,37 @@
 
 #include "../vlayout/vbank.h"
 
+/**
+ * @brief The VSceneSettings struct is a copy of settings scene items read on every repaint.
+ *
+ * Reading QSettings from paint() of thousands of items is slow, see VCommonSettings::getSceneSettings().
+ */
+struct VSceneSettings
+{
+    VSceneSettings();
+
+    QColor  pointNameColor;
+    QColor  pointNameHoverColor;
+    QString pointNameFontFamily;
+    int     pointNameSize;
+    bool    hidePointNames;
+    bool    useToolColor;
+    bool    wireframe;
+    bool    showSeamAllowances;
+
+    QColor  cutColor;
+    QString cutLinetype;
+    qreal   cutLineweight;
+    QColor  seamColor;
+    QString seamLinetype;
+    qreal   seamLineweight;
+    qreal   internalLineweight;
+    QColor  notchColor;
+    QColor  labelColor;
+    QColor  grainlineColor;
+    qreal   grainlineLineweight;
+};
+
 class VCommonSettings : public QSettings
 {
     Q_OBJECT
@@ -478,6 +510,8 @@ class VCommonSettings : public QSettings
     bool                 getUseToolColor() const;
     void                 setUseToolColor(bool value);
 
+    const VSceneSettings &getSceneSettings() const;
+
     int                  getGuiFontSize() const;
     void                 setGuiFontSize(int value);
 
@@ -10,6 +10,7 @@ SOURCES += \
     $$PWD/commandoptions.cpp \
     $$PWD/qxtcsvmodel.cpp \
     $$PWD/vtablesearch.cpp \
+    $$PWD/vtrace.cpp \
     $$PWD/dialogs/dialogexporttocsv.cpp \
     $$PWD/def.cpp
 
@@ -31,6 +32,7 @@ HEADERS += \
     $$PWD/commandoptions.h \
     $$PWD/qxtcsvmodel.h \
     $$PWD/vtablesearch.h \
+    $$PWD/vtrace.h \
     $$PWD/diagnostic.h \
     $$PWD/dialogs/dialogexporttocsv.h \
     $$PWD/customevents.h
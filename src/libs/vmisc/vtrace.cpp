@@ -0,0 +1,229 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "vtrace.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QVector>
+
+std::atomic_bool VTrace::enabled{false};
+
+namespace
+{
+// Protect memory on long GUI sessions, later spans are dropped
+const int maxTraceEvents = 2000000;
+
+struct TraceEvent
+{
+    const char *category;
+    const char *name;
+    qint64      start;
+    qint64      duration; // Value of a counter
+    int         thread;
+    bool        counter;
+};
+
+struct TraceData
+{
+    QMutex              mutex{};
+    QElapsedTimer       timer{};
+    QString             fileName{};
+    QVector<TraceEvent> events{};
+    int                 dropped{0};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+TraceData &Data()
+{
+    static TraceData data;
+    return data;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int ThreadNumber()
+{
+    // Short numbers read better in the viewer than native thread ids
+    static std::atomic_int counter{0};
+    thread_local const int number = ++counter;
+    return number;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray Escaped(const char *text)
+{
+    QByteArray escaped(text);
+    escaped.replace('\\', "\\\\");
+    escaped.replace('"', "\\\"");
+    return escaped;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AddEvent(const TraceEvent &event)
+{
+    TraceData &data = Data();
+    QMutexLocker locker(&data.mutex);
+    if (data.events.size() < maxTraceEvents)
+    {
+        data.events.append(event);
+    }
+    else
+    {
+        ++data.dropped;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SaveOnExit()
+{
+    if (not VTrace::Save())
+    {
+        qWarning("Can't write trace file %s.", qUtf8Printable(Data().fileName));
+    }
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Enable start recording spans. The trace is saved to the file when the application object is destroyed.
+ * @param fileName path to the trace file.
+ */
+void VTrace::Enable(const QString &fileName)
+{
+    TraceData &data = Data();
+    {
+        QMutexLocker locker(&data.mutex);
+        if (IsEnabled())
+        {
+            return;
+        }
+        data.fileName = fileName;
+        data.timer.start();
+    }
+    enabled.store(true);
+    qAddPostRoutine(SaveOnExit);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Now return time since tracing was enabled in microseconds.
+ */
+qint64 VTrace::Now()
+{
+    return Data().timer.nsecsElapsed() / 1000;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTrace::AddSpan(const char *category, const char *name, qint64 start, qint64 duration)
+{
+    TraceEvent event;
+    event.category = category;
+    event.name = name;
+    event.start = start;
+    event.duration = duration;
+    event.thread = ThreadNumber();
+    event.counter = false;
+
+    AddEvent(event);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddCounter record the value at the current time, e.g. memory taken by data. Does nothing if tracing is
+ * disabled.
+ */
+void VTrace::AddCounter(const char *category, const char *name, qint64 value)
+{
+    if (not IsEnabled())
+    {
+        return;
+    }
+
+    TraceEvent event;
+    event.category = category;
+    event.name = name;
+    event.start = Now();
+    event.duration = value;
+    event.thread = ThreadNumber();
+    event.counter = true;
+
+    AddEvent(event);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Save write recorded spans and counters in trace-event JSON format. Tracing stays enabled.
+ * @return false if tracing is disabled or the file could not be written.
+ */
+bool VTrace::Save()
+{
+    if (not IsEnabled())
+    {
+        return false;
+    }
+
+    TraceData &data = Data();
+    QMutexLocker locker(&data.mutex);
+
+    QFile file(data.fileName);
+    if (not file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    const QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+
+    file.write("{\"traceEvents\":[\n");
+    for (int i = 0; i < data.events.size(); ++i)
+    {
+        const TraceEvent &event = data.events.at(i);
+        QByteArray line;
+        line.reserve(160);
+        line += "{\"name\":\"" + Escaped(event.name) + "\",\"cat\":\"" + Escaped(event.category) + "\",";
+        if (event.counter)
+        {
+            line += "\"ph\":\"C\",\"ts\":" + QByteArray::number(event.start) +
+                    ",\"args\":{\"value\":" + QByteArray::number(event.duration) + '}';
+        }
+        else
+        {
+            line += "\"ph\":\"X\",\"ts\":" + QByteArray::number(event.start) +
+                    ",\"dur\":" + QByteArray::number(event.duration);
+        }
+        line += ",\"pid\":" + pid + ",\"tid\":" + QByteArray::number(event.thread) + '}';
+        if (i < data.events.size() - 1)
+        {
+            line += ',';
+        }
+        line += '\n';
+        file.write(line);
+    }
+    file.write("],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"droppedEvents\":");
+    file.write(QByteArray::number(data.dropped));
+    file.write("}}\n");
+
+    return file.error() == QFile::NoError;
+}
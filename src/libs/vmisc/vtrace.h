@@ -0,0 +1,92 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#ifndef VTRACE_H
+#define VTRACE_H
+
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+
+/**
+ * @brief The VTrace class records scoped spans in Chrome trace-event format.
+ *
+ * Tracing is compiled in but disabled by default, a disabled span costs one atomic load. When enabled spans
+ * are kept in memory and written to the file when the application quits. The file can be opened in chrome://tracing
+ * or Perfetto.
+ */
+class VTrace
+{
+public:
+    static void   Enable(const QString &fileName);
+    static bool   IsEnabled();
+    static qint64 Now();
+    static void   AddSpan(const char *category, const char *name, qint64 start, qint64 duration);
+    static void   AddCounter(const char *category, const char *name, qint64 value);
+    static bool   Save();
+
+private:
+    Q_DISABLE_COPY(VTrace)
+    static std::atomic_bool enabled;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline bool VTrace::IsEnabled()
+{
+    return enabled.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief The VTraceScope class records a span from construction to destruction. Use V_TRACE_SCOPE.
+ *
+ * Category and name must be string literals, only pointers are kept.
+ */
+class VTraceScope
+{
+public:
+    VTraceScope(const char *category, const char *name)
+        : category(category),
+          name(name),
+          start(VTrace::IsEnabled() ? VTrace::Now() : -1)
+    {}
+
+    ~VTraceScope()
+    {
+        if (start >= 0)
+        {
+            VTrace::AddSpan(category, name, start, VTrace::Now() - start);
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(VTraceScope)
+    const char *category;
+    const char *name;
+    qint64      start;
+};
+
+#define V_TRACE_CONCAT_IMPL(a, b) a##b
+#define V_TRACE_CONCAT(a, b) V_TRACE_CONCAT_IMPL(a, b)
+#define V_TRACE_SCOPE(category, name) const VTraceScope V_TRACE_CONCAT(vTraceScope, __LINE__)(category, name)
+
+#endif // VTRACE_H
@@ -3,14 +3,11 @@
 
 SOURCES += \
     $$PWD/vobjengine.cpp \
-    $$PWD/vobjpaintdevice.cpp \
-    $$PWD/delaunay.cpp \
-    $$PWD/predicates.cpp
+    $$PWD/vobjpaintdevice.cpp
 
 *msvc*:SOURCES += $$PWD/stable.cpp
 
 HEADERS += \
     $$PWD/vobjengine.h \
-    $$PWD/delaunay.h \
     $$PWD/vobjpaintdevice.h \
     $$PWD/stable.h
@@ -51,11 +51,14 @@
 
 #include "vobjengine.h"
 
+#include <algorithm>
+
 #include <QByteArray>
 #include <QFlag>
 #include <QFlags>
 #include <QIODevice>
 #include <QLatin1Char>
+#include <QList>
 #include <QMessageLogger>
 #include <QPaintEngineState>
 #include <QPainterPath>
@@ -97,6 +100,154 @@ QT_WARNING_DISABLE_INTEL(2022)
 QT_WARNING_POP
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Cross z component of (b - a) x (c - a), positive for a left turn in a right-handed system.
+ */
+static inline qreal Cross(const QPointF &a, const QPointF &b, const QPointF &c)
+{
+    return (b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief InsideTriangle check if the point is inside or on the border of the triangle a, b, c.
+ * @param orientation 1 if the triangle turns left, -1 otherwise.
+ */
+static inline bool InsideTriangle(const QPointF &p, const QPointF &a, const QPointF &b, const QPointF &c,
+                                  qreal orientation)
+{
+    return orientation * Cross(a, b, p) >= 0 && orientation * Cross(b, c, p) >= 0 && orientation * Cross(c, a, p) >= 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SignedArea doubled area of the polygon, positive if it turns left.
+ */
+static inline qreal SignedArea(const QPolygonF &polygon)
+{
+    qreal area = 0;
+    for (int i = 0; i < polygon.size(); ++i)
+    {
+        const QPointF &p1 = polygon.at(i);
+        const QPointF &p2 = polygon.at((i + 1) % polygon.size());
+        area += p1.x() * p2.y() - p2.x() * p1.y();
+    }
+    return area;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WindingNumber how many times the closed polygon goes around the point, positive if it turns left.
+ */
+static int WindingNumber(const QPolygonF &polygon, const QPointF &point)
+{
+    int winding = 0;
+    for (int i = 0; i < polygon.size(); ++i)
+    {
+        const QPointF &a = polygon.at(i);
+        const QPointF &b = polygon.at((i + 1) % polygon.size());
+        if (a.y() <= point.y())
+        {
+            if (b.y() > point.y() && Cross(a, b, point) > 0)
+            {
+                ++winding;
+            }
+        }
+        else if (b.y() <= point.y() && Cross(a, b, point) < 0)
+        {
+            --winding;
+        }
+    }
+    return winding;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LocallyInside check if the point is inside the corner of the left turning outline at the position.
+ */
+static bool LocallyInside(const QPolygonF &points, const QVector<int> &outline, int position, const QPointF &point)
+{
+    const int count = outline.size();
+    const QPointF &previous = points.at(outline.at((position + count - 1) % count));
+    const QPointF &corner = points.at(outline.at(position));
+    const QPointF &next = points.at(outline.at((position + 1) % count));
+
+    if (Cross(previous, corner, next) >= 0)
+    {
+        return Cross(previous, corner, point) >= 0 && Cross(corner, next, point) >= 0;
+    }
+    return Cross(previous, corner, point) >= 0 || Cross(corner, next, point) >= 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FindBridge find a point of the outline visible from the rightmost point of a hole.
+ *
+ * A ray to the right hits the nearest edge of the outline. Its right end is visible unless other points of the
+ * outline are inside the triangle of the ray, then the one with the smallest angle to the ray is visible.
+ * @return position in the outline or -1 if the ray hits nothing.
+ */
+static int FindBridge(const QPolygonF &points, const QVector<int> &outline, const QPointF &start)
+{
+    const int count = outline.size();
+    int edge = -1;
+    qreal hitX = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        const QPointF &a = points.at(outline.at(i));
+        const QPointF &b = points.at(outline.at((i + 1) % count));
+        if ((a.y() > start.y()) == (b.y() > start.y()))
+        {
+            continue;
+        }
+
+        const qreal x = a.x() + (start.y() - a.y()) * (b.x() - a.x()) / (b.y() - a.y());
+        if (x >= start.x() && (edge < 0 || x < hitX))
+        {
+            edge = i;
+            hitX = x;
+        }
+    }
+
+    if (edge < 0)
+    {
+        return -1;
+    }
+
+    const int next = (edge + 1) % count;
+    const int candidate = points.at(outline.at(edge)).x() > points.at(outline.at(next)).x() ? edge : next;
+    const QPointF hit(hitX, start.y());
+    const QPointF &end = points.at(outline.at(candidate));
+    const qreal orientation = Cross(start, hit, end) < 0 ? -1 : 1;
+
+    int bridge = -1;
+    qreal bestRise = 0;
+    qreal bestRun = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        const QPointF &p = points.at(outline.at(i));
+        if (p.x() < start.x() || not InsideTriangle(p, start, hit, end, orientation)
+            || not LocallyInside(points, outline, i, start))
+        {
+            continue;
+        }
+
+        // Compare tangents of angles to the ray without division, closer point wins on the same angle
+        const qreal rise = qAbs(p.y() - start.y());
+        const qreal run = p.x() - start.x();
+        if (bridge < 0 || rise * bestRun < bestRise * run
+            || (qFuzzyCompare(1 + rise * bestRun, 1 + bestRise * run) && run < bestRun))
+        {
+            bridge = i;
+            bestRise = rise;
+            bestRun = run;
+        }
+    }
+
+    return bridge < 0 ? candidate : bridge;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VObjEngine::VObjEngine()
     : QPaintEngine(svgEngineFeatures())
@@ -108,11 +259,6 @@ VObjEngine::VObjEngine()
     , resolution(96)
     , transform()
 {
-    for (int i=0; i < MAX_POINTS; i++)
-    {
-        points[i].x = 0;
-        points[i].y = 0;
-    }
 }
 
 #if defined(Q_CC_INTEL)
@@ -185,74 +331,70 @@ void VObjEngine::updateState(const QPaintEngineState &state)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief drawPath writes each filled shape of the path as vertices and triangle faces that index them.
+ *
+ * Subpaths are split into outer outlines and holes by the fill rule of the path, so counters of glyphs and cut outs
+ * stay empty. Overlapping subpaths are merged first.
+ */
 void VObjEngine::drawPath(const QPainterPath &path)
 {
-    QPolygonF polygon = path.toFillPolygon(transform);
-    polygon = MakePointsUnique(polygon);// Points must be unique
-    if (polygon.size() < 3)
+    QList<QPolygonF> subpaths = path.toSubpathPolygons(transform);
+    Qt::FillRule rule = path.fillRule();
+    if (subpaths.size() > 1)
     {
-        return;
+        const QPainterPath simplified = transform.map(path).simplified();
+        subpaths = simplified.toSubpathPolygons();
+        rule = simplified.fillRule();
     }
 
-    qint64 sq = Square(polygon);
-
-    ++planeCount;
-	*stream << "o Plane." << QString("%1").arg(planeCount, 3, 10, QLatin1Char('0')) << '\n';
-
-    quint32 num_points = 0;
-
-    for (int i=0; i < polygon.count(); i++)
+    QVector<QPolygonF> outlines;
+    outlines.reserve(subpaths.size());
+    for (int i = 0; i < subpaths.size(); ++i)
     {
-        if ( num_points < MAX_POINTS )
+        const QPolygonF outline = RemoveRepeatedPoints(subpaths.at(i));
+        if (outline.size() >= 3 && not qFuzzyIsNull(SignedArea(outline)))
         {
-            points[num_points].x = polygon.at(i).x();
-            points[num_points].y = polygon.at(i).y();
-            num_points++;
+            outlines.append(outline);
         }
     }
 
-    int offset = 0;
-    delaunay2d_t *res = delaunay2d_from(points, num_points);//Calculate faces
+    const QVector<QVector<int>> shapes = SplitOutlines(outlines, rule);
+    if (shapes.isEmpty())
+    {
+        return;
+    }
 
-    QPointF pf[MAX_POINTS];
-    bool skipFace=false;//Need skip first face
+    ++planeCount;
+    *stream << "o Plane." << QString("%1").arg(planeCount, 3, 10, QLatin1Char('0')) << '\n';
 
-    for (quint32 i = 0; i < res->num_faces; i++ )
+    for (int i = 0; i < shapes.size(); ++i)
     {
-        if (offset == 0)
-        {
-            skipFace=true;
-        }
-        else
+        // Outer outline turns left and holes turn right, the bridged outline keeps one orientation
+        const QVector<int> &shape = shapes.at(i);
+        QPolygonF points;
+        QVector<int> holes;
+        for (int j = 0; j < shape.size(); ++j)
         {
-            skipFace=false;
-        }
-        int num_verts = static_cast<int>(res->faces[offset]);
-        offset++;
-        for ( int j = 0; j < num_verts; j++ )
-        {
-            int p0 = static_cast<int>(res->faces[offset + j]);
-            pf[j] = QPointF(points[p0].x, points[p0].y);
-        }
-        if (skipFace == false )
-        {
-            QPolygonF face;
-            for ( int i = 0; i < num_verts; i++ )
+            QPolygonF outline = outlines.at(shape.at(j));
+            if ((SignedArea(outline) > 0) != (j == 0))
             {
-                face << QPointF(pf[i]);
+                std::reverse(outline.begin(), outline.end());
             }
-            QPolygonF united = polygon.united(face);
-            qint64 sqUnited = Square(united);
-            if (sqUnited <= sq)
-            {// This face incide our base polygon.
-                drawPolygon(pf, num_verts, QPaintEngine::OddEvenMode);
+
+            if (j > 0)
+            {
+                holes.append(points.size());
             }
+            points += outline;
         }
-        offset += num_verts;
+
+        const quint32 firstIndex = globalPointsCount + 1;
+        drawPoints(points.constData(), points.size());
+        WriteTriangles(points, BridgeHoles(points, holes), firstIndex);
     }
 
-    delaunay2d_release(res);//Don't forget release data
-	*stream << "s off\n";
+    *stream << "s off\n";
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -351,59 +493,317 @@ void VObjEngine::setResolution(int value)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QPolygonF VObjEngine::MakePointsUnique(const QPolygonF &polygon) const
+/**
+ * @brief RemoveRepeatedPoints drops points equal to the previous one and the closing point, the rest must stay in
+ * order for triangulation.
+ */
+QPolygonF VObjEngine::RemoveRepeatedPoints(const QPolygonF &polygon) const
 {
-    QVector<QPointF> set;
-    QPolygonF uniquePolygon;
-    for (int i=0; i < polygon.count(); i++)
+    QPolygonF outline;
+    outline.reserve(polygon.size());
+    for (int i = 0; i < polygon.size(); ++i)
     {
-        if (set.contains(polygon.at(i)) == false)
+        if (outline.isEmpty() || outline.last() != polygon.at(i))
         {
-            set.append(polygon.at(i));
-            uniquePolygon.append(polygon.at(i));
+            outline.append(polygon.at(i));
         }
     }
-    return uniquePolygon;
+
+    while (outline.size() > 1 && outline.first() == outline.last())
+    {
+        outline.removeLast();
+    }
+    return outline;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-qint64 VObjEngine::Square(const QPolygonF &poly) const
+/**
+ * @brief SplitOutlines groups outlines into shapes to fill, each is an outer outline followed by its holes.
+ *
+ * An outline is outer if the fill rule leaves the area around it empty and fills its inside, and a hole in the
+ * opposite case. Outlines that don't change the fill are left out. A hole belongs to the smallest outer outline
+ * around it.
+ * @param outlines closed outlines without repeated points.
+ * @param rule fill rule of the path.
+ * @return indexes of outlines of each shape.
+ */
+QVector<QVector<int>> VObjEngine::SplitOutlines(const QVector<QPolygonF> &outlines, Qt::FillRule rule) const
 {
-    QVector<qreal> x;
-    QVector<qreal> y;
+    auto Filled = [rule](int winding)
+    {
+        return rule == Qt::OddEvenFill ? winding % 2 != 0 : winding != 0;
+    };
 
-    int n = poly.count();
-    qreal s, res = 0;
-    qint64 sq = 0;
+    QVector<QRectF> bounds;
+    bounds.reserve(outlines.size());
+    for (int i = 0; i < outlines.size(); ++i)
+    {
+        bounds.append(outlines.at(i).boundingRect());
+    }
 
-    for (int i=0; i < n; i++)
+    auto Winding = [&outlines, &bounds](int i, const QPointF &point)
     {
-        x.append(poly.at(i).x());
-        y.append(poly.at(i).y());
+        return bounds.at(i).contains(point) ? WindingNumber(outlines.at(i), point) : 0;
+    };
+
+    QVector<QVector<int>> shapes;
+    QVector<int> holes;
+    for (int i = 0; i < outlines.size(); ++i)
+    {
+        const QPointF &sample = outlines.at(i).first();
+        int around = 0;
+        for (int j = 0; j < outlines.size(); ++j)
+        {
+            if (j != i)
+            {
+                around += Winding(j, sample);
+            }
+        }
+        const int inside = around + (SignedArea(outlines.at(i)) > 0 ? 1 : -1);
+
+        if (not Filled(around) && Filled(inside))
+        {
+            shapes.append(QVector<int>() << i);
+        }
+        else if (Filled(around) && not Filled(inside))
+        {
+            holes.append(i);
+        }
     }
 
-    // Calculation a polygon area through the sum of the areas of trapezoids
-    for (int i = 0; i < n; i++)
+    for (int i = 0; i < holes.size(); ++i)
     {
-        if (i == 0)
+        const QPointF &sample = outlines.at(holes.at(i)).first();
+        int owner = -1;
+        qreal ownerArea = 0;
+        for (int j = 0; j < shapes.size(); ++j)
         {
-            s = x.at(i)*(y.at(n-1) - y.at(i+1)); //if i == 0, then y[i-1] replace on y[n-1]
-            res += s;
+            const int outer = shapes.at(j).first();
+            const qreal area = qAbs(SignedArea(outlines.at(outer)));
+            if (Winding(outer, sample) != 0 && (owner < 0 || area < ownerArea))
+            {
+                owner = j;
+                ownerArea = area;
+            }
         }
-        else
+
+        if (owner >= 0)
+        {
+            shapes[owner].append(holes.at(i));
+        }
+    }
+
+    return shapes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BridgeHoles joins holes to the outer outline, so the shape can be triangulated as one outline.
+ *
+ * Holes are joined from right to left, the rightmost point of each hole is connected to a visible point of the
+ * outline (D. Eberly, "Triangulation by Ear Clipping"). The bridge is walked in both directions, so its ends repeat.
+ * @param points outer outline turning left followed by holes turning right.
+ * @param holes index of the first point of each hole.
+ * @return indexes of points of the joined outline.
+ */
+QVector<int> VObjEngine::BridgeHoles(const QPolygonF &points, const QVector<int> &holes) const
+{
+    QVector<int> outline;
+    outline.reserve(points.size() + holes.size() * 2);
+    const int outerSize = holes.isEmpty() ? points.size() : holes.first();
+    for (int i = 0; i < outerSize; ++i)
+    {
+        outline.append(i);
+    }
+
+    auto HoleEnd = [&points, &holes](int hole)
+    {
+        return hole + 1 < holes.size() ? holes.at(hole + 1) : points.size();
+    };
+
+    QVector<int> rightmost;
+    QVector<int> order;
+    rightmost.reserve(holes.size());
+    order.reserve(holes.size());
+    for (int i = 0; i < holes.size(); ++i)
+    {
+        int right = holes.at(i);
+        for (int j = right + 1; j < HoleEnd(i); ++j)
         {
-            if (i == n-1)
+            if (points.at(j).x() > points.at(right).x())
             {
-                s = x.at(i)*(y.at(i-1) - y.at(0)); // if i == n-1, then y[i+1] replace on y[0]
-                res += s;
+                right = j;
             }
-            else
+        }
+        rightmost.append(right);
+        order.append(i);
+    }
+
+    std::sort(order.begin(), order.end(), [&points, &rightmost](int a, int b)
+    {
+        return points.at(rightmost.at(a)).x() > points.at(rightmost.at(b)).x();
+    });
+
+    for (int i = 0; i < order.size(); ++i)
+    {
+        const int hole = order.at(i);
+        const int right = rightmost.at(hole);
+        const int bridge = FindBridge(points, outline, points.at(right));
+        if (bridge < 0)
+        {
+            continue;
+        }
+
+        QVector<int> joined;
+        joined.reserve(outline.size() + HoleEnd(hole) - holes.at(hole) + 2);
+        joined += outline.mid(0, bridge + 1);
+        for (int j = right; j < HoleEnd(hole); ++j)
+        {
+            joined.append(j);
+        }
+        for (int j = holes.at(hole); j <= right; ++j)
+        {
+            joined.append(j);
+        }
+        joined += outline.mid(bridge);
+        outline = joined;
+    }
+
+    return outline;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WriteTriangles triangulates the outline by ear clipping and writes faces as soon as they are found.
+ *
+ * An ear is a convex corner whose triangle contains no reflex vertex of the remaining outline. Collinear corners are
+ * dropped without a face. Points of bridges to holes repeat, a copy of a corner doesn't block its ear. If a
+ * self-intersecting outline has no ear left the current corner is dropped without a face, so the loop always ends.
+ *
+ * @param points points of the shape.
+ * @param outline indexes of points of the closed outline.
+ * @param firstIndex OBJ index of the first point.
+ */
+void VObjEngine::WriteTriangles(const QPolygonF &points, const QVector<int> &outline, quint32 firstIndex)
+{
+    const int count = outline.size();
+    if (count < 3)
+    {
+        return;
+    }
+
+    auto Point = [&points, &outline](int i) -> const QPointF &
+    {
+        return points.at(outline.at(i));
+    };
+
+    // Keep orientation of the outline, convex corners turn the same way
+    qreal area = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        const QPointF &p1 = Point(i);
+        const QPointF &p2 = Point((i + 1) % count);
+        area += p1.x() * p2.y() - p2.x() * p1.y();
+    }
+    const qreal orientation = area < 0 ? -1 : 1;
+
+    auto Turn = [&Point, orientation](int a, int b, int c)
+    {
+        return orientation * Cross(Point(a), Point(b), Point(c));
+    };
+
+    QVector<int> previous(count);
+    QVector<int> next(count);
+    QVector<bool> reflex(count);
+    for (int i = 0; i < count; ++i)
+    {
+        previous[i] = (i + count - 1) % count;
+        next[i] = (i + 1) % count;
+    }
+    int reflexCount = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        reflex[i] = Turn(previous.at(i), i, next.at(i)) < 0;
+        reflexCount += reflex.at(i) ? 1 : 0;
+    }
+
+    auto UpdateReflex = [&](int i)
+    {
+        const bool isReflex = Turn(previous.at(i), i, next.at(i)) < 0;
+        reflexCount += (isReflex ? 1 : 0) - (reflex.at(i) ? 1 : 0);
+        reflex[i] = isReflex;
+    };
+
+    auto IsEar = [&](int a, int b, int c)
+    {
+        if (Turn(a, b, c) <= 0)
+        {
+            return false;
+        }
+
+        // Only reflex vertices can lie inside a convex corner's triangle
+        if (reflexCount == 0)
+        {
+            return true;
+        }
+
+        for (int i = next.at(c); i != a; i = next.at(i))
+        {
+            const QPointF &p = Point(i);
+            if (reflex.at(i) && p != Point(a) && p != Point(b) && p != Point(c)
+                && InsideTriangle(p, Point(a), Point(b), Point(c), orientation))
             {
-                s = x.at(i)*(y.at(i-1) - y.at(i+1));
-                res += s;
+                return false;
             }
         }
+        return true;
+    };
+
+    auto WriteFace = [this, firstIndex, &outline](int a, int b, int c)
+    {
+        *stream << "f " << firstIndex + static_cast<quint32>(outline.at(a)) << ' '
+                << firstIndex + static_cast<quint32>(outline.at(b)) << ' '
+                << firstIndex + static_cast<quint32>(outline.at(c)) << '\n';
+    };
+
+    int remaining = count;
+    int current = 0;
+    int tested = 0;
+    while (remaining > 3)
+    {
+        const int a = previous.at(current);
+        const int c = next.at(current);
+        const qreal turn = Turn(a, current, c);
+        const bool degenerate = qFuzzyIsNull(turn);
+        const bool ear = not degenerate && IsEar(a, current, c);
+
+        if (degenerate || ear || tested >= remaining)
+        {
+            if (ear)
+            {
+                WriteFace(a, current, c);
+            }
+
+            next[a] = c;
+            previous[c] = a;
+            --remaining;
+            reflexCount -= reflex.at(current) ? 1 : 0;
+            UpdateReflex(a);
+            UpdateReflex(c);
+
+            current = c;
+            tested = 0;
+        }
+        else
+        {
+            current = c;
+            ++tested;
+        }
+    }
+
+    const qreal turn = Turn(previous.at(current), current, next.at(current));
+    if (turn > 0 && not qFuzzyIsNull(turn))
+    {
+        WriteFace(previous.at(current), current, next.at(current));
     }
-    sq = qFloor(qAbs(res/2.0));
-    return sq;
 }
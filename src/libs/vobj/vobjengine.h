@@ -54,6 +54,7 @@
 
 #include <qcompilerdetection.h>
 #include <QTransform>
+#include <QVector>
 #include <QPaintEngine>
 #include <QPolygonF>
 #include <QRectF>
@@ -61,12 +62,8 @@
 #include <QSize>
 #include <QtGlobal>
 
-#include "delaunay.h"
-
 class QTextStream;
 
-#define MAX_POINTS      512
-
 class VObjEngine : public QPaintEngine
 {
 public:
@@ -98,14 +95,15 @@ class VObjEngine : public QPaintEngine
     QSharedPointer<QTextStream> stream;
     quint32     globalPointsCount;
     QSharedPointer<QIODevice> outputDevice;
-    del_point2d_t    points[MAX_POINTS];
     quint32          planeCount;
     QSize            size;
     int              resolution;
     QTransform       transform;
 
-    QPolygonF  MakePointsUnique(const QPolygonF &polygon)const;
-    qint64     Square(const QPolygonF &poly)const;
+    QPolygonF  RemoveRepeatedPoints(const QPolygonF &polygon)const;
+    QVector<QVector<int>> SplitOutlines(const QVector<QPolygonF> &outlines, Qt::FillRule rule) const;
+    QVector<int> BridgeHoles(const QPolygonF &points, const QVector<int> &holes) const;
+    void       WriteTriangles(const QPolygonF &points, const QVector<int> &outline, quint32 firstIndex);
 };
 
 #endif // VOBJENGINE_H
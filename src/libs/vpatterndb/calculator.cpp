@@ -51,15 +51,76 @@
 
 #include "calculator.h"
 
+#include <QMutex>
+#include <QMutexLocker>
 #include <QStaticStringData>
 #include <QStringData>
 #include <QStringDataPtr>
 #include <QStringList>
 
 #include "../vmisc/def.h"
+#include "../vmisc/vtrace.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "variables/vinternalvariable.h"
 #include <QSharedPointer>
+
+namespace
+{
+/**
+ * @brief The CompiledFormula struct keeps result of parsing a formula. The same formula is evaluated many times
+ * (each full parse of pattern file), only the values of variables change.
+ */
+struct CompiledFormula
+{
+    CompiledFormula()
+        : tokens(), constant(false), value(0), hasByteCode(false), byteCode()
+    {}
+
+    QMap<int, QString>      tokens;      // Variables found in the formula.
+    bool                    constant;    // Formula has no variables, value is the result.
+    qreal                   value;
+    bool                    hasByteCode;
+    qmu::QmuParserCompiled  byteCode;
+};
+
+typedef QSharedPointer<const CompiledFormula> CompiledFormulaPtr;
+
+// Editing a formula in a dialog evaluates every intermediate string. Keep the cache bounded.
+const int maxCompiledFormulas = 20000;
+
+//---------------------------------------------------------------------------------------------------------------------
+QMutex *CompiledFormulasMutex()
+{
+    static QMutex mutex;
+    return &mutex;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QHash<QString, CompiledFormulaPtr> &CompiledFormulas()
+{
+    static QHash<QString, CompiledFormulaPtr> formulas;
+    return formulas;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+CompiledFormulaPtr FindCompiledFormula(const QString &formula)
+{
+    QMutexLocker locker(CompiledFormulasMutex());
+    return CompiledFormulas().value(formula);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void StoreCompiledFormula(const QString &formula, const CompiledFormulaPtr &compiled)
+{
+    QMutexLocker locker(CompiledFormulasMutex());
+    QHash<QString, CompiledFormulaPtr> &formulas = CompiledFormulas();
+    if (formulas.size() >= maxCompiledFormulas)
+    {
+        formulas.clear();
+    }
+    formulas.insert(formula, compiled);
+}
+}
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief Calculator class wraper for QMuParser. Make easy initialization math parser.
@@ -90,11 +151,33 @@ Calculator::Calculator()
  * First we try eval expression without adding variables. If it fail, we take tokens from expression and add variables
  * to parser and try again.
  *
+ * Successfully parsed formulas are cached process-wide. Next time the formula only binds variables to the cached
+ * bytecode, the formula string is not parsed again.
+ *
  * @param formula string of formula.
  * @return value of formula.
  */
-qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable>> *vars, const QString &formula)
+qreal Calculator::EvalFormula(const VPersistentHash<QString, QSharedPointer<VInternalVariable>> *vars,
+                              const QString &formula)
 {
+    V_TRACE_SCOPE("calculation", "Calculator::EvalFormula");
+    const CompiledFormulaPtr compiled = FindCompiledFormula(formula);
+    if (not compiled.isNull())
+    {
+        if (compiled->constant)
+        {
+            return compiled->value;
+        }
+
+        SetSepForEval();
+        InitVariables(vars, compiled->tokens, formula);
+        if (not compiled->hasByteCode || not LoadCompiled(compiled->byteCode))
+        {
+            SetExpr(formula);
+        }
+        return Eval();
+    }
+
     // Parser doesn't know any variable on this stage. So, we just use variable factory that for each unknown variable
     // set value to 0.
     SetVarFactory(AddVariable, this);
@@ -121,12 +204,22 @@ qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVaria
 
     if (tokens.isEmpty())
     {
+        QSharedPointer<CompiledFormula> constant(new CompiledFormula());
+        constant->constant = true;
+        constant->value = result;
+        StoreCompiledFormula(formula, constant);
         return result; // We have found only numbers in expression.
     }
 
     // Add variables to parser because we have deal with expression with variables.
     InitVariables(vars, tokens, formula);
-    return Eval();
+    result = Eval();
+
+    QSharedPointer<CompiledFormula> parsed(new CompiledFormula());
+    parsed->tokens = tokens;
+    parsed->hasByteCode = SaveCompiled(parsed->byteCode);
+    StoreCompiledFormula(formula, parsed);
+    return result;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -139,7 +232,7 @@ qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVaria
  * @param tokens all tokens (measurements names, variables with lengths) that parser have found in expression.
  * @param formula expression, need for throwing better error message.
  */
-void Calculator::InitVariables(const QHash<QString, QSharedPointer<VInternalVariable> > *vars,
+void Calculator::InitVariables(const VPersistentHash<QString, QSharedPointer<VInternalVariable> > *vars,
                                const QMap<int, QString> &tokens, const QString &formula)
 {
     QMap<int, QString>::const_iterator i = tokens.constBegin();
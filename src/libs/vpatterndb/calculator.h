@@ -62,6 +62,7 @@
 
 //class VInternalVariable;
 #include "variables/vinternalvariable.h"
+#include "vpersistenthash.h"
 /**
  * @brief The Calculator class for calculation formula.
  *
@@ -86,12 +87,12 @@ class Calculator:public qmu::QmuFormulaBase
     Calculator();
     virtual ~Calculator() Q_DECL_EQ_DEFAULT;
 
-    qreal EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QString &formula);
+    qreal EvalFormula(const VPersistentHash<QString, QSharedPointer<VInternalVariable> > *vars, const QString &formula);
 private:
     Q_DISABLE_COPY(Calculator)
 
-    void InitVariables(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QMap<int, QString> &tokens,
-                       const QString &formula);
+    void InitVariables(const VPersistentHash<QString, QSharedPointer<VInternalVariable> > *vars,
+                       const QMap<int, QString> &tokens, const QString &formula);
 };
 
 #endif // CALCULATOR_H
@@ -55,6 +55,7 @@
 #include <limits.h>
 #include <QVector>
 #include <QtDebug>
+#include <atomic>
 
 #include "../ifc/exception/vexception.h"
 #include "../vgeometry/vabstractcubicbezierpath.h"
@@ -87,10 +88,39 @@ Q_LOGGING_CATEGORY(vCon, "v.container")
 
 QT_WARNING_POP
 
-quint32 VContainer::_id = NULL_ID;
-qreal VContainer::_size = 50;
-qreal VContainer::_height = 176;
-QSet<QString> VContainer::uniqueNames = QSet<QString>();
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+VEvaluationContext *DefaultContext()
+{
+    static VEvaluationContext context;
+    return &context;
+}
+
+thread_local VEvaluationContext *currentContext = nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VEvaluationContext::VEvaluationContext()
+    : id(NULL_ID),
+      size(50),
+      height(176),
+      uniqueNames()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+VEvaluationScope::VEvaluationScope(VEvaluationContext *context)
+    : previous(currentContext)
+{
+    SCASSERT(context != nullptr)
+    currentContext = context;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VEvaluationScope::~VEvaluationScope()
+{
+    currentContext = previous;
+}
 
 #ifdef Q_COMPILER_RVALUE_REFS
 VContainer &VContainer::operator=(VContainer &&data) Q_DECL_NOTHROW
@@ -169,7 +199,7 @@ const QSharedPointer<VGObject> VContainer::GetFakeGObject(quint32 id)
  * @return Object
  */
 template <typename key, typename val>
-const val VContainer::GetObject(const QHash<key, val> &obj, key id) const
+const val VContainer::GetObject(const VPersistentHash<key, val> &obj, key id) const
 {
     if (obj.contains(id))
     {
@@ -217,7 +247,8 @@ quint32 VContainer::AddGObject(VGObject *obj)
 {
     SCASSERT(obj != nullptr)
     QSharedPointer<VGObject> pointer(obj);
-    uniqueNames.insert(obj->name());
+    pointer->setRevision(NextRevision());
+    Context()->uniqueNames.insert(obj->name());
     return AddObject(d->gObjects, pointer);
 }
 
@@ -240,7 +271,7 @@ quint32 VContainer::AddPiecePath(const VPiecePath &path)
 //---------------------------------------------------------------------------------------------------------------------
 quint32 VContainer::getId()
 {
-    return _id;
+    return Context()->id;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -253,12 +284,13 @@ quint32 VContainer::getNextId()
     //TODO. Current count of ids are very big and allow us save time before someone will reach its max value.
     //Better way, of cource, is to seek free ids inside the set of values and reuse them.
     //But for now better to keep it as it is now.
-    if (_id == UINT_MAX)
+    VEvaluationContext *context = Context();
+    if (context->id == UINT_MAX)
     {
         qCritical() << (tr("Number of free id exhausted."));
     }
-    _id++;
-    return _id;
+    context->id++;
+    return context->id;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -268,12 +300,24 @@ quint32 VContainer::getNextId()
  */
 void VContainer::UpdateId(quint32 newId)
 {
-    if (newId > _id)
+    VEvaluationContext *context = Context();
+    if (newId > context->id)
     {
-       _id = newId;
+       context->id = newId;
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief NextRevision return a new stamp for stored geometry. Stamps are unique for the whole application, so caches
+ * keyed on them never mix objects of different containers.
+ */
+quint64 VContainer::NextRevision()
+{
+    static std::atomic<quint64> revision(0);
+    return ++revision;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief Clear clear data in container. Id will be 0.
@@ -281,7 +325,7 @@ void VContainer::UpdateId(quint32 newId)
 void VContainer::Clear()
 {
     qCDebug(vCon, "Clearing container data.");
-    _id = NULL_ID;
+    Context()->id = NULL_ID;
 
     d->pieces->clear();
     d->piecePaths->clear();
@@ -294,7 +338,7 @@ void VContainer::Clear()
 void VContainer::ClearForFullParse()
 {
     qCDebug(vCon, "Clearing container data for full parse.");
-    _id = NULL_ID;
+    Context()->id = NULL_ID;
 
     d->pieces->clear();
     d->piecePaths->clear();
@@ -324,12 +368,11 @@ void VContainer::ClearCalculationGObjects()
     if (not d->gObjects.isEmpty()) //-V807
     {
         QVector<quint32> keys;
-        QHash<quint32, QSharedPointer<VGObject> >::iterator i;
-        for (i = d->gObjects.begin(); i != d->gObjects.end(); ++i)
+        VPersistentHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
+        for (i = d->gObjects.constBegin(); i != d->gObjects.constEnd(); ++i)
         {
             if (i.value()->getMode() == Draw::Calculation)
             {
-                i.value().clear();
                 keys.append(i.key());
             }
         }
@@ -356,8 +399,8 @@ void VContainer::ClearVariables(const VarType &type)
         else
         {
             QVector<QString> keys;
-            QHash<QString, QSharedPointer<VInternalVariable> >::iterator i;
-            for (i = d->variables.begin(); i != d->variables.end(); ++i)
+            VPersistentHash<QString, QSharedPointer<VInternalVariable> >::const_iterator i;
+            for (i = d->variables.constBegin(); i != d->variables.constEnd(); ++i)
             {
                 if (i.value()->GetType() == type)
                 {
@@ -497,12 +540,12 @@ void VContainer::RemovePiece(quint32 id)
  * @return id of object in container
  */
 template <typename key, typename val>
-quint32 VContainer::AddObject(QHash<key, val> &obj, val value)
+quint32 VContainer::AddObject(VPersistentHash<key, val> &obj, val value)
 {
     SCASSERT(value != nullptr)
     const quint32 id = getNextId();
     value->setId(id);
-    obj[id] = value;
+    obj.insert(id, value);
     return id;
 }
 
@@ -510,7 +553,18 @@ quint32 VContainer::AddObject(QHash<key, val> &obj, val value)
 void VContainer::UpdatePiece(quint32 id, const VPiece &piece)
 {
     Q_ASSERT_X(id != NULL_ID, Q_FUNC_INFO, "id == 0"); //-V654 //-V712
-    d->pieces->insert(id, piece);
+    if (d->pieces->contains(id))
+    {
+        // Recalculation parses the piece again. Keep the geometry calculated for the previous version, it stays
+        // valid while inputs are the same.
+        VPiece updated = piece;
+        updated.ShareGeometryCache(d->pieces->value(id));
+        d->pieces->insert(id, updated);
+    }
+    else
+    {
+        d->pieces->insert(id, piece);
+    }
     UpdateId(id);
 }
 
@@ -529,7 +583,6 @@ void VContainer::UpdatePiecePath(quint32 id, const VPiecePath &path)
  */
 void VContainer::removeCustomVariable(const QString &name)
 {
-    d->variables[name].clear();
     d->variables.remove(name);
 }
 
@@ -584,17 +637,27 @@ const QMap<QString, QSharedPointer<VCurveAngle> > VContainer::curveAnglesData()
 //---------------------------------------------------------------------------------------------------------------------
 bool VContainer::IsUnique(const QString &name)
 {
-    return (!uniqueNames.contains(name) && !builInFunctions.contains(name));
+    return (!Context()->uniqueNames.contains(name) && !builInFunctions.contains(name));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QStringList VContainer::AllUniqueNames()
 {
     QStringList names = builInFunctions;
-	names.append(uniqueNames.values());
+	names.append(Context()->uniqueNames.values());
     return names;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Context return evaluation context of the calling thread.
+ * @return context installed by VEvaluationScope or the default one.
+ */
+VEvaluationContext *VContainer::Context()
+{
+    return currentContext != nullptr ? currentContext : DefaultContext();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 const Unit *VContainer::GetPatternUnit() const
 {
@@ -613,7 +676,7 @@ const QMap<QString, QSharedPointer<T> > VContainer::DataVar(const VarType &type)
 {
     QMap<QString, QSharedPointer<T> > map;
     //Sorting QHash by id
-    QHash<QString, QSharedPointer<VInternalVariable> >::const_iterator i;
+    VPersistentHash<QString, QSharedPointer<VInternalVariable> >::const_iterator i;
     for (i = d->variables.constBegin(); i != d->variables.constEnd(); ++i)
     {
         if (i.value()->GetType() == type)
@@ -628,20 +691,20 @@ const QMap<QString, QSharedPointer<T> > VContainer::DataVar(const VarType &type)
 //---------------------------------------------------------------------------------------------------------------------
 void VContainer::ClearUniqueNames()
 {
-    uniqueNames.clear();
+    Context()->uniqueNames.clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VContainer::ClearUniqueIncrementNames()
 {
-	const QList<QString> list = uniqueNames.values();
+	const QList<QString> list = Context()->uniqueNames.values();
     ClearUniqueNames();
 
     for(int i = 0; i < list.size(); ++i)
     {
         if (not list.at(i).startsWith('#'))
         {
-            uniqueNames.insert(list.at(i));
+            Context()->uniqueNames.insert(list.at(i));
         }
     }
 }
@@ -653,7 +716,7 @@ void VContainer::ClearUniqueIncrementNames()
  */
 void VContainer::setSize(qreal size)
 {
-    _size = size;
+    Context()->size = size;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -663,7 +726,7 @@ void VContainer::setSize(qreal size)
  */
 void VContainer::setHeight(qreal height)
 {
-    _height = height;
+    Context()->height = height;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -673,13 +736,13 @@ void VContainer::setHeight(qreal height)
  */
 qreal VContainer::size()
 {
-    return _size;
+    return Context()->size;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal *VContainer::rsize()
 {
-    return &_size;
+    return &Context()->size;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -689,13 +752,13 @@ qreal *VContainer::rsize()
  */
 qreal VContainer::height()
 {
-    return _height;
+    return Context()->height;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal *VContainer::rheight()
 {
-    return &_height;
+    return &Context()->height;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -703,7 +766,7 @@ qreal *VContainer::rheight()
  * @brief data container with datagObjects return container of gObjects
  * @return pointer on container of gObjects
  */
-const QHash<quint32, QSharedPointer<VGObject> > *VContainer::DataGObjects() const
+const VPersistentHash<quint32, QSharedPointer<VGObject> > *VContainer::DataGObjects() const
 {
     return &d->gObjects;
 }
@@ -715,7 +778,7 @@ const QHash<quint32, VPiece> *VContainer::DataPieces() const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-const QHash<QString, QSharedPointer<VInternalVariable> > *VContainer::DataVariables() const
+const VPersistentHash<QString, QSharedPointer<VInternalVariable> > *VContainer::DataVariables() const
 {
     return &d->variables;
 }
@@ -76,6 +76,7 @@
 #include "../vmisc/diagnostic.h"
 #include "variables.h"
 #include "variables/vinternalvariable.h"
+#include "vpersistenthash.h"
 #include "vpiece.h"
 #include "vpiecepath.h"
 #include "vtranslatevars.h"
@@ -92,8 +93,8 @@ class VContainerData : public QSharedData //-V690
 public:
 
     VContainerData(const VTranslateVars *trVars, const Unit *patternUnit)
-        : gObjects(QHash<quint32, QSharedPointer<VGObject> >()),
-          variables(QHash<QString, QSharedPointer<VInternalVariable> > ()),
+        : gObjects(),
+          variables(),
           pieces(QSharedPointer<QHash<quint32, VPiece>>(new QHash<quint32, VPiece>())),
           piecePaths(QSharedPointer<QHash<quint32, VPiecePath>>(new QHash<quint32, VPiecePath>())),
           trVars(trVars),
@@ -115,12 +116,12 @@ class VContainerData : public QSharedData //-V690
     /**
      * @brief gObjects graphicals objects of pattern.
      */
-    QHash<quint32, QSharedPointer<VGObject> > gObjects;
+    VPersistentHash<quint32, QSharedPointer<VGObject> > gObjects;
 
     /**
      * @brief variables container for measurements, increments, lines lengths, lines angles, arcs lengths, curve lengths
      */
-    QHash<QString, QSharedPointer<VInternalVariable>> variables;
+    VPersistentHash<QString, QSharedPointer<VInternalVariable>> variables;
 
     QSharedPointer<QHash<quint32, VPiece>> pieces;
     QSharedPointer<QHash<quint32, VPiecePath>> piecePaths;
@@ -134,6 +135,42 @@ class VContainerData : public QSharedData //-V690
 
 QT_WARNING_POP
 
+/**
+ * @brief The VEvaluationContext class keeps the state shared by all containers of one pattern evaluation: the last
+ * used id, current size and height and the names already in use.
+ *
+ * Each thread works with the default context until it installs own context with VEvaluationScope. The context only
+ * removes the static state of VContainer, nothing in the application evaluates sizes in parallel yet. Pattern parsing
+ * still depends on qApp and on one VPattern per window.
+ */
+class VEvaluationContext
+{
+public:
+    VEvaluationContext();
+
+    /**
+     * @brief id current id. New object will have value +1. For empty context equal 0.
+     */
+    quint32       id;
+    qreal         size;
+    qreal         height;
+    QSet<QString> uniqueNames;
+};
+
+/**
+ * @brief The VEvaluationScope class makes a context current for the calling thread for its lifetime.
+ */
+class VEvaluationScope
+{
+public:
+    explicit VEvaluationScope(VEvaluationContext *context);
+    ~VEvaluationScope();
+
+private:
+    Q_DISABLE_COPY(VEvaluationScope)
+    VEvaluationContext *previous;
+};
+
 /**
  * @brief The VContainer class container of all variables.
  */
@@ -206,9 +243,9 @@ class VContainer
 
     void               removeCustomVariable(const QString& name);
 
-    const QHash<quint32, QSharedPointer<VGObject> >         *DataGObjects() const;
-    const QHash<quint32, VPiece>                            *DataPieces() const;
-    const QHash<QString, QSharedPointer<VInternalVariable>> *DataVariables() const;
+    const VPersistentHash<quint32, QSharedPointer<VGObject> >         *DataGObjects() const;
+    const QHash<quint32, VPiece>                                      *DataPieces() const;
+    const VPersistentHash<QString, QSharedPointer<VInternalVariable>> *DataVariables() const;
 
     const QMap<QString, QSharedPointer<MeasurementVariable> >  DataMeasurements() const;
     const QMap<QString, QSharedPointer<VIncrement> >    variablesData() const;
@@ -222,18 +259,12 @@ class VContainer
     static bool        IsUnique(const QString &name);
     static QStringList AllUniqueNames();
 
+    static VEvaluationContext *Context();
+
     const Unit *GetPatternUnit() const;
     const VTranslateVars *GetTrVars() const;
 
 private:
-    /**
-     * @brief _id current id. New object will have value +1. For empty class equal 0.
-     */
-    static quint32 _id;
-    static qreal   _size;
-    static qreal   _height;
-    static QSet<QString> uniqueNames;
-
     QSharedDataPointer<VContainerData> d;
 
     void AddCurve(const QSharedPointer<VAbstractCurve> &curve, const quint32 &id, quint32 parentId = NULL_ID);
@@ -243,13 +274,15 @@ class VContainer
 
     template <typename key, typename val>
     // cppcheck-suppress functionStatic
-    const val GetObject(const QHash<key, val> &obj, key id) const;
+    const val GetObject(const VPersistentHash<key, val> &obj, key id) const;
 
     template <typename T>
     void UpdateObject(const quint32 &id, const QSharedPointer<T> &point);
 
+    static quint64 NextRevision();
+
     template <typename key, typename val>
-    static quint32 AddObject(QHash<key, val> &obj, val value);
+    static quint32 AddObject(VPersistentHash<key, val> &obj, val value);
 
     template <typename T>
     const QMap<QString, QSharedPointer<T> > DataVar(const VarType &type) const;
@@ -354,7 +387,7 @@ void VContainer::AddVariable(const QString& name, const QSharedPointer<T> &var)
         d->variables.insert(name, var);
     }
 
-    uniqueNames.insert(name);
+    Context()->uniqueNames.insert(name);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -383,7 +416,7 @@ void VContainer::UpdateGObject(quint32 id, const QSharedPointer<T> &obj)
 {
     SCASSERT(not obj.isNull())
     UpdateObject(id, obj);
-    uniqueNames.insert(obj->name());
+    Context()->uniqueNames.insert(obj->name());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -406,9 +439,11 @@ void VContainer::UpdateObject(const quint32 &id, const QSharedPointer<T> &point)
             throw VExceptionBadId(tr("Can't cast object"), id);
         }
         *obj = *point;
+        obj->setRevision(NextRevision());
     }
     else
     {
+        point->setRevision(NextRevision());
         d->gObjects.insert(id, point);
     }
     UpdateId(id);
@@ -34,6 +34,7 @@ HEADERS += \
     $$PWD/variables/measurement_variable.h \
     $$PWD/variables/measurement_variable_p.h \
     $$PWD/vcontainer.h \
+    $$PWD/vpersistenthash.h \
     $$PWD/stable.h \
     $$PWD/calculator.h \
     $$PWD/variables.h \
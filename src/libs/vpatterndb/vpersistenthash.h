@@ -0,0 +1,523 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#ifndef VPERSISTENTHASH_H
+#define VPERSISTENTHASH_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QSharedData>
+#include <QVarLengthArray>
+#include <QVector>
+#include <QtAlgorithms>
+#include <QtGlobal>
+
+/**
+ * @brief The VPersistentHash class is a hash array mapped trie with copy-on-write nodes.
+ *
+ * A copy costs O(1) like a copy of QHash. Unlike QHash the first write to a copy does not duplicate the whole table,
+ * only nodes on the path from the root to the changed entry are copied and the rest stays shared. Every tool keeps its
+ * own copy of the pattern data, with QHash each of them ended up with a full private table.
+ *
+ * The interface follows the part of QHash used by clients of VContainer. Iteration order is unspecified.
+ */
+template <typename Key, typename T>
+class VPersistentHash
+{
+    struct Node;
+    typedef QExplicitlySharedDataPointer<Node> NodePtr;
+
+    struct Entry
+    {
+        uint hash;
+        Key  key;
+        T    value;
+    };
+
+    struct Node : public QSharedData
+    {
+        Node()
+            : QSharedData(), dataMap(0), nodeMap(0), entries(), children()
+        {}
+
+        Node(const Node &node)
+            : QSharedData(node), dataMap(node.dataMap), nodeMap(node.nodeMap), entries(node.entries),
+              children(node.children)
+        {}
+
+        /** @brief dataMap bit per hash fragment stored in entries. */
+        quint32          dataMap;
+        /** @brief nodeMap bit per hash fragment stored in children. */
+        quint32          nodeMap;
+        QVector<Entry>   entries;
+        QVector<NodePtr> children;
+
+    private:
+        Node &operator=(const Node &) Q_DECL_EQ_DELETE;
+    };
+
+public:
+    class const_iterator
+    {
+    public:
+        const_iterator()
+            : stack()
+        {}
+
+        const Key &key() const   { return Current().key; }
+        const T   &value() const { return Current().value; }
+        const T   &operator*() const { return Current().value; }
+        const T   *operator->() const { return &Current().value; }
+
+        const_iterator &operator++()
+        {
+            ++stack.last().entry;
+            Settle();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const const_iterator &other) const
+        {
+            if (stack.isEmpty() || other.stack.isEmpty())
+            {
+                return stack.isEmpty() == other.stack.isEmpty();
+            }
+            return stack.last().node == other.stack.last().node && stack.last().entry == other.stack.last().entry;
+        }
+
+        bool operator!=(const const_iterator &other) const { return not (*this == other); }
+
+    private:
+        friend class VPersistentHash;
+
+        struct Frame
+        {
+            const Node *node;
+            int         entry;
+            int         child;
+        };
+
+        // Depth of the trie is limited by the hash size, 7 levels and a collision node.
+        QVarLengthArray<Frame, 8> stack;
+
+        explicit const_iterator(const Node *root)
+            : stack()
+        {
+            if (root != nullptr)
+            {
+                const Frame frame = {root, 0, 0};
+                stack.append(frame);
+                Settle();
+            }
+        }
+
+        const Entry &Current() const
+        {
+            const Frame &frame = stack.last();
+            return frame.node->entries.at(frame.entry);
+        }
+
+        /**
+         * @brief Settle walks the trie depth first until the top frame points to an entry or nothing is left.
+         */
+        void Settle()
+        {
+            while (not stack.isEmpty())
+            {
+                Frame &top = stack.last();
+                if (top.entry < top.node->entries.size())
+                {
+                    return;
+                }
+
+                if (top.child < top.node->children.size())
+                {
+                    const Frame frame = {top.node->children.at(top.child++).constData(), 0, 0};
+                    stack.append(frame);
+                }
+                else
+                {
+                    stack.removeLast();
+                }
+            }
+        }
+    };
+
+    typedef const_iterator ConstIterator;
+
+    VPersistentHash()
+        : root(), length(0)
+    {}
+
+    int  size() const    { return length; }
+    int  count() const   { return length; }
+    bool isEmpty() const { return length == 0; }
+
+    bool contains(const Key &key) const { return Find(key) != nullptr; }
+
+    const T value(const Key &key) const
+    {
+        const Entry *entry = Find(key);
+        return entry != nullptr ? entry->value : T();
+    }
+
+    const T value(const Key &key, const T &defaultValue) const
+    {
+        const Entry *entry = Find(key);
+        return entry != nullptr ? entry->value : defaultValue;
+    }
+
+    QList<Key> keys() const;
+    QList<T>   values() const;
+
+    void insert(const Key &key, const T &value);
+    int  remove(const Key &key);
+    void clear();
+
+    const_iterator begin() const      { return const_iterator(root.constData()); }
+    const_iterator end() const        { return const_iterator(); }
+    const_iterator constBegin() const { return begin(); }
+    const_iterator constEnd() const   { return end(); }
+
+    qint64 MemoryUsage(QSet<const void *> *visited = nullptr) const;
+
+private:
+    static const int BitsPerLevel = 5;
+    static const int HashBits = static_cast<int>(sizeof(uint)) * 8;
+
+    NodePtr root;
+    int     length;
+
+    const Entry *Find(const Key &key) const;
+
+    static quint32 Bit(uint hash, int shift);
+    static int     Index(quint32 map, quint32 bit);
+    static NodePtr Merge(const Entry &first, const Entry &second, int shift);
+    static bool    Insert(NodePtr &node, const Entry &entry, int shift);
+    static void    Remove(NodePtr &node, uint hash, const Key &key, int shift);
+    static qint64  NodeMemory(const Node *node, QSet<const void *> *visited);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+QList<Key> VPersistentHash<Key, T>::keys() const
+{
+    QList<Key> list;
+    list.reserve(length);
+    for (const_iterator i = constBegin(); i != constEnd(); ++i)
+    {
+        list.append(i.key());
+    }
+    return list;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+QList<T> VPersistentHash<Key, T>::values() const
+{
+    QList<T> list;
+    list.reserve(length);
+    for (const_iterator i = constBegin(); i != constEnd(); ++i)
+    {
+        list.append(i.value());
+    }
+    return list;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief insert add the value or replace the value of an existing key. Nodes shared with other copies are copied
+ * on the way down.
+ */
+template <typename Key, typename T>
+void VPersistentHash<Key, T>::insert(const Key &key, const T &value)
+{
+    if (not root)
+    {
+        root = NodePtr(new Node());
+    }
+
+    const Entry entry = {qHash(key), key, value};
+    if (Insert(root, entry, 0))
+    {
+        ++length;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief remove delete the key.
+ * @return number of removed items, 0 or 1.
+ */
+template <typename Key, typename T>
+int VPersistentHash<Key, T>::remove(const Key &key)
+{
+    // Check first, a missing key must not copy shared nodes
+    if (Find(key) == nullptr)
+    {
+        return 0;
+    }
+
+    Remove(root, qHash(key), key, 0);
+    --length;
+    if (length == 0)
+    {
+        root.reset();
+    }
+    return 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+void VPersistentHash<Key, T>::clear()
+{
+    root.reset();
+    length = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MemoryUsage return approximate size of the trie in bytes, without keys and values own data.
+ * @param visited nodes already counted. Pass the same set for several copies to get memory they take together.
+ */
+template <typename Key, typename T>
+qint64 VPersistentHash<Key, T>::MemoryUsage(QSet<const void *> *visited) const
+{
+    QSet<const void *> local;
+    return root ? NodeMemory(root.constData(), visited != nullptr ? visited : &local) : 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+auto VPersistentHash<Key, T>::Find(const Key &key) const -> const Entry *
+{
+    const uint hash = qHash(key);
+    const Node *node = root.constData();
+    int shift = 0;
+
+    while (node != nullptr)
+    {
+        if (shift >= HashBits)
+        {
+            for (int i = 0; i < node->entries.size(); ++i)
+            {
+                if (node->entries.at(i).key == key)
+                {
+                    return &node->entries.at(i);
+                }
+            }
+            return nullptr;
+        }
+
+        const quint32 bit = Bit(hash, shift);
+        if (node->dataMap & bit)
+        {
+            const Entry &entry = node->entries.at(Index(node->dataMap, bit));
+            return entry.hash == hash && entry.key == key ? &entry : nullptr;
+        }
+
+        if (not (node->nodeMap & bit))
+        {
+            return nullptr;
+        }
+
+        node = node->children.at(Index(node->nodeMap, bit)).constData();
+        shift += BitsPerLevel;
+    }
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+inline quint32 VPersistentHash<Key, T>::Bit(uint hash, int shift)
+{
+    return 1u << ((hash >> shift) & ((1u << BitsPerLevel) - 1));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+inline int VPersistentHash<Key, T>::Index(quint32 map, quint32 bit)
+{
+    return static_cast<int>(qPopulationCount(map & (bit - 1)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Merge make a subtrie for two entries whose hashes are equal up to the shift.
+ */
+template <typename Key, typename T>
+auto VPersistentHash<Key, T>::Merge(const Entry &first, const Entry &second, int shift) -> NodePtr
+{
+    NodePtr node(new Node());
+    if (shift >= HashBits)
+    {
+        node->entries.append(first);
+        node->entries.append(second);
+        return node;
+    }
+
+    const quint32 firstBit = Bit(first.hash, shift);
+    const quint32 secondBit = Bit(second.hash, shift);
+    if (firstBit == secondBit)
+    {
+        node->nodeMap = firstBit;
+        node->children.append(Merge(first, second, shift + BitsPerLevel));
+    }
+    else
+    {
+        node->dataMap = firstBit | secondBit;
+        node->entries.append(firstBit < secondBit ? first : second);
+        node->entries.append(firstBit < secondBit ? second : first);
+    }
+    return node;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Insert put the entry to the subtrie.
+ * @return true if the key is new.
+ */
+template <typename Key, typename T>
+bool VPersistentHash<Key, T>::Insert(NodePtr &node, const Entry &entry, int shift)
+{
+    node.detach();
+
+    if (shift >= HashBits)
+    {
+        for (int i = 0; i < node->entries.size(); ++i)
+        {
+            if (node->entries.at(i).key == entry.key)
+            {
+                node->entries[i].value = entry.value;
+                return false;
+            }
+        }
+        node->entries.append(entry);
+        return true;
+    }
+
+    const quint32 bit = Bit(entry.hash, shift);
+    if (node->dataMap & bit)
+    {
+        const int index = Index(node->dataMap, bit);
+        const Entry &current = node->entries.at(index);
+        if (current.hash == entry.hash && current.key == entry.key)
+        {
+            node->entries[index].value = entry.value;
+            return false;
+        }
+
+        const NodePtr child = Merge(current, entry, shift + BitsPerLevel);
+        node->entries.remove(index);
+        node->dataMap &= ~bit;
+        node->children.insert(Index(node->nodeMap, bit), child);
+        node->nodeMap |= bit;
+        return true;
+    }
+
+    if (node->nodeMap & bit)
+    {
+        return Insert(node->children[Index(node->nodeMap, bit)], entry, shift + BitsPerLevel);
+    }
+
+    node->entries.insert(Index(node->dataMap, bit), entry);
+    node->dataMap |= bit;
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Remove delete the key from the subtrie. The key must exist.
+ *
+ * A child left with one entry is moved up, so the trie stays as it would be after inserting the remaining keys.
+ */
+template <typename Key, typename T>
+void VPersistentHash<Key, T>::Remove(NodePtr &node, uint hash, const Key &key, int shift)
+{
+    node.detach();
+
+    if (shift >= HashBits)
+    {
+        for (int i = 0; i < node->entries.size(); ++i)
+        {
+            if (node->entries.at(i).key == key)
+            {
+                node->entries.remove(i);
+                return;
+            }
+        }
+        return;
+    }
+
+    const quint32 bit = Bit(hash, shift);
+    if (node->dataMap & bit)
+    {
+        node->entries.remove(Index(node->dataMap, bit));
+        node->dataMap &= ~bit;
+        return;
+    }
+
+    const int index = Index(node->nodeMap, bit);
+    NodePtr &child = node->children[index];
+    Remove(child, hash, key, shift + BitsPerLevel);
+
+    if (child->nodeMap == 0 && child->entries.size() <= 1)
+    {
+        if (child->entries.size() == 1)
+        {
+            node->entries.insert(Index(node->dataMap, bit), child->entries.at(0));
+            node->dataMap |= bit;
+        }
+        node->children.remove(index);
+        node->nodeMap &= ~bit;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+qint64 VPersistentHash<Key, T>::NodeMemory(const Node *node, QSet<const void *> *visited)
+{
+    if (visited->contains(node))
+    {
+        return 0;
+    }
+    visited->insert(node);
+
+    qint64 bytes = static_cast<qint64>(sizeof(Node)) + node->entries.capacity() * static_cast<qint64>(sizeof(Entry))
+            + node->children.capacity() * static_cast<qint64>(sizeof(NodePtr));
+    for (int i = 0; i < node->children.size(); ++i)
+    {
+        bytes += NodeMemory(node->children.at(i).constData(), visited);
+    }
+    return bytes;
+}
+
+#endif // VPERSISTENTHASH_H
@@ -57,7 +57,10 @@
 #include "../vgeometry/vabstractcurve.h"
 #include "../vgeometry/varc.h"
 #include "../vmisc/vabstractapplication.h"
+#include "../vmisc/vtrace.h"
 
+#include <QDataStream>
+#include <QMutexLocker>
 #include <QSharedPointer>
 #include <QDebug>
 #include <QPainterPath>
@@ -173,8 +176,24 @@ void VPiece::SetPath(const VPiecePath &path)
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VPiece::MainPathPoints(const VContainer *data) const
 {
+    const QByteArray key = GeometryKey(data);
+    VPieceGeometryCache *cache = d->m_geometryCache.data();
+
+    QMutexLocker locker(&cache->mutex);
+    cache->Prepare(key);
+    if (cache->mainPathValid)
+    {
+        return cache->mainPath;
+    }
+    locker.unlock();
+
     QVector<QPointF> points = GetPath().PathPoints(data);
     points = CheckLoops(CorrectEquidistantPoints(points));//A path can contains loops
+
+    locker.relock();
+    cache->Prepare(key);
+    cache->mainPath = points;
+    cache->mainPathValid = true;
     return points;
 }
 
@@ -187,6 +206,7 @@ QVector<VPointF> VPiece::MainPathNodePoints(const VContainer *data, bool showExc
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VPiece::SeamAllowancePoints(const VContainer *data) const
 {
+    V_TRACE_SCOPE("piece", "VPiece::SeamAllowancePoints");
     SCASSERT(data != nullptr);
 
 
@@ -195,6 +215,17 @@ QVector<QPointF> VPiece::SeamAllowancePoints(const VContainer *data) const
         return QVector<QPointF>();
     }
 
+    const QByteArray key = GeometryKey(data);
+    VPieceGeometryCache *cache = d->m_geometryCache.data();
+
+    QMutexLocker locker(&cache->mutex);
+    cache->Prepare(key);
+    if (cache->seamAllowanceValid)
+    {
+        return cache->seamAllowance;
+    }
+    locker.unlock();
+
     const QVector<CustomSARecord> records = FilterRecords(GetValidRecords());
     int recordIndex = -1;
     bool insertingCSA = false;
@@ -268,12 +299,29 @@ QVector<QPointF> VPiece::SeamAllowancePoints(const VContainer *data) const
         }
     }
 
-    return Equidistant(pointsEkv, width);
+    const QVector<QPointF> seamAllowance = Equidistant(pointsEkv, width);
+
+    locker.relock();
+    cache->Prepare(key);
+    cache->seamAllowance = seamAllowance;
+    cache->seamAllowanceValid = true;
+    return seamAllowance;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QLineF> VPiece::createNotchLines(const VContainer *data, const QVector<QPointF> &seamAllowance) const
 {
+    const QByteArray key = GeometryKey(data);
+    VPieceGeometryCache *cache = d->m_geometryCache.data();
+
+    QMutexLocker locker(&cache->mutex);
+    cache->Prepare(key);
+    if (cache->notchesValid && cache->notchesSeamAllowance == seamAllowance)
+    {
+        return cache->notches;
+    }
+    locker.unlock();
+
     const QVector<VPieceNode> unitedPath = GetUnitedPath(data);
     if (not notchesPossible(unitedPath))
     {
@@ -296,6 +344,11 @@ QVector<QLineF> VPiece::createNotchLines(const VContainer *data, const QVector<Q
         notches += createNotch(unitedPath, previousIndex, i, nextIndex, data, seamAllowance);
     }
 
+    locker.relock();
+    cache->Prepare(key);
+    cache->notchesSeamAllowance = seamAllowance;
+    cache->notches = notches;
+    cache->notchesValid = true;
     return notches;
 }
 
@@ -590,6 +643,73 @@ const VGrainlineData &VPiece::GetGrainlineGeometry() const
     return d->m_glGrainline;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ShareGeometryCache use geometry cache of other piece. Values calculated for other inputs are never returned,
+ * so it is safe for any piece, but only worth for the next version of the same piece.
+ * @param piece piece with the cache.
+ */
+void VPiece::ShareGeometryCache(const VPiece &piece)
+{
+    d->m_geometryCache = piece.d->m_geometryCache;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GeometryKey return key of all inputs the piece geometry depends on: nodes, seam allowance width, custom seam
+ * allowance records with their paths and revisions of the objects the nodes refer to.
+ * @param data container with objects.
+ * @return key for the geometry cache.
+ */
+QByteArray VPiece::GeometryKey(const VContainer *data) const
+{
+    SCASSERT(data != nullptr)
+
+    QByteArray key;
+    QDataStream stream(&key, QIODevice::WriteOnly);
+
+    stream << static_cast<int>(*data->GetPatternUnit()) << GetSAWidth() << IsSeamAllowance()
+           << IsSeamAllowanceBuiltIn();
+
+    const VPersistentHash<quint32, QSharedPointer<VGObject> > *objects = data->DataGObjects();
+    auto WriteNodes = [&stream, objects, data](const QVector<VPieceNode> &nodes)
+    {
+        stream << nodes.size();
+        for (int i = 0; i < nodes.size(); ++i)
+        {
+            const VPieceNode &node = nodes.at(i);
+            const QSharedPointer<VGObject> object = objects->value(node.GetId());
+            stream << node.GetId() << (object.isNull() ? 0 : object->revision())
+                   << static_cast<int>(node.GetTypeTool()) << node.GetReverse() << node.isExcluded()
+                   << node.GetSABefore(data) << node.GetSAAfter(data) // Formulas can depend on variables
+                   << static_cast<int>(node.GetAngleType()) << node.isNotch() << node.IsMainPathNode()
+                   << static_cast<int>(node.getNotchType()) << static_cast<int>(node.getNotchSubType())
+                   << node.showSeamlineNotch() << node.showNotch() << node.getNotchLength() << node.getNotchWidth()
+                   << node.getNotchAngle() << node.getNotchCount();
+        }
+    };
+
+    WriteNodes(d->m_path.GetNodes());
+
+    stream << d->m_customSARecords.size();
+    for (int i = 0; i < d->m_customSARecords.size(); ++i)
+    {
+        const CustomSARecord &record = d->m_customSARecords.at(i);
+        stream << record.startPoint << record.path << record.endPoint << record.reverse
+               << static_cast<int>(record.includeType);
+        try
+        {
+            WriteNodes(data->GetPiecePath(record.path).GetNodes());
+        }
+        catch (const VExceptionBadId &)
+        {
+            stream << -1;
+        }
+    }
+
+    return key;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QVector<VPieceNode> VPiece::GetUnitedPath(const VContainer *data) const
 {
@@ -82,6 +82,7 @@ class VPieceLabelData;
 class VGrainlineData;
 class VContainer;
 class QPainterPath;
+class QByteArray;
 class VPointF;
 
 class VPiece : public VAbstractPiece
@@ -156,9 +157,13 @@ class VPiece : public VAbstractPiece
     VGrainlineData&          GetGrainlineGeometry();
     const VGrainlineData&    GetGrainlineGeometry() const;
 
+    void                     ShareGeometryCache(const VPiece &piece);
+
 private:
     QSharedDataPointer<VPieceData> d;
 
+    QByteArray               GeometryKey(const VContainer *data) const;
+
     QVector<VPieceNode>      GetUnitedPath(const VContainer *data) const;
 
     QVector<CustomSARecord>  GetValidRecords() const;
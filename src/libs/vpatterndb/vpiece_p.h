@@ -52,7 +52,12 @@
 #ifndef VPIECE_P_H
 #define VPIECE_P_H
 
+#include <QByteArray>
+#include <QLineF>
+#include <QMutex>
+#include <QPointF>
 #include <QSharedData>
+#include <QSharedPointer>
 #include <QVector>
 
 #include "../vmisc/diagnostic.h"
@@ -67,6 +72,55 @@ QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_GCC("-Wnon-virtual-dtor")
 
+/**
+ * @brief The VPieceGeometryCache class keeps geometry of a piece together with the key of inputs it was calculated
+ * from. A value is valid only while the key is the same, so the cache can safely outlive the piece it was made for.
+ */
+class VPieceGeometryCache
+{
+public:
+    VPieceGeometryCache()
+        : mutex(),
+          key(),
+          mainPathValid(false),
+          mainPath(),
+          seamAllowanceValid(false),
+          seamAllowance(),
+          notchesValid(false),
+          notchesSeamAllowance(),
+          notches()
+    {}
+
+    /** @brief Prepare drop all values if they were calculated for other inputs. Call with locked mutex. */
+    void Prepare(const QByteArray &inputs)
+    {
+        if (key != inputs)
+        {
+            key = inputs;
+            mainPathValid = false;
+            mainPath.clear();
+            seamAllowanceValid = false;
+            seamAllowance.clear();
+            notchesValid = false;
+            notchesSeamAllowance.clear();
+            notches.clear();
+        }
+    }
+
+    QMutex           mutex;
+    QByteArray       key;
+    bool             mainPathValid;
+    QVector<QPointF> mainPath;
+    bool             seamAllowanceValid;
+    QVector<QPointF> seamAllowance;
+    bool             notchesValid;
+    QVector<QPointF> notchesSeamAllowance; //! @brief notchesSeamAllowance seam allowance notches were created for.
+    QVector<QLineF>  notches;
+
+private:
+    Q_DISABLE_COPY(VPieceGeometryCache)
+};
+
 class VPieceData : public QSharedData
 {
 public:
@@ -82,6 +136,7 @@ class VPieceData : public QSharedData
         , m_piPatternInfo()
         , m_glGrainline()
         , m_formulaWidth('0')
+        , m_geometryCache(new VPieceGeometryCache())
     {}
 
     VPieceData(const VPieceData &piece)
@@ -97,6 +152,8 @@ class VPieceData : public QSharedData
         , m_piPatternInfo(piece.m_piPatternInfo)
         , m_glGrainline(piece.m_glGrainline)
         , m_formulaWidth(piece.m_formulaWidth)
+        // A copy is made to change the piece, so it starts with own cache.
+        , m_geometryCache(new VPieceGeometryCache())
     {}
 
     ~VPieceData();
@@ -113,6 +170,8 @@ class VPieceData : public QSharedData
     VGrainlineData          m_glGrainline;   //! @brief m_glGrainline grainline geometry object
     QString                 m_formulaWidth;
 
+    QSharedPointer<VPieceGeometryCache> m_geometryCache;
+
 private:
     VPieceData              &operator=(const VPieceData &) Q_DECL_EQ_DELETE;
 };
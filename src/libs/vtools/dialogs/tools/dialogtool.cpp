@@ -257,7 +257,7 @@ void DialogTool::FillComboBoxSplines(QComboBox *box) const
     box->blockSignals(true);
 
     const auto objs = data->DataGObjects();
-    QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
+    VPersistentHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
     QMap<QString, quint32> list;
     for (i = objs->constBegin(); i != objs->constEnd(); ++i)
     {
@@ -281,7 +281,7 @@ void DialogTool::FillComboBoxSplinesPath(QComboBox *box) const
     box->blockSignals(true);
 
     const auto objs = data->DataGObjects();
-    QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
+    VPersistentHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
     QMap<QString, quint32> list;
     for (i = objs->constBegin(); i != objs->constEnd(); ++i)
     {
@@ -304,7 +304,7 @@ void DialogTool::FillComboBoxCurves(QComboBox *box) const
     SCASSERT(box != nullptr)
     const auto objs = data->DataGObjects();
     QMap<QString, quint32> list;
-    QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
+    VPersistentHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
     for (i = objs->constBegin(); i != objs->constEnd(); ++i)
     {
         if (i.key() != toolId)
@@ -1400,8 +1400,8 @@ void DialogTool::FillCombo(QComboBox *box, GOType gType, FillComboBox rule, cons
     SCASSERT(box != nullptr)
     box->blockSignals(true);
 
-    const QHash<quint32, QSharedPointer<VGObject> > *objs = data->DataGObjects();
-    QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
+    const VPersistentHash<quint32, QSharedPointer<VGObject> > *objs = data->DataGObjects();
+    VPersistentHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
     QMap<QString, quint32> list;
     for (i = objs->constBegin(); i != objs->constEnd(); ++i)
     {
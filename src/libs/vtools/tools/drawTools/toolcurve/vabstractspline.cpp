@@ -84,6 +84,7 @@ VAbstractSpline::VAbstractSpline(VAbstractPattern *doc, VContainer *data, quint3
     , sceneType(SceneObject::Unknown)
     , m_isHovered(false)
     , m_piecesMode(qApp->Settings()->getShowControlPoints())
+    , m_lodPath()
 {
     InitDefShape();
     setAcceptHoverEvents(true);
@@ -120,7 +121,8 @@ void VAbstractSpline::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
 
     const QSharedPointer<VAbstractCurve> curve = VAbstractTool::data.GeometricObject<VAbstractCurve>(m_id);
     const qreal weight = ToPixel(doc->useGroupLineWeight(m_id, curve->getLineWeight()).toDouble(), Unit::Mm);
-    const qreal width  = scaleWidth(m_isHovered ? weight + 4 : weight, sceneScale(scene()));
+    const qreal scale  = sceneScale(scene());
+    const qreal width  = scaleWidth(m_isHovered ? weight + 4 : weight, scale);
 
     setPen(QPen(correctColor(this, doc->useGroupColor(m_id, curve->getLineColor())), width,
            lineTypeToPenStyle(doc->useGroupLineType(m_id, curve->GetPenStyle())), Qt::RoundCap));
@@ -139,11 +141,20 @@ void VAbstractSpline::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
 
         painter->drawPath(VAbstractCurve::ShowDirection(curve->DirectionArrows(),
                                                         scaleWidth(VAbstractCurve::lengthCurveDirectionArrow,
-                                                                   sceneScale(scene()))));
+                                                                   scale)));
 
         painter->restore();
     }
 
+    const QPainterPath &lodPath = m_lodPath.path(path(), itemLevelOfDetail(option, painter));
+    if (not lodPath.isEmpty() && not m_isHovered && not isSelected())
+    {
+        painter->setPen(pen());
+        painter->setBrush(brush());
+        painter->drawPath(lodPath);
+        return;
+    }
+
     QGraphicsPathItem::paint(painter, option, widget);
 }
 
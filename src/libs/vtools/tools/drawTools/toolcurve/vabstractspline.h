@@ -71,6 +71,7 @@
 #include "../vgeometry/vgeometrydef.h"
 #include "../vmisc/vabstractapplication.h"
 #include "../vmisc/def.h"
+#include "../vwidgets/global.h"
 #include "../vwidgets/vmaingraphicsscene.h"
 #include "../vwidgets/vmaingraphicsview.h"
 
@@ -131,6 +132,7 @@ public slots:
     SceneObject          sceneType;
     bool                 m_isHovered;
     bool                 m_piecesMode;
+    VDecimatedPathCache  m_lodPath; /** @brief m_lodPath simplified curve drawn when zoomed out. */
 
     /**
      * @brief RefreshGeometry  refresh item on scene.
@@ -100,7 +100,7 @@ VToolAlongLine::VToolAlongLine(VAbstractPattern *doc, VContainer *data, quint32
                                const Source &typeCreation, QGraphicsItem *parent)
     :VToolLinePoint(doc, data, id, lineType, lineWeight, lineColor, formula, firstPointId, 0, parent), secondPointId(secondPointId)
 {
-    m_pointColor = QColor(lineColor);
+    setPointColor(lineColor);
     ToolCreation(typeCreation);
 }
 
@@ -139,7 +139,7 @@ QString VToolInternalPath::getTagName() const
 //---------------------------------------------------------------------------------------------------------------------
 void VToolInternalPath::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    qreal lineWeight = ToPixel(qApp->Settings()->getDefaultInternalLineweight(), Unit::Mm);
+    const qreal lineWeight = ToPixel(qApp->Settings()->getSceneSettings().internalLineweight, Unit::Mm);
 
     QPen toolPen = pen();
     toolPen.setWidthF(scaleWidth(lineWeight, sceneScale(scene())));
@@ -880,14 +880,15 @@ void PatternPieceTool::SaveRotateGrainline(qreal dRot, const QPointF &ptPos)
  */
 void PatternPieceTool::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
+    const VSceneSettings &settings = qApp->Settings()->getSceneSettings();
     QColor  color;
     QString lineType;
     qreal   lineWeight;
 
     //set cutline pen
-    color      = QColor(qApp->Settings()->getDefaultCutColor());
-    lineType   = qApp->Settings()->getDefaultCutLinetype();
-    lineWeight = ToPixel(qApp->Settings()->getDefaultCutLineweight(), Unit::Mm);
+    color      = settings.cutColor;
+    lineType   = settings.cutLinetype;
+    lineWeight = ToPixel(settings.cutLineweight, Unit::Mm);
 
     m_cutLine->setPen(QPen(color, scaleWidth(lineWeight, sceneScale(scene())),
                            lineTypeToPenStyle(lineType), Qt::RoundCap, Qt::RoundJoin));
@@ -896,19 +897,19 @@ void PatternPieceTool::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     //set seamline pen
     const VPiece piece = VAbstractTool::data.GetPiece(m_id);
 
-    if (qApp->Settings()->showSeamAllowances())
+    if (settings.showSeamAllowances)
     {
         if (piece.IsSeamAllowance() && !piece.IsSeamAllowanceBuiltIn())
         {
-            color      = QColor(qApp->Settings()->getDefaultSeamColor());
-            lineType   = qApp->Settings()->getDefaultSeamLinetype();
-            lineWeight = ToPixel(qApp->Settings()->getDefaultSeamLineweight(), Unit::Mm);
+            color      = settings.seamColor;
+            lineType   = settings.seamLinetype;
+            lineWeight = ToPixel(settings.seamLineweight, Unit::Mm);
         }
         else
         {
-            color      = QColor(qApp->Settings()->getDefaultCutColor());
-            lineType   = qApp->Settings()->getDefaultCutLinetype();
-            lineWeight = ToPixel(qApp->Settings()->getDefaultCutLineweight(), Unit::Mm);
+            color      = settings.cutColor;
+            lineType   = settings.cutLinetype;
+            lineWeight = ToPixel(settings.cutLineweight, Unit::Mm);
         }
 
         m_seamLine->setPen(QPen(color, scaleWidth(lineWeight, sceneScale(scene())),
@@ -923,7 +924,7 @@ void PatternPieceTool::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     }
 
     //set notches pen
-    color = QColor(qApp->Settings()->getDefaultNotchColor());
+    color = settings.notchColor;
     m_notches->setPen(QPen(color, scaleWidth(lineWeight, sceneScale(scene())),
                            Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
 
@@ -1080,6 +1081,11 @@ QVariant PatternPieceTool::itemChange(QGraphicsItem::GraphicsItemChange change,
         }
     }
 
+    if (change == QGraphicsItem::ItemSelectedHasChanged)
+    {
+        updateCacheMode();
+    }
+
     if (change == QGraphicsItem::ItemSelectedChange)
     {
         if (value == true)
@@ -1138,6 +1144,9 @@ void PatternPieceTool::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
 //---------------------------------------------------------------------------------------------------------------------
 void PatternPieceTool::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 {
+    m_isHovered = true;
+    updateCacheMode();
+
     if (flags() & QGraphicsItem::ItemIsMovable)
     {
         SetItemOverrideCursor(this, cursorArrowOpenHand, 1, 1);
@@ -1148,6 +1157,9 @@ void PatternPieceTool::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 //---------------------------------------------------------------------------------------------------------------------
 void PatternPieceTool::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
 {
+    m_isHovered = false;
+    updateCacheMode();
+
     //Disable cursor-arrow-openhand
     if (flags() & QGraphicsItem::ItemIsMovable)
     {
@@ -1446,6 +1458,7 @@ PatternPieceTool::PatternPieceTool(VAbstractPattern *doc, VContainer *data, cons
     , m_patternInfo(new VTextGraphicsItem(this))
     , m_grainLine(new VGrainlineItem(this))
     , m_notches(new QGraphicsPathItem(this))
+    , m_isHovered(false)
 {
     VPiece piece = data->GetPiece(id);
     initializeNodes(piece, scene);
@@ -1483,6 +1496,7 @@ PatternPieceTool::PatternPieceTool(VAbstractPattern *doc, VContainer *data, cons
     connect(m_pieceScene, &VMainGraphicsScene::LanguageChanged,   this, &PatternPieceTool::retranslateUi);
 
     updatePieceDetails();
+    applyScale(sceneScale(m_pieceScene));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1503,6 +1517,33 @@ void PatternPieceTool::UpdateExcludeState()
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void PatternPieceTool::updateScale(qreal scale)
+{
+    Q_UNUSED(scale)
+    updateCacheMode();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateCacheMode level of detail for the piece. When zoomed out, a piece that is not being edited is drawn
+ * from a pixmap cache, so repaints caused by panning or by other items do not redraw its paths.
+ */
+void PatternPieceTool::updateCacheMode()
+{
+    const QGraphicsItem::CacheMode mode = currentScale() < levelOfDetailScale && not isSelected() && not m_isHovered
+                                          ? QGraphicsItem::DeviceCoordinateCache : QGraphicsItem::NoCache;
+    if (cacheMode() == mode)
+    {
+        return;
+    }
+
+    setCacheMode(mode);
+    m_cutLine->setCacheMode(mode);
+    m_seamLine->setCacheMode(mode);
+    m_notches->setCacheMode(mode);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void PatternPieceTool::RefreshGeometry()
 {
@@ -60,13 +60,14 @@
 
 #include "vinteractivetool.h"
 
+#include "../vwidgets/global.h"
 #include "../vwidgets/vtextgraphicsitem.h"
 #include "../vwidgets/vgrainlineitem.h"
 
 class DialogTool;
 class NonScalingFillPathItem;
 
-class PatternPieceTool : public VInteractiveTool, public QGraphicsPathItem
+class PatternPieceTool : public VInteractiveTool, public QGraphicsPathItem, public VScaleSensitiveItem
 {
     Q_OBJECT
 public:
@@ -170,6 +171,7 @@ protected slots:
     virtual void         ToolCreation(const Source &typeCreation) Q_DECL_OVERRIDE;
     virtual void         SetDialog() Q_DECL_FINAL;
     virtual void         SaveDialogChange() Q_DECL_FINAL;
+    virtual void         updateScale(qreal scale) Q_DECL_OVERRIDE;
 
 private:
     Q_DISABLE_COPY(PatternPieceTool)
@@ -185,12 +187,14 @@ protected slots:
     VTextGraphicsItem     *m_patternInfo;
     VGrainlineItem        *m_grainLine;
     QGraphicsPathItem     *m_notches;
+    bool                   m_isHovered;
 
                            PatternPieceTool(VAbstractPattern *doc, VContainer *data, const quint32 &id,
                                               const Source &typeCreation, VMainGraphicsScene *scene,
                                               const QString &blockName, QGraphicsItem * parent = nullptr);
 
     void                  UpdateExcludeState();
+    void                  updateCacheMode();
     VPieceItem::MoveTypes FindLabelGeometry(const VPatternLabelData &labelData, qreal &rotationAngle, qreal &labelWidth,
                                             qreal &labelHeight, QPointF &pos);
 
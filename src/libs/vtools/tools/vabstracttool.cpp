@@ -153,7 +153,13 @@ VAbstractTool::VAbstractTool(VAbstractPattern *doc, VContainer *data, quint32 id
 {
     SCASSERT(doc != nullptr)
     connect(this, &VAbstractTool::toolHasChanges, this->doc, &VAbstractPattern::haveLiteChange);
-    connect(this->doc, &VAbstractPattern::FullUpdateFromFile, this, &VAbstractTool::FullUpdateFromFile);
+    connect(this->doc, &VAbstractPattern::FullUpdateFromFile, this, [this]()
+    {
+        if (this->doc->IsToolUpdateRequired(m_id))
+        {
+            FullUpdateFromFile();
+        }
+    });
     connect(this, &VAbstractTool::LiteUpdateTree, this->doc, &VAbstractPattern::LiteParseTree);
 }
 
@@ -501,9 +507,9 @@ const QStringList VAbstractTool::fills()
 // cppcheck-suppress unusedFunction
 QMap<QString, quint32> VAbstractTool::PointsList() const
 {
-    const QHash<quint32, QSharedPointer<VGObject> > *objs = data.DataGObjects();
+    const VPersistentHash<quint32, QSharedPointer<VGObject> > *objs = data.DataGObjects();
     QMap<QString, quint32> list;
-    QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
+    VPersistentHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
     for (i = objs->constBegin(); i != objs->constEnd(); ++i)
     {
         if (i.key() != m_id)
@@ -128,6 +128,7 @@ void MoveSplinePath::Do(const VSplinePath &splPath)
     {
         VToolSplinePath::UpdatePathPoints(doc, domElement, splPath);
 
+        doc->MarkObjectChanged(nodeId);
         emit NeedLiteParsing(Document::LiteParse);
     }
     else
@@ -149,6 +149,7 @@ void MoveSPoint::Do(double x, double y)
         doc->SetAttribute(domElement, AttrX, QString().setNum(qApp->fromPixel(x)));
         doc->SetAttribute(domElement, AttrY, QString().setNum(qApp->fromPixel(y)));
 
+        doc->MarkObjectChanged(nodeId);
         emit NeedLiteParsing(Document::LiteBlockParse);
     }
     else
@@ -51,13 +51,95 @@
 
 #include "savetooloptions.h"
 
+#include <QDomAttr>
+#include <QDomNamedNodeMap>
 #include <QDomNode>
+#include <QDomNodeList>
+#include <QStringList>
 
 #include "../vmisc/def.h"
 #include "../vmisc/logging.h"
+#include "../ifc/ifcdef.h"
 #include "../ifc/xml/vabstractpattern.h"
 #include "vundocommand.h"
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief OnlyValuesChanged check if two versions of a tool tag differ only in formulas and positions.
+ *
+ * A changed name or object id changes variable names and dependencies, such changes need a full lite parse. Any value
+ * that looks like an id is treated as an id.
+ */
+bool OnlyValuesChanged(const QDomElement &oldXml, const QDomElement &newXml)
+{
+    if (oldXml.tagName() != newXml.tagName())
+    {
+        return false;
+    }
+
+    const QDomNamedNodeMap oldAttributes = oldXml.attributes();
+    const QDomNamedNodeMap newAttributes = newXml.attributes();
+    if (oldAttributes.count() != newAttributes.count())
+    {
+        return false;
+    }
+
+    const QStringList names = QStringList() << AttrName << AttrName1 << AttrName2 << AttrAlias << AttrSuffix;
+    for (int i = 0; i < oldAttributes.count(); ++i)
+    {
+        const QDomAttr attribute = oldAttributes.item(i).toAttr();
+        if (not newAttributes.contains(attribute.name()))
+        {
+            return false;
+        }
+
+        const QString newValue = newAttributes.namedItem(attribute.name()).toAttr().value();
+        if (attribute.value() != newValue)
+        {
+            if (names.contains(attribute.name()))
+            {
+                return false;
+            }
+
+            bool oldIsId = false;
+            bool newIsId = false;
+            attribute.value().toUInt(&oldIsId);
+            newValue.toUInt(&newIsId);
+            if (oldIsId || newIsId)
+            {
+                return false;
+            }
+        }
+    }
+
+    const QDomNodeList oldChildren = oldXml.childNodes();
+    const QDomNodeList newChildren = newXml.childNodes();
+    if (oldChildren.size() != newChildren.size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < oldChildren.size(); ++i)
+    {
+        const QDomElement oldChild = oldChildren.at(i).toElement();
+        const QDomElement newChild = newChildren.at(i).toElement();
+        if (oldChild.isNull() != newChild.isNull())
+        {
+            return false;
+        }
+
+        if (not oldChild.isNull() && not OnlyValuesChanged(oldChild, newChild))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 SaveToolOptions::SaveToolOptions(const QDomElement &oldXml, const QDomElement &newXml, VAbstractPattern *doc,
                                  const quint32 &id, QUndoCommand *parent)
@@ -81,6 +163,10 @@ void SaveToolOptions::undo()
     {
         domElement.parentNode().replaceChild(oldXml, domElement);
 
+        if (OnlyValuesChanged(newXml, oldXml))
+        {
+            doc->MarkObjectChanged(nodeId, true);
+        }
         emit NeedLiteParsing(Document::LiteParse);
     }
     else
@@ -100,6 +186,10 @@ void SaveToolOptions::redo()
     {
         domElement.parentNode().replaceChild(newXml, domElement);
 
+        if (OnlyValuesChanged(oldXml, newXml))
+        {
+            doc->MarkObjectChanged(nodeId, true);
+        }
         emit NeedLiteParsing(Document::LiteParse);
     }
     else
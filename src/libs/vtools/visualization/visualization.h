@@ -38,6 +38,7 @@
 #include "../vmisc/def.h"
 #include "../vmisc/logging.h"
 #include "../vmisc/vabstractapplication.h"
+#include "../vpatterndb/vpersistenthash.h"
 #include "../vwidgets/global.h"
 #include "../vwidgets/scalesceneitems.h"
 #include "../vwidgets/vcurvepathitem.h"
@@ -80,9 +81,9 @@ class Visualization : public QObject
     Mode                   GetMode() const;
     void                   SetMode(const Mode &value);
 
-    static qreal           FindLength(const QString &expression, const QHash<QString,
+    static qreal           FindLength(const QString &expression, const VPersistentHash<QString,
                                       QSharedPointer<VInternalVariable> > *vars);
-    static qreal           FindVal(const QString &expression, const QHash<QString,
+    static qreal           FindVal(const QString &expression, const VPersistentHash<QString,
                                    QSharedPointer<VInternalVariable> > *vars);
 
     QString                CurrentToolTip() const {return toolTip;}
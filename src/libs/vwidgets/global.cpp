@@ -55,10 +55,16 @@
 #include <QGraphicsItem>
 #include <QGraphicsScene>
 #include <QGraphicsView>
+#include <QPainter>
+#include <QPainterPath>
+#include <QStyleOptionGraphicsItem>
 
 const qreal defPointRadiusPixel = (2./*mm*/ / 25.4) * PrintDPI;
 const qreal widthMainLine = (1.2/*mm*/ / 25.4) * PrintDPI;
 const qreal widthHairLine = widthMainLine/3.0;
+const qreal levelOfDetailScale = 1.0; // Below this view scale the scene draws simplified items
+const qreal minLabelPixelSize = 6; // Labels smaller than this on screen are not drawn
+const qreal curveTolerancePixel = 0.5; // Max on-screen deviation of a decimated curve
 
 qreal sceneScale(QGraphicsScene *scene)
 {
@@ -163,3 +169,126 @@ QPainterPath ItemShapeFromPath(const QPainterPath &path, const QPen &pen)
     p.addPath(path);
     return p;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief itemLevelOfDetail returns how many device pixels one item unit takes on the painted surface.
+ */
+qreal itemLevelOfDetail(const QStyleOptionGraphicsItem *option, const QPainter *painter)
+{
+    SCASSERT(option != nullptr)
+    SCASSERT(painter != nullptr)
+
+    return option->levelOfDetailFromTransform(painter->worldTransform());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief decimatedPath drops polyline vertices closer than tolerance to the previous kept vertex.
+ *
+ * The first and the last vertex of each subpath are always kept. Curve elements are copied unchanged.
+ * @param path source path.
+ * @param tolerance max deviation in path units.
+ * @return simplified path.
+ */
+QPainterPath decimatedPath(const QPainterPath &path, qreal tolerance)
+{
+    QPainterPath simplified;
+    simplified.setFillRule(path.fillRule());
+
+    const qreal toleranceSquared = tolerance * tolerance;
+    const int count = path.elementCount();
+    QPointF lastKept;
+
+    for (int i = 0; i < count; ++i)
+    {
+        const QPainterPath::Element e = path.elementAt(i);
+        switch (e.type)
+        {
+            case QPainterPath::MoveToElement:
+                simplified.moveTo(e);
+                lastKept = e;
+                break;
+            case QPainterPath::LineToElement:
+            {
+                const bool lastOfSubpath = (i + 1 == count || path.elementAt(i + 1).isMoveTo());
+                const QPointF delta = QPointF(e) - lastKept;
+                if (lastOfSubpath || QPointF::dotProduct(delta, delta) >= toleranceSquared)
+                {
+                    simplified.lineTo(e);
+                    lastKept = e;
+                }
+                break;
+            }
+            case QPainterPath::CurveToElement:
+            {
+                // A curve is always followed by two CurveToDataElement
+                const QPainterPath::Element c2 = path.elementAt(i + 1);
+                const QPainterPath::Element end = path.elementAt(i + 2);
+                simplified.cubicTo(e, c2, end);
+                lastKept = end;
+                i += 2;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    return simplified;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VScaleSensitiveItem::VScaleSensitiveItem()
+    : m_scale(0)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VScaleSensitiveItem::applyScale(qreal scale)
+{
+    if (not qFuzzyCompare(m_scale, scale))
+    {
+        m_scale = scale;
+        updateScale(scale);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateSettings refreshes pens, colors and fonts that come from scene settings. Called after the settings
+ * changed, items that don't use them keep the default empty implementation.
+ */
+void VScaleSensitiveItem::updateSettings()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal VScaleSensitiveItem::currentScale() const
+{
+    return m_scale > 0 ? m_scale : 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VDecimatedPathCache::VDecimatedPathCache()
+    : m_source(),
+      m_decimated(),
+      m_scale(0)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief path returns the decimated source path for the level of detail the path is painted at.
+ *
+ * The result is rebuilt only when the source path or the scale change. Comparing unchanged paths is cheap because
+ * QPainterPath is implicitly shared.
+ * @return empty path if the scale does not need a level of detail.
+ */
+const QPainterPath &VDecimatedPathCache::path(const QPainterPath &source, qreal scale)
+{
+    if (m_source != source || not qFuzzyCompare(m_scale, scale))
+    {
+        m_source = source;
+        m_scale = scale;
+        m_decimated = scale < levelOfDetailScale ? decimatedPath(source, curveTolerancePixel / scale) : QPainterPath();
+    }
+    return m_decimated;
+}
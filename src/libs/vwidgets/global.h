@@ -52,11 +52,15 @@
 #ifndef GLOBAL_H
 #define GLOBAL_H
 
+#include <QPainterPath>
 #include <QtGlobal>
 
 extern const qreal defPointRadiusPixel;
 extern const qreal widthMainLine;
 extern const qreal widthHairLine;
+extern const qreal levelOfDetailScale;
+extern const qreal minLabelPixelSize;
+extern const qreal curveTolerancePixel;
 
 class QGraphicsScene;
 class QGraphicsItem;
@@ -65,8 +69,9 @@ class QGraphicsRectItem;
 class QGraphicsLineItem;
 class QColor;
 class QRectF;
-class QPainterPath;
 class QPen;
+class QPainter;
+class QStyleOptionGraphicsItem;
 
 qreal sceneScale(QGraphicsScene *scene);
 
@@ -80,4 +85,48 @@ qreal  scaleWidth(qreal width, qreal scale);
 
 QPainterPath ItemShapeFromPath(const QPainterPath &path, const QPen &pen);
 
+qreal        itemLevelOfDetail(const QStyleOptionGraphicsItem *option, const QPainter *painter);
+QPainterPath decimatedPath(const QPainterPath &path, qreal tolerance);
+
+/**
+ * @brief The VScaleSensitiveItem class is a mixin for scene items whose pen width or size depend on the view scale.
+ *
+ * VMainGraphicsScene pushes the new scale to every such item when the view zooms, and the new scene settings when they
+ * change. Items pick up the current scale when they are added to a scene, so paint() only reads cached pens and sizes.
+ */
+class VScaleSensitiveItem
+{
+public:
+                 VScaleSensitiveItem();
+    virtual     ~VScaleSensitiveItem() = default;
+
+    void         applyScale(qreal scale);
+    virtual void updateSettings();
+
+protected:
+    qreal        currentScale() const;
+
+    /** @brief updateScale recalculates scale dependent pens and sizes. Called only when the scale changes. */
+    virtual void updateScale(qreal scale) =0;
+
+private:
+    qreal        m_scale;
+};
+
+/**
+ * @brief The VDecimatedPathCache class keeps a simplified copy of a path for drawing at low zoom.
+ */
+class VDecimatedPathCache
+{
+public:
+                        VDecimatedPathCache();
+
+    const QPainterPath &path(const QPainterPath &source, qreal scale);
+
+private:
+    QPainterPath m_source;
+    QPainterPath m_decimated;
+    qreal        m_scale;
+};
+
 #endif // GLOBAL_H
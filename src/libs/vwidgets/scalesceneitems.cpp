@@ -59,21 +59,32 @@
 //---------------------------------------------------------------------------------------------------------------------
 VScaledLine::VScaledLine(QGraphicsItem *parent)
     : QGraphicsLineItem(parent),
-      basicWidth(widthMainLine)
+      basicWidth(widthMainLine),
+      minLevelOfDetail(0)
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
 VScaledLine::VScaledLine(const QLineF &line, QGraphicsItem *parent)
     : QGraphicsLineItem(line, parent),
-      basicWidth(widthMainLine)
+      basicWidth(widthMainLine),
+      minLevelOfDetail(0)
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
 void VScaledLine::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    QPen lPen = pen();
-    lPen.setWidthF(scaleWidth(basicWidth, sceneScale(scene())));
-    setPen(lPen);
+    if (itemLevelOfDetail(option, painter) < minLevelOfDetail)
+    {
+        return;
+    }
+
+    applyScale(sceneScale(scene()));
+
+    // Visualizations set their own pen between repaints, restore the scaled width only if it was lost.
+    if (not qFuzzyCompare(pen().widthF(), scaleWidth(basicWidth, currentScale())))
+    {
+        updateScale(currentScale());
+    }
 
     QGraphicsLineItem::paint(painter, option, widget);
 }
@@ -90,25 +101,70 @@ void VScaledLine::setBasicWidth(const qreal &value)
     basicWidth = value;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VScaledLine::setMinLevelOfDetail(qreal value)
+{
+    minLevelOfDetail = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VScaledLine::updateScale(qreal scale)
+{
+    QPen lPen = pen();
+    lPen.setWidthF(scaleWidth(basicWidth, scale));
+    setPen(lPen);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 ArrowedLineItem::ArrowedLineItem(QGraphicsItem *parent)
     : QGraphicsLineItem(parent)
     , m_arrows(new VCurvePathItem(this))
+    , m_arrowsLine()
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
 ArrowedLineItem::ArrowedLineItem(const QLineF &line, QGraphicsItem *parent)
     : QGraphicsLineItem(line, parent)
     , m_arrows(new VCurvePathItem(this))
+    , m_arrowsLine()
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
 void ArrowedLineItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    applyScale(sceneScale(scene()));
+
+    if (not qFuzzyCompare(pen().widthF(), scaleWidth(widthMainLine, currentScale())))
+    {
+        updateScale(currentScale());
+    }
+
+    refreshArrows();
+
+    QGraphicsLineItem::paint(painter, option, widget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void ArrowedLineItem::updateScale(qreal scale)
 {
     QPen lPen = pen();
-    lPen.setWidthF(scaleWidth(widthMainLine, sceneScale(scene())));
+    lPen.setWidthF(scaleWidth(widthMainLine, scale));
     setPen(lPen);
     m_arrows->setPen(lPen);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief refreshArrows rebuilds the arrows path. The arrows do not depend on the scale, so the path is rebuilt only
+ * after the line has changed.
+ */
+void ArrowedLineItem::refreshArrows()
+{
+    if (m_arrowsLine == line())
+    {
+        return;
+    }
+    m_arrowsLine = line();
 
     QPainterPath path;
     path.moveTo(line().p1());
@@ -134,8 +190,6 @@ void ArrowedLineItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
         axis.setLength(axis.length()+arrow_step);
     }
     m_arrows->setPath(path);
-
-    QGraphicsLineItem::paint(painter, option, widget);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -166,14 +220,22 @@ VScaledEllipse::VScaledEllipse(QGraphicsItem *parent)
 //---------------------------------------------------------------------------------------------------------------------
 void VScaledEllipse::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    const qreal scale = sceneScale(scene());
-    const qreal width = scaleWidth(widthMainLine, scale);
+    applyScale(sceneScale(scene()));
+
+    if (not qFuzzyCompare(pen().widthF(), scaleWidth(widthMainLine, currentScale())))
+    {
+        updateScale(currentScale());
+    }
 
+    QGraphicsEllipseItem::paint(painter, option, widget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VScaledEllipse::updateScale(qreal scale)
+{
     QPen visPen = pen();
-    visPen.setWidthF(width);
+    visPen.setWidthF(scaleWidth(widthMainLine, scale));
 
     setPen(visPen);
     scaleCircleSize(this, scale);
-
-    QGraphicsEllipseItem::paint(painter, option, widget);
 }
@@ -55,11 +55,12 @@
 #include <QGraphicsLineItem>
 
 #include "../vmisc/def.h"
+#include "global.h"
 #include "vcurvepathitem.h"
 
 class VCurvePathItem;
 
-class VScaledLine : public QGraphicsLineItem
+class VScaledLine : public QGraphicsLineItem, public VScaleSensitiveItem
 {
 public:
     explicit     VScaledLine(QGraphicsItem * parent = nullptr);
@@ -75,13 +76,19 @@ class VScaledLine : public QGraphicsLineItem
     qreal        GetBasicWidth() const;
     void         setBasicWidth(const qreal &value);
 
+    void         setMinLevelOfDetail(qreal value);
+
+protected:
+    virtual void updateScale(qreal scale) Q_DECL_OVERRIDE;
+
 private:
     Q_DISABLE_COPY(VScaledLine)
 
     qreal        basicWidth;
+    qreal        minLevelOfDetail; /** @brief minLevelOfDetail the line is not drawn below this level of detail. */
 };
 
-class ArrowedLineItem : public QGraphicsLineItem
+class ArrowedLineItem : public QGraphicsLineItem, public VScaleSensitiveItem
 {
 public:
     explicit     ArrowedLineItem(QGraphicsItem * parent = nullptr);
@@ -94,13 +101,18 @@ class ArrowedLineItem : public QGraphicsLineItem
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                        QWidget *widget = nullptr) Q_DECL_OVERRIDE;
 
+protected:
+    virtual void updateScale(qreal scale) Q_DECL_OVERRIDE;
+
 private:
     Q_DISABLE_COPY(ArrowedLineItem)
     void           drawArrow(const QLineF &axis, QPainterPath &path, const qreal &arrow_size);
+    void           refreshArrows();
     VCurvePathItem *m_arrows;
+    QLineF          m_arrowsLine; /** @brief m_arrowsLine line the arrows path was built for. */
 };
 
-class VScaledEllipse : public QGraphicsEllipseItem
+class VScaledEllipse : public QGraphicsEllipseItem, public VScaleSensitiveItem
 {
 public:
     explicit     VScaledEllipse(QGraphicsItem * parent = nullptr);
@@ -111,6 +123,10 @@ class VScaledEllipse : public QGraphicsEllipseItem
 
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                        QWidget *widget = nullptr) Q_DECL_OVERRIDE;
+
+protected:
+    virtual void updateScale(qreal scale) Q_DECL_OVERRIDE;
+
 private:
     Q_DISABLE_COPY(VScaledEllipse)
 };
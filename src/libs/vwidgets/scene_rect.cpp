@@ -53,12 +53,20 @@ SceneRect::SceneRect(const QColor &lineColor, QGraphicsItem *parent)
 //---------------------------------------------------------------------------------------------------------------------
 void SceneRect::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    const qreal scale = sceneScale(scene());
+    QGraphicsRectItem::paint(painter, option, widget);
+}
 
-    setRectPen(scale);
+//---------------------------------------------------------------------------------------------------------------------
+void SceneRect::updateScale(qreal scale)
+{
     scaleRectSize(this, scale * .75);
+    setRectPen(scale);
+}
 
-    QGraphicsRectItem::paint(painter, option, widget);
+//---------------------------------------------------------------------------------------------------------------------
+void SceneRect::updateSettings()
+{
+    setRectPen(currentScale());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -81,15 +89,18 @@ bool SceneRect::isOnlyPoint() const
     return m_onlyPoint;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
 void SceneRect::setPointColor(const QString &value)
 {
     m_rectColor = QColor(value);
+    setRectPen(currentScale());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void SceneRect::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = true;
+    setRectPen(currentScale());
     QGraphicsRectItem::hoverEnterEvent(event);
 }
 
@@ -97,9 +108,22 @@ void SceneRect::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 void SceneRect::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = false;
+    setRectPen(currentScale());
     QGraphicsRectItem::hoverLeaveEvent(event);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+QVariant SceneRect::itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant &value)
+{
+    if (change == QGraphicsItem::ItemSceneHasChanged && scene() != nullptr)
+    {
+        applyScale(sceneScale(scene()));
+        updateSettings();
+    }
+
+    return QGraphicsRectItem::itemChange(change, value);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void SceneRect::setRectPen(qreal scale)
 {
@@ -109,7 +133,7 @@ void SceneRect::setRectPen(qreal scale)
     brushColor.setAlpha(100);
 
     setPen(QPen(m_rectColor, width));
-    if (!qApp->Settings()->isWireframe())
+    if (!qApp->Settings()->getSceneSettings().wireframe)
     {
        setBrush(QBrush(brushColor, Qt::SolidPattern));
     }
@@ -31,11 +31,12 @@
 #include <QGraphicsRectItem>
 
 #include "../vmisc/def.h"
+#include "global.h"
 
 class VPointF;
 class VScaledLine;
 
-class SceneRect: public QGraphicsRectItem
+class SceneRect: public QGraphicsRectItem, public VScaleSensitiveItem
 {
 public:
     explicit                 SceneRect(const QColor &lineColor, QGraphicsItem *parent = nullptr);
@@ -55,12 +56,16 @@ class SceneRect: public QGraphicsRectItem
 
     virtual void             hoverEnterEvent(QGraphicsSceneHoverEvent *event) Q_DECL_OVERRIDE;
     virtual void             hoverLeaveEvent(QGraphicsSceneHoverEvent *event) Q_DECL_OVERRIDE;
+    virtual QVariant         itemChange(GraphicsItemChange change, const QVariant &value) Q_DECL_OVERRIDE;
 
     void                     setOnlyPoint(bool value);
     bool                     isOnlyPoint() const;
 
     void                     setPointColor(const QString &value);
 
+    virtual void             updateScale(qreal scale) Q_DECL_OVERRIDE;
+    virtual void             updateSettings() Q_DECL_OVERRIDE;
+
 private:
     Q_DISABLE_COPY(SceneRect)
 
@@ -115,16 +115,6 @@ VControlPointSpline::VControlPointSpline(const qint32 &indexSpline, SplinePointP
     setCtrlLine(controlPoint, splinePoint);
 }
 
-//---------------------------------------------------------------------------------------------------------------------
-void VControlPointSpline::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
-{
-    QPen lPen = controlLine->pen();
-    lPen.setColor(correctColor(controlLine, Qt::black));
-    controlLine->setPen(lPen);
-
-    SceneRect::paint(painter, option, widget);
-}
-
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief hoverEnterEvent handle hover enter events.
@@ -160,6 +150,9 @@ QVariant VControlPointSpline::itemChange(QGraphicsItem::GraphicsItemChange chang
 {
     switch (change)
     {
+        case ItemEnabledHasChanged:
+            setCtrlLinePen();
+            break;
         case ItemPositionChange:
         {
             if (not freeAngle || not freeLength)
@@ -277,6 +270,15 @@ void VControlPointSpline::init()
     controlLine = new VScaledLine(this);
     controlLine->setBasicWidth(widthHairLine);
     controlLine->setFlag(QGraphicsItem::ItemStacksBehindParent, true);
+    setCtrlLinePen();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VControlPointSpline::setCtrlLinePen()
+{
+    QPen lPen = controlLine->pen();
+    lPen.setColor(correctColor(controlLine, Qt::black));
+    controlLine->setPen(lPen);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -316,8 +318,8 @@ void VControlPointSpline::refreshCtrlPoint(const qint32 &indexSpline, SplinePoin
  */
 void VControlPointSpline::setEnabledPoint(bool enable)
 {
-    setEnabled(enable);
     controlLine->setEnabled(enable);
+    setEnabled(enable);
 
     setFlag(QGraphicsItem::ItemIsSelectable, enable);
     setFlag(QGraphicsItem::ItemIsMovable, enable);
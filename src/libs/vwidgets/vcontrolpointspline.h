@@ -83,8 +83,6 @@ class VControlPointSpline : public QObject, public SceneRect
     virtual int         type() const Q_DECL_OVERRIDE {return Type;}
     enum                { Type = UserType + static_cast<int>(Vis::ControlPointSpline)};
 
-    virtual void        paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
-                              QWidget *widget = nullptr) Q_DECL_OVERRIDE;
 signals:
     /**
      * @brief ControlPointChangePosition emit when control point change position.
@@ -129,6 +127,7 @@ public slots:
 
     void                init();
     void                setCtrlLine(const QPointF &controlPoint, const QPointF &splinePoint);
+    void                setCtrlLinePen();
 };
 
 #endif // VCONTROLPOINTSPLINE_H
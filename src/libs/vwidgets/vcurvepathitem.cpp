@@ -59,7 +59,10 @@
 VCurvePathItem::VCurvePathItem(QGraphicsItem *parent)
     : QGraphicsPathItem(parent),
       m_directionArrows(),
-      m_points()
+      m_points(),
+      m_arrowsPath(),
+      m_scaledPen(),
+      m_lodPath()
 {
 }
 
@@ -81,12 +84,9 @@ QPainterPath VCurvePathItem::shape() const
         itemPath = path();
     }
 
-    const QPainterPath arrowsPath = VAbstractCurve::ShowDirection(m_directionArrows,
-                                                                  scaleWidth(VAbstractCurve::lengthCurveDirectionArrow,
-                                                                             sceneScale(scene())));
-    if (arrowsPath != QPainterPath())
+    if (m_arrowsPath != QPainterPath())
     {
-        itemPath.addPath(arrowsPath);
+        itemPath.addPath(m_arrowsPath);
     }
     itemPath.setFillRule(Qt::WindingFill);
     return ItemShapeFromPath(itemPath, pen());
@@ -95,13 +95,16 @@ QPainterPath VCurvePathItem::shape() const
 //---------------------------------------------------------------------------------------------------------------------
 void VCurvePathItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    ScalePenWidth();
+    applyScale(sceneScale(scene()));
 
-    const QPainterPath arrowsPath = VAbstractCurve::ShowDirection(m_directionArrows,
-                                                                  scaleWidth(VAbstractCurve::lengthCurveDirectionArrow,
-                                                                             sceneScale(scene())));
+    // Visualizations set their own pen between repaints, rescale it only if it was replaced.
+    if (pen() != m_scaledPen)
+    {
+        ScalePenWidth();
+        m_scaledPen = pen();
+    }
 
-    if (arrowsPath != QPainterPath())
+    if (m_arrowsPath != QPainterPath())
     {
         painter->save();
 
@@ -110,11 +113,20 @@ void VCurvePathItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
 
         painter->setPen(arrowPen);
         painter->setBrush(brush());
-        painter->drawPath(arrowsPath);
+        painter->drawPath(m_arrowsPath);
 
         painter->restore();
     }
 
+    const QPainterPath &lodPath = m_lodPath.path(path(), itemLevelOfDetail(option, painter));
+    if (not lodPath.isEmpty() && not isSelected())
+    {
+        painter->setPen(pen());
+        painter->setBrush(brush());
+        painter->drawPath(lodPath);
+        return;
+    }
+
     QGraphicsPathItem::paint(painter, option, widget);
 }
 
@@ -122,6 +134,7 @@ void VCurvePathItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
 void VCurvePathItem::SetDirectionArrows(const QVector<QPair<QLineF, QLineF> > &arrows)
 {
     m_directionArrows = arrows;
+    RefreshArrowsPath();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -133,10 +146,26 @@ void VCurvePathItem::SetPoints(const QVector<QPointF> &points)
 //---------------------------------------------------------------------------------------------------------------------
 void VCurvePathItem::ScalePenWidth()
 {
-    const qreal width = scaleWidth(widthMainLine, sceneScale(scene()));
+    const qreal width = scaleWidth(widthMainLine, currentScale());
 
     QPen toolPen = pen();
     toolPen.setWidthF(width);
 
     setPen(toolPen);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void VCurvePathItem::updateScale(qreal scale)
+{
+    Q_UNUSED(scale)
+    ScalePenWidth();
+    m_scaledPen = pen();
+    RefreshArrowsPath();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VCurvePathItem::RefreshArrowsPath()
+{
+    m_arrowsPath = VAbstractCurve::ShowDirection(m_directionArrows,
+                                                 scaleWidth(VAbstractCurve::lengthCurveDirectionArrow, currentScale()));
+}
@@ -53,11 +53,14 @@
 #define VCURVEPATHITEM_H
 
 #include <QGraphicsPathItem>
+#include <QPainterPath>
+#include <QPen>
 #include <QtGlobal>
 
 #include "../vmisc/def.h"
+#include "global.h"
 
-class VCurvePathItem : public QGraphicsPathItem
+class VCurvePathItem : public QGraphicsPathItem, public VScaleSensitiveItem
 {
 public:
     explicit VCurvePathItem(QGraphicsItem *parent = nullptr);
@@ -75,11 +78,17 @@ class VCurvePathItem : public QGraphicsPathItem
     void SetPoints(const QVector<QPointF> &points);
 protected:
     virtual void ScalePenWidth();
+    virtual void updateScale(qreal scale) Q_DECL_OVERRIDE;
 private:
     Q_DISABLE_COPY(VCurvePathItem)
 
     QVector<QPair<QLineF, QLineF>> m_directionArrows;
     QVector<QPointF> m_points;
+    QPainterPath     m_arrowsPath; /** @brief m_arrowsPath direction arrows sized for the current scale. */
+    QPen             m_scaledPen;  /** @brief m_scaledPen last pen set by ScalePenWidth(). */
+    VDecimatedPathCache m_lodPath; /** @brief m_lodPath simplified path drawn when zoomed out. */
+
+    void RefreshArrowsPath();
 };
 
 #endif // VCURVEPATHITEM_H
@@ -108,8 +108,9 @@ void VGrainlineItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
     Q_UNUSED(widget)
 
     painter->save();
-    QColor color  = QColor(qApp->Settings()->getDefaultGrainlineColor());
-    m_penWidth = ToPixel(qApp->Settings()->getDefaultGrainlineLineweight(), Unit::Mm) * 3;
+    const VSceneSettings &settings = qApp->Settings()->getSceneSettings();
+    const QColor color = settings.grainlineColor;
+    m_penWidth = ToPixel(settings.grainlineLineweight, Unit::Mm) * 3;
     painter->setPen(QPen(color, m_penWidth, Qt::SolidLine, Qt::FlatCap, Qt::MiterJoin));
 
     painter->setRenderHints(QPainter::Antialiasing);
@@ -111,39 +111,10 @@ VGraphicsSimpleTextItem::VGraphicsSimpleTextItem(const QString &text, QColor tex
 //---------------------------------------------------------------------------------------------------------------------
 void VGraphicsSimpleTextItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    QGraphicsScene *scene = this->scene();
-    const qreal scale = sceneScale(scene);
-
-    if (scale > 1.0 && not VFuzzyComparePossibleNulls(m_scale, scale))
-    {
-        scalePointName(scale);
-    }
-    else if (scale <= 1.0 && not VFuzzyComparePossibleNulls(m_scale, 1.0))
-    {
-        scalePointName(1.0);
-    }
-
-    QFont fnt = this->font();
-    if (fnt.pointSize() != qApp->Settings()->getPointNameSize() ||
-        fnt.family() != qApp->Settings()->getPointNameFont().family())
+    // Level of detail. Zoomed out names are skipped here rather than hidden, so the item visibility stays untouched.
+    if (font().pointSizeF() * itemLevelOfDetail(option, painter) < minLabelPixelSize)
     {
-        fnt.setPointSize(qApp->Settings()->getPointNameSize());
-        fnt.setFamily(qApp->Settings()->getPointNameFont().family());
-        this->setFont(fnt);
-    }
-
-    if (QGraphicsView *view = scene->views().at(0))
-    {
-        VMainGraphicsView::NewSceneRect(scene, view, this);
-    }
-
-    if (m_isNameHovered)
-    {
-        this->setBrush(QBrush(QColor(qApp->Settings()->getPointNameHoverColor())));
-    }
-    else
-    {
-        this->setBrush(QBrush(getTextBrushColor()));
+        return;
     }
 
     QGraphicsSimpleTextItem::paint(painter, option, widget);
@@ -153,7 +124,7 @@ void VGraphicsSimpleTextItem::paint(QPainter *painter, const QStyleOptionGraphic
 void VGraphicsSimpleTextItem::setEnabled(bool enabled)
 {
     QGraphicsSimpleTextItem::setEnabled(enabled);
-    this->setBrush(QBrush(getTextBrushColor()));
+    refreshBrush();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -237,6 +208,21 @@ QVariant VGraphicsSimpleTextItem::itemChange(GraphicsItemChange change, const QV
          setFlag(QGraphicsItem::ItemIsFocusable, value.toBool());
          emit pointSelected(value.toBool());
      }
+
+     if (change == QGraphicsItem::ItemPositionHasChanged)
+     {
+         refreshSceneRect();
+     }
+     else if (change == QGraphicsItem::ItemSceneHasChanged && scene())
+     {
+         applyScale(sceneScale(scene()));
+         updateSettings();
+     }
+     else if (change == QGraphicsItem::ItemEnabledHasChanged)
+     {
+         // Disabled labels are drawn in gray
+         refreshBrush();
+     }
      return QGraphicsSimpleTextItem::itemChange(change, value);
      //return QGraphicsItem::itemChange(change, value);
 }
@@ -249,6 +235,7 @@ QVariant VGraphicsSimpleTextItem::itemChange(GraphicsItemChange change, const QV
 void VGraphicsSimpleTextItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isNameHovered = true;
+    refreshBrush();
     if (flags() & QGraphicsItem::ItemIsMovable)
     {
         SetItemOverrideCursor(this, cursorArrowOpenHand, 1, 1);
@@ -275,6 +262,7 @@ void VGraphicsSimpleTextItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 void VGraphicsSimpleTextItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isNameHovered = false;
+    refreshBrush();
     if (flags() & QGraphicsItem::ItemIsMovable)
     {
         setCursor(QCursor());
@@ -361,7 +349,8 @@ void VGraphicsSimpleTextItem::keyReleaseEvent(QKeyEvent *event)
 
 QColor VGraphicsSimpleTextItem::getTextBrushColor()
 {
-    if (qApp->Settings()->getUseToolColor())
+    const VSceneSettings &settings = qApp->Settings()->getSceneSettings();
+    if (settings.useToolColor)
     {
         QColor textColor = correctColor(this, m_textColor);
         textColor.setAlpha(224);
@@ -369,7 +358,7 @@ QColor VGraphicsSimpleTextItem::getTextBrushColor()
     }
     else
     {
-        QColor textColor = correctColor(this, QColor(qApp->Settings()->getPointNameColor()));
+        QColor textColor = correctColor(this, settings.pointNameColor);
         textColor.setAlpha(224);
         return textColor;
     }
@@ -378,7 +367,25 @@ QColor VGraphicsSimpleTextItem::getTextBrushColor()
 void VGraphicsSimpleTextItem::setTextColor(const QColor &color)
 {
     m_textColor = color;
-    this->setBrush(QBrush(getTextBrushColor()));
+    refreshBrush();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief refreshSceneRect grows the scene rect to keep the label reachable by scrolling.
+ */
+void VGraphicsSimpleTextItem::refreshSceneRect()
+{
+    QGraphicsScene *currentScene = scene();
+    if (currentScene == nullptr || currentScene->views().isEmpty())
+    {
+        return;
+    }
+
+    if (QGraphicsView *view = currentScene->views().at(0))
+    {
+        VMainGraphicsView::NewSceneRect(currentScene, view, this);
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -407,6 +414,46 @@ void VGraphicsSimpleTextItem::initItem()
     setBrush(QBrush(getTextBrushColor()));
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VGraphicsSimpleTextItem::updateScale(qreal scale)
+{
+    const qreal nameScale = scale > 1.0 ? scale : 1.0;
+    if (not VFuzzyComparePossibleNulls(m_scale, nameScale))
+    {
+        scalePointName(nameScale);
+        refreshSceneRect();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGraphicsSimpleTextItem::updateSettings()
+{
+    const VSceneSettings &settings = qApp->Settings()->getSceneSettings();
+    QFont fnt = font();
+    if (fnt.pointSize() != settings.pointNameSize || fnt.family() != settings.pointNameFontFamily)
+    {
+        fnt.setPointSize(settings.pointNameSize);
+        fnt.setFamily(settings.pointNameFontFamily);
+        setFont(fnt);
+        refreshSceneRect();
+    }
+
+    refreshBrush();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGraphicsSimpleTextItem::refreshBrush()
+{
+    if (m_isNameHovered)
+    {
+        setBrush(QBrush(qApp->Settings()->getSceneSettings().pointNameHoverColor));
+    }
+    else
+    {
+        setBrush(QBrush(getTextBrushColor()));
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief scalePointName handle point name scaling to maintain same size when scene scale changes.
@@ -64,11 +64,12 @@
 #include <QColor>
 
 #include "../vmisc/def.h"
+#include "global.h"
 
 /**
  * @brief The VGraphicsSimpleTextItem class pointer label.
  */
-class VGraphicsSimpleTextItem : public QObject, public QGraphicsSimpleTextItem
+class VGraphicsSimpleTextItem : public QObject, public QGraphicsSimpleTextItem, public VScaleSensitiveItem
 {
     Q_OBJECT
 public:
@@ -91,6 +92,7 @@ class VGraphicsSimpleTextItem : public QObject, public QGraphicsSimpleTextItem
     void             setTextColor(const QColor &color);
 
     void             setPosition(QPointF pos);
+    void             refreshSceneRect();
 
 signals:
     /**
@@ -115,6 +117,8 @@ class VGraphicsSimpleTextItem : public QObject, public QGraphicsSimpleTextItem
     virtual void     mousePressEvent(QGraphicsSceneMouseEvent * event ) Q_DECL_OVERRIDE;
     virtual void     mouseReleaseEvent (QGraphicsSceneMouseEvent * event ) Q_DECL_OVERRIDE;
     virtual void     keyReleaseEvent (QKeyEvent * event ) Q_DECL_OVERRIDE;
+    virtual void     updateScale(qreal scale) Q_DECL_OVERRIDE;
+    virtual void     updateSettings() Q_DECL_OVERRIDE;
 
 private:
     /** @brief fontSize label font size. */
@@ -127,6 +131,7 @@ class VGraphicsSimpleTextItem : public QObject, public QGraphicsSimpleTextItem
     QPointF          m_pointNamePos{};
 
     void             initItem();
+    void             refreshBrush();
     void             scalePointName(const qreal &scale);
     void             scalePosition();
     void             updateLeader();
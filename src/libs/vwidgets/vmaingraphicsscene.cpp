@@ -342,6 +342,37 @@ void VMainGraphicsScene::HighlightItem(quint32 id)
     emit highlightPiece(id);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateItemsScale recalculates scale dependent pens and sizes of items after the view was zoomed.
+ * @param scale new view scale.
+ */
+void VMainGraphicsScene::updateItemsScale(qreal scale)
+{
+    foreach (QGraphicsItem *item, items())
+    {
+        if (VScaleSensitiveItem *scaledItem = dynamic_cast<VScaleSensitiveItem *>(item))
+        {
+            scaledItem->applyScale(scale);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateItemsSettings refreshes pens, colors and fonts of items after scene settings were changed.
+ */
+void VMainGraphicsScene::updateItemsSettings()
+{
+    foreach (QGraphicsItem *item, items())
+    {
+        if (VScaleSensitiveItem *settingsItem = dynamic_cast<VScaleSensitiveItem *>(item))
+        {
+            settingsItem->updateSettings();
+        }
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VMainGraphicsScene::ToggleLabelSelection(bool enabled)
 {
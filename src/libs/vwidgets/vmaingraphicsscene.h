@@ -95,6 +95,8 @@ public slots:
     void          enablePiecesMode(bool mode);
     void          ItemsSelection(const SelectionType &type);
     void          HighlightItem(quint32 id);
+    void          updateItemsScale(qreal scale);
+    void          updateItemsSettings();
 
     void          ToggleLabelSelection(bool enabled);
     void          TogglePointSelection(bool enabled);
@@ -491,6 +491,13 @@ VMainGraphicsView::VMainGraphicsView(QWidget *parent)
     this->setInteractive(true);
 
     connect(zoom, &GraphicsViewZoom::zoomed, this, [this](){emit signalZoomScaleChanged(transform().m11());});
+    connect(this, &VMainGraphicsView::signalZoomScaleChanged, this, [this](qreal scale)
+    {
+        if (VMainGraphicsScene *currentScene = qobject_cast<VMainGraphicsScene *>(scene()))
+        {
+            currentScene->updateItemsScale(scale);
+        }
+    });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
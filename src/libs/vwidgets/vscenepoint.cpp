@@ -85,42 +85,22 @@ VScenePoint::VScenePoint(const QColor &lineColor, QGraphicsItem *parent)
 //---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    const qreal scale = sceneScale(scene());
+    QGraphicsEllipseItem::paint(painter, option, widget);
+}
 
-    setPointPen(scale);
+//---------------------------------------------------------------------------------------------------------------------
+void VScenePoint::updateScale(qreal scale)
+{
     scaleCircleSize(this, scale * .75);
+    setPointPen(scale);
+    refreshLeader();
+}
 
-    if (qApp->Settings()->getPointNameSize()*scale < 6 || !qApp->Settings()->getHidePointNames())
-    {
-        m_pointName->setVisible(false);
-        m_pointLeader->setVisible(false);
-    }
-    else
-    {
-        if (!m_onlyPoint)
-        {
-            m_pointName->setVisible(m_showPointName);
-
-            QPen leaderPen = m_pointLeader->pen();
-            if (qApp->Settings()->getUseToolColor())
-            {
-                QColor leaderColor = correctColor(m_pointLeader, m_pointColor);
-                leaderColor.setAlpha(128);
-                leaderPen.setColor(leaderColor);
-            }
-            else
-            {
-                QColor leaderColor = correctColor(m_pointLeader, QColor(qApp->Settings()->getPointNameColor()));
-                leaderColor.setAlpha(128);
-                leaderPen.setColor(leaderColor);
-            }
-            m_pointLeader->setPen(leaderPen);
-
-            refreshLeader();
-        }
-    }
-
-    QGraphicsEllipseItem::paint(painter, option, widget);
+//---------------------------------------------------------------------------------------------------------------------
+void VScenePoint::updateSettings()
+{
+    setPointPen(currentScale());
+    refreshPointName();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -138,10 +118,11 @@ void VScenePoint::refreshPointGeometry(const VPointF &point)
     m_pointName->setFlag(QGraphicsItem::ItemSendsGeometryChanges, true);
     m_pointName->blockSignals(false);
     m_pointName->setText(point.name());
+    m_pointName->refreshSceneRect();
     m_pointName->setTextColor(m_pointColor);
     m_pointName->setVisible(m_showPointName);
 
-    refreshLeader();
+    refreshPointName();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -150,6 +131,8 @@ void VScenePoint::setOnlyPoint(bool value)
     m_onlyPoint = value;
     m_pointName->setVisible(!m_onlyPoint);
     m_pointLeader->setVisible(!m_onlyPoint);
+    refreshPointPen();
+    refreshPointName();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -158,15 +141,28 @@ bool VScenePoint::isOnlyPoint() const
     return m_onlyPoint;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::setPointColor(const QString &value)
 {
     m_pointColor = QColor(value);
+    refreshPointPen();
+    refreshPointName();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief refreshPointPen applies the pen and brush for the current scale, hover and enabled state.
+ */
+void VScenePoint::refreshPointPen()
+{
+    setPointPen(currentScale());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = true;
+    refreshPointPen();
     QGraphicsEllipseItem::hoverEnterEvent(event);
 }
 
@@ -174,9 +170,27 @@ void VScenePoint::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 void VScenePoint::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = false;
+    refreshPointPen();
     QGraphicsEllipseItem::hoverLeaveEvent(event);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+QVariant VScenePoint::itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant &value)
+{
+    if (change == QGraphicsItem::ItemSceneHasChanged && scene() != nullptr)
+    {
+        applyScale(sceneScale(scene()));
+        updateSettings();
+    }
+    else if (change == QGraphicsItem::ItemEnabledHasChanged)
+    {
+        // Disabled points are drawn in gray
+        updateSettings();
+    }
+
+    return QGraphicsEllipseItem::itemChange(change, value);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::refreshLeader()
 {
@@ -207,17 +221,50 @@ void VScenePoint::refreshLeader()
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief refreshPointName applies the point name visibility and the leader pen from scene settings.
+ */
+void VScenePoint::refreshPointName()
+{
+    const VSceneSettings &settings = qApp->Settings()->getSceneSettings();
+    if (!settings.hidePointNames)
+    {
+        m_pointName->setVisible(false);
+        m_pointLeader->setVisible(false);
+        return;
+    }
+
+    if (m_onlyPoint)
+    {
+        return;
+    }
+
+    m_pointName->setVisible(m_showPointName);
+
+    QColor leaderColor = correctColor(m_pointLeader, settings.useToolColor ? m_pointColor : settings.pointNameColor);
+    leaderColor.setAlpha(128);
+    QPen leaderPen = m_pointLeader->pen();
+    leaderPen.setColor(leaderColor);
+    m_pointLeader->setPen(leaderPen);
+    // Hide the leader together with a name that is too small to be drawn
+    m_pointLeader->setMinLevelOfDetail(minLabelPixelSize / qMax(1, settings.pointNameSize));
+
+    refreshLeader();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::setPointPen(qreal scale)
 {
     const qreal width = scaleWidth(m_isHovered ? widthMainLine : widthHairLine, scale);
 
-    if (qApp->Settings()->getUseToolColor() || isOnlyPoint())
+    const VSceneSettings &settings = qApp->Settings()->getSceneSettings();
+    if (settings.useToolColor || isOnlyPoint())
     {
         setPen(QPen(correctColor(this, m_pointColor), width));
         if (!m_onlyPoint)
         {
-            if (!qApp->Settings()->isWireframe())
+            if (!settings.wireframe)
             {
                setBrush(QBrush(correctColor(this, m_pointColor), Qt::SolidPattern));
             }
@@ -233,15 +280,15 @@ void VScenePoint::setPointPen(qreal scale)
     }
     else
     {
-        setPen(QPen(correctColor(this, QColor(qApp->Settings()->getPointNameColor())), width));
+        setPen(QPen(correctColor(this, settings.pointNameColor), width));
 
-        if (!qApp->Settings()->isWireframe())
+        if (!settings.wireframe)
         {
-           setBrush(QBrush(correctColor(this, QColor(qApp->Settings()->getPointNameColor())),Qt::SolidPattern));
+           setBrush(QBrush(correctColor(this, settings.pointNameColor),Qt::SolidPattern));
         }
         else
         {
-           setBrush(QBrush(correctColor(this, QColor(qApp->Settings()->getPointNameColor())),Qt::NoBrush));
+           setBrush(QBrush(correctColor(this, settings.pointNameColor),Qt::NoBrush));
         }
 
     }
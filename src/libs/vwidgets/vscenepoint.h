@@ -56,12 +56,13 @@
 #include <QGraphicsEllipseItem>
 
 #include "../vmisc/def.h"
+#include "global.h"
 
 class VGraphicsSimpleTextItem;
 class VPointF;
 class VScaledLine;
 
-class VScenePoint: public QGraphicsEllipseItem
+class VScenePoint: public QGraphicsEllipseItem, public VScaleSensitiveItem
 {
 public:
     explicit                 VScenePoint(const QColor &lineColor, QGraphicsItem *parent = nullptr);
@@ -86,16 +87,22 @@ class VScenePoint: public QGraphicsEllipseItem
 
     virtual void             hoverEnterEvent(QGraphicsSceneHoverEvent *event) Q_DECL_OVERRIDE;
     virtual void             hoverLeaveEvent(QGraphicsSceneHoverEvent *event) Q_DECL_OVERRIDE;
+    virtual QVariant         itemChange(GraphicsItemChange change, const QVariant &value) Q_DECL_OVERRIDE;
 
     void                     setOnlyPoint(bool value);
     bool                     isOnlyPoint() const;
 
     void                     setPointColor(const QString &value);
+    void                     refreshPointPen();
+
+    virtual void             updateScale(qreal scale) Q_DECL_OVERRIDE;
+    virtual void             updateSettings() Q_DECL_OVERRIDE;
 
 private:
     Q_DISABLE_COPY(VScenePoint)
 
     void                     setPointPen(qreal scale);
+    void                     refreshPointName();
 };
 
 #endif // VSCENEPOINT_H
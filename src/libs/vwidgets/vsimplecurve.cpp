@@ -91,6 +91,7 @@ void VSimpleCurve::RefreshGeometry(const QSharedPointer<VAbstractCurve> &curve)
         m_isHovered ? SetDirectionArrows(m_curve->DirectionArrows()) : SetDirectionArrows(QVector<DirectionArrow>());
         setPath(m_curve->GetPath());
         SetPoints(m_curve->getPoints());
+        ScalePenWidth();
     }
     else
     {
@@ -155,6 +156,7 @@ void VSimpleCurve::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
     if (not m_curve.isNull())
     {
         SetDirectionArrows(m_curve->DirectionArrows());
+        ScalePenWidth();
     }
     QGraphicsPathItem::hoverEnterEvent(event);
 }
@@ -164,6 +166,10 @@ void VSimpleCurve::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = false;
     SetDirectionArrows(QVector<DirectionArrow>());
+    if (not m_curve.isNull())
+    {
+        ScalePenWidth();
+    }
     QGraphicsPathItem::hoverLeaveEvent(event);
 }
 
@@ -211,7 +217,7 @@ void VSimpleCurve::ScalePenWidth()
         width = ToPixel(qApp->getCurrentDocument()->useGroupLineWeight(id, m_curve->getLineWeight()).toDouble(), Unit::Mm);
     }
 
-    width = scaleWidth(width, sceneScale(scene()));
+    width = scaleWidth(width, currentScale());
     setPen(QPen(correctColor(this, qApp->getCurrentDocument()->useGroupColor(id, m_curve->getLineColor())),
                 width,
                 lineTypeToPenStyle(qApp->getCurrentDocument()->useGroupLineType(id, m_curve->GetPenStyle()))));
@@ -78,6 +78,7 @@ VSimplePoint::VSimplePoint(quint32 id, const QColor &currentColor, QObject *pare
     , m_alwaysHovered(false)
 {
     m_pointColor = currentColor;
+    refreshPointPen();
     connect(m_pointName, &VGraphicsSimpleTextItem::showContextMenu,    this, &VSimplePoint::contextMenuEvent);
     connect(m_pointName, &VGraphicsSimpleTextItem::deleteTool,         this, &VSimplePoint::deletePoint);
     connect(m_pointName, &VGraphicsSimpleTextItem::pointChosen,        this, &VSimplePoint::pointChosen);
@@ -103,6 +104,7 @@ void VSimplePoint::SetPointHighlight(bool value)
 {
     m_alwaysHovered = value;
     m_isHovered = value;
+    refreshPointPen();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -213,6 +215,7 @@ void VSimplePoint::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
 void VSimplePoint::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = true;
+    refreshPointPen();
     QGraphicsEllipseItem::hoverEnterEvent(event);
 }
 
@@ -222,6 +225,7 @@ void VSimplePoint::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
     if (not m_alwaysHovered)
     {
         m_isHovered = false;
+        refreshPointPen();
     }
     QGraphicsEllipseItem::hoverLeaveEvent(event);
 }
@@ -44,6 +44,7 @@
 #include "../vmisc/vmath.h"
 #include "../vmisc/vcommonsettings.h"
 #include "../vmisc/vabstractapplication.h"
+#include "global.h"
 #include "vtextgraphicsitem.h"
 
 const qreal resizeSquare = (3./*mm*/ / 25.4) * PrintDPI;
@@ -153,9 +154,9 @@ void VTextGraphicsItem::setFont(const QFont &font)
 void VTextGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
     Q_UNUSED(widget)
-    Q_UNUSED(option)
 
-    QColor color  = QColor(qApp->Settings()->getDefaultLabelColor());
+    const QColor color = qApp->Settings()->getSceneSettings().labelColor;
+    const qreal levelOfDetail = itemLevelOfDetail(option, painter);
 
     painter->setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing);
     painter->setPen(QPen(color));
@@ -181,6 +182,13 @@ void VTextGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
             break;
         }
 
+        // Lines too small to read on screen keep their place but are not drawn
+        if (fm.height() * levelOfDetail < minLabelPixelSize)
+        {
+            yPos += fm.height() + m_textMananger.GetSpacing();
+            continue;
+        }
+
         if (fm.horizontalAdvance(text) > width)
         {
             text = fm.elidedText(text, Qt::ElideMiddle, width);
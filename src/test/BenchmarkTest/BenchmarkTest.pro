@@ -0,0 +1,178 @@
+#-------------------------------------------------
+#
+# Benchmarks of the core engines on the shipped sample patterns
+#
+#-------------------------------------------------
+
+# Benchmarks are not a part of 'make check'. Run bin/BenchmarkTest, results are also saved as JSON (see
+# qttestmainlambda.cpp).
+
+QT       += core testlib gui widgets printsupport xml xmlpatterns
+
+TARGET = BenchmarkTest
+
+# File with common stuff for whole project
+include(../../../common.pri)
+
+# Console application
+CONFIG   += console
+
+# disable app bundle to have stable cross-platform relative paths to seamly2d binary
+CONFIG -= app_bundle
+
+# directory for executable file
+DESTDIR = bin
+
+# Directory for files created moc
+MOC_DIR = moc
+
+# objecs files
+OBJECTS_DIR = obj
+
+SOURCES += \
+    qttestmainlambda.cpp \
+    benchmarkreport.cpp \
+    tst_corebenchmarks.cpp \
+    tst_seamly2dbenchmarks.cpp
+
+*msvc*:SOURCES += stable.cpp
+
+HEADERS += \
+    stable.h \
+    benchmarkreport.h \
+    tst_corebenchmarks.h \
+    tst_seamly2dbenchmarks.h
+
+include(warnings.pri)
+
+#VTools static library (depend on VWidgets, VMisc, VPatternDB)
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vtools/$${DESTDIR}/ -lvtools
+
+INCLUDEPATH += $$PWD/../../libs/vtools
+DEPENDPATH += $$PWD/../../libs/vtools
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vtools/$${DESTDIR}/vtools.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vtools/$${DESTDIR}/libvtools.a
+
+#VWidgets static library
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vwidgets/$${DESTDIR}/ -lvwidgets
+
+INCLUDEPATH += $$PWD/../../libs/vwidgets
+DEPENDPATH += $$PWD/../../libs/vwidgets
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vwidgets/$${DESTDIR}/vwidgets.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vwidgets/$${DESTDIR}/libvwidgets.a
+
+# VFormat static library (depend on VPatternDB, IFC)
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vformat/$${DESTDIR}/ -lvformat
+
+INCLUDEPATH += $$PWD/../../libs/vformat
+DEPENDPATH += $$PWD/../../libs/vformat
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vformat/$${DESTDIR}/vformat.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vformat/$${DESTDIR}/libvformat.a
+
+#VPatternDB static library (depend on vgeometry, vmisc, VLayout)
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vpatterndb/$${DESTDIR} -lvpatterndb
+
+INCLUDEPATH += $$PWD/../../libs/vpatterndb
+DEPENDPATH += $$PWD/../../libs/vpatterndb
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vpatterndb/$${DESTDIR}/vpatterndb.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vpatterndb/$${DESTDIR}/libvpatterndb.a
+
+# IFC static library (depend on QMuParser, VMisc)
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/ifc/$${DESTDIR}/ -lifc
+
+INCLUDEPATH += $$PWD/../../libs/ifc
+DEPENDPATH += $$PWD/../../libs/ifc
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/ifc/$${DESTDIR}/ifc.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/ifc/$${DESTDIR}/libifc.a
+
+#VTest static library
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vtest/$${DESTDIR} -lvtest
+
+INCLUDEPATH += $$PWD/../../libs/vtest
+DEPENDPATH += $$PWD/../../libs/vtest
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vtest/$${DESTDIR}/vtest.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vtest/$${DESTDIR}/libvtest.a
+
+#VMisc static library
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vmisc/$${DESTDIR}/ -lvmisc
+
+INCLUDEPATH += $$PWD/../../libs/vmisc
+DEPENDPATH += $$PWD/../../libs/vmisc
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vmisc/$${DESTDIR}/vmisc.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vmisc/$${DESTDIR}/libvmisc.a
+
+# VGeometry static library (depend on ifc)
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vgeometry/$${DESTDIR} -lvgeometry
+
+INCLUDEPATH += $$PWD/../../libs/vgeometry
+DEPENDPATH += $$PWD/../../libs/vgeometry
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vgeometry/$${DESTDIR}/vgeometry.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vgeometry/$${DESTDIR}/libvgeometry.a
+
+# VLayout static library
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vlayout/$${DESTDIR} -lvlayout
+
+INCLUDEPATH += $$PWD/../../libs/vlayout
+DEPENDPATH += $$PWD/../../libs/vlayout
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vlayout/$${DESTDIR}/vlayout.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vlayout/$${DESTDIR}/libvlayout.a
+
+# QMuParser library
+unix|win32: LIBS += -L$${OUT_PWD}/../../libs/qmuparser/$${DESTDIR} -lqmuparser
+
+INCLUDEPATH += $${PWD}/../../libs/qmuparser
+DEPENDPATH += $${PWD}/../../libs/qmuparser
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/qmuparser/$${DESTDIR}/qmuparser.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/qmuparser/$${DESTDIR}/libqmuparser.a
+
+# VPropertyExplorer library
+unix|win32: LIBS += -L$${OUT_PWD}/../../libs/vpropertyexplorer/$${DESTDIR} -lvpropertyexplorer
+
+INCLUDEPATH += $${PWD}/../../libs/vpropertyexplorer
+DEPENDPATH += $${PWD}/../../libs/vpropertyexplorer
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vpropertyexplorer/$${DESTDIR}/vpropertyexplorer.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vpropertyexplorer/$${DESTDIR}/libvpropertyexplorer.a
+
+SAMPLE_PATTERNS += \
+    $$PWD/../../app/share/samples/patterns/jacket1_52-176.sm2d \
+    $$PWD/../../app/share/samples/patterns/jacket2_40-146.sm2d \
+    $$PWD/../../app/share/samples/patterns/jacket3_40-146.sm2d \
+    $$PWD/../../app/share/samples/patterns/jacket4_40-146.sm2d \
+    $$PWD/../../app/share/samples/patterns/jacket5_30-110.sm2d \
+    $$PWD/../../app/share/samples/patterns/jacket6_30-110.sm2d \
+    $$PWD/../../app/share/samples/patterns/trousers.sm2d
+
+SAMPLE_INDIVIDUAL_MEASUREMENTS += \
+    $$PWD/../../app/share/samples/measurements/individual/trousers.smis
+
+SAMPLE_MULTISIZE_MEASUREMENTS += \
+    $$PWD/../../app/share/samples/measurements/multisize/gost_man_ru.smms
+
+# Old format copies of the samples, they are used to measure conversion
+OLD_FORMAT_PATTERNS += \
+    $$PWD/../CollectionTest/share/suit/jacket1_52-176.sm2d \
+    $$PWD/../CollectionTest/share/suit/jacket2_40-146.sm2d \
+    $$PWD/../CollectionTest/share/suit/jacket3_40-146.sm2d \
+    $$PWD/../CollectionTest/share/suit/jacket4_40-146.sm2d \
+    $$PWD/../CollectionTest/share/suit/jacket5_30-110.sm2d \
+    $$PWD/../CollectionTest/share/suit/jacket6_30-110.sm2d \
+    $$PWD/../CollectionTest/share/suit/pants1_52-176.sm2d
+
+# Patterns refer to measurements by relative path, keep the structure of the samples directory.
+BENCHMARK_DATA = $${OUT_PWD}/$$DESTDIR/tst_benchmark
+
+copyToDestdir($$SAMPLE_PATTERNS, $$shell_path($$BENCHMARK_DATA/patterns))
+copyToDestdir($$SAMPLE_INDIVIDUAL_MEASUREMENTS, $$shell_path($$BENCHMARK_DATA/measurements/individual))
+copyToDestdir($$SAMPLE_MULTISIZE_MEASUREMENTS, $$shell_path($$BENCHMARK_DATA/measurements/multisize))
+copyToDestdir($$OLD_FORMAT_PATTERNS, $$shell_path($$BENCHMARK_DATA/suit))
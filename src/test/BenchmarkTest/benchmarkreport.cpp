@@ -0,0 +1,165 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "benchmarkreport.h"
+#include "../vmisc/projectversion.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <algorithm>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+inline double ToMsecs(qint64 nsecs)
+{
+    return static_cast<double>(nsecs) / 1000000.0;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+BenchmarkReport::BenchmarkReport()
+    : results(),
+      memory()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+BenchmarkReport *BenchmarkReport::Instance()
+{
+    static BenchmarkReport report;
+    return &report;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void BenchmarkReport::Add(const QString &stage, const QString &sample, const QVector<qint64> &nsecs)
+{
+    if (nsecs.isEmpty())
+    {
+        return;
+    }
+
+    Result result;
+    result.stage = stage;
+    result.sample = sample;
+    result.nsecs = nsecs;
+    results.append(result);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void BenchmarkReport::AddMemory(const QString &stage, const QString &sample, qint64 bytes)
+{
+    Memory entry;
+    entry.stage = stage;
+    entry.sample = sample;
+    entry.bytes = bytes;
+    memory.append(entry);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Save writes the report. All times are in milliseconds, memory is in bytes.
+ * @param fileName path to the report file.
+ * @return false if the file could not be written.
+ */
+bool BenchmarkReport::Save(const QString &fileName) const
+{
+    QJsonArray list;
+    for (int i = 0; i < results.size(); ++i)
+    {
+        QVector<qint64> nsecs = results.at(i).nsecs;
+        std::sort(nsecs.begin(), nsecs.end());
+
+        qint64 sum = 0;
+        for (int j = 0; j < nsecs.size(); ++j)
+        {
+            sum += nsecs.at(j);
+        }
+
+        QJsonObject result;
+        result.insert(QStringLiteral("stage"), results.at(i).stage);
+        result.insert(QStringLiteral("sample"), results.at(i).sample);
+        result.insert(QStringLiteral("iterations"), nsecs.size());
+        result.insert(QStringLiteral("min"), ToMsecs(nsecs.first()));
+        result.insert(QStringLiteral("median"), ToMsecs(nsecs.at(nsecs.size() / 2)));
+        result.insert(QStringLiteral("mean"), ToMsecs(sum / nsecs.size()));
+        result.insert(QStringLiteral("max"), ToMsecs(nsecs.last()));
+        list.append(result);
+    }
+
+    QJsonArray memoryList;
+    for (int i = 0; i < memory.size(); ++i)
+    {
+        QJsonObject entry;
+        entry.insert(QStringLiteral("stage"), memory.at(i).stage);
+        entry.insert(QStringLiteral("sample"), memory.at(i).sample);
+        entry.insert(QStringLiteral("bytes"), static_cast<double>(memory.at(i).bytes));
+        memoryList.append(entry);
+    }
+
+    QJsonObject report;
+    report.insert(QStringLiteral("version"), QStringLiteral(VER_FILEVERSION_STR));
+    report.insert(QStringLiteral("qt"), QString::fromLatin1(qVersion()));
+    report.insert(QStringLiteral("platform"), QSysInfo::prettyProductName());
+    report.insert(QStringLiteral("cpu"), QSysInfo::currentCpuArchitecture());
+    report.insert(QStringLiteral("date"), QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    report.insert(QStringLiteral("unit"), QStringLiteral("ms"));
+    report.insert(QStringLiteral("results"), list);
+    report.insert(QStringLiteral("memory"), memoryList);
+
+    QFile file(fileName);
+    if (not file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+    return file.write(QJsonDocument(report).toJson()) != -1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BenchmarkDataPath return directory with copies of the sample patterns and measurements.
+ */
+QString BenchmarkDataPath()
+{
+    return QCoreApplication::applicationDirPath() + QDir::separator() + QLatin1String("tst_benchmark");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BenchmarkPatterns return names of the sample patterns all stages are measured on.
+ */
+QStringList BenchmarkPatterns()
+{
+    return QStringList() << QStringLiteral("jacket1_52-176")
+                         << QStringLiteral("jacket2_40-146")
+                         << QStringLiteral("jacket3_40-146")
+                         << QStringLiteral("jacket4_40-146")
+                         << QStringLiteral("jacket5_30-110")
+                         << QStringLiteral("jacket6_30-110")
+                         << QStringLiteral("trousers");
+}
@@ -0,0 +1,108 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#ifndef BENCHMARKREPORT_H
+#define BENCHMARKREPORT_H
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QtTest>
+
+/**
+ * @brief The BenchmarkReport class collects timings of all benchmarks in the run and saves them as JSON.
+ *
+ * Results are keyed by stage (test function) and sample (data tag), so reports of two builds can be compared
+ * line by line. Stages that measure memory add it separately.
+ */
+class BenchmarkReport
+{
+public:
+    static BenchmarkReport *Instance();
+
+    void Add(const QString &stage, const QString &sample, const QVector<qint64> &nsecs);
+    void AddMemory(const QString &stage, const QString &sample, qint64 bytes);
+    bool Save(const QString &fileName) const;
+
+private:
+    Q_DISABLE_COPY(BenchmarkReport)
+    BenchmarkReport();
+
+    struct Result
+    {
+        QString         stage;
+        QString         sample;
+        QVector<qint64> nsecs;
+    };
+
+    struct Memory
+    {
+        QString stage;
+        QString sample;
+        qint64  bytes;
+    };
+
+    QVector<Result> results;
+    QVector<Memory> memory;
+};
+
+QString     BenchmarkDataPath();
+QStringList BenchmarkPatterns();
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Benchmark runs the function inside QBENCHMARK and adds time of each iteration to the report.
+ * @param function code to measure.
+ * @param once true for expensive stages that should run only one iteration.
+ */
+template <typename Function>
+void Benchmark(Function function, bool once = false)
+{
+    QVector<qint64> nsecs;
+    QElapsedTimer timer;
+
+    if (once)
+    {
+        QBENCHMARK_ONCE
+        {
+            timer.start();
+            function();
+            nsecs.append(timer.nsecsElapsed());
+        }
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            timer.start();
+            function();
+            nsecs.append(timer.nsecsElapsed());
+        }
+    }
+
+    BenchmarkReport::Instance()->Add(QString::fromLatin1(QTest::currentTestFunction()),
+                                     QString::fromLatin1(QTest::currentDataTag()), nsecs);
+}
+
+#endif // BENCHMARKREPORT_H
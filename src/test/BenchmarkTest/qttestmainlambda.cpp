@@ -0,0 +1,123 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include <QtTest>
+
+#include "benchmarkreport.h"
+#include "tst_corebenchmarks.h"
+#include "tst_seamly2dbenchmarks.h"
+
+#include "../vmisc/def.h"
+#include "../vmisc/vabstractapplication.h"
+#include "../vmisc/projectversion.h"
+
+class TestVApplication : public VAbstractApplication
+{
+public:
+
+                                  TestVApplication(int &argc, char ** argv);
+    virtual                      ~TestVApplication() Q_DECL_EQ_DEFAULT;
+
+    virtual const VTranslateVars *TrVars();
+    virtual void                  OpenSettings();
+    virtual bool                  IsAppInGUIMode() const;
+    virtual void                  InitTrVars();
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+TestVApplication::TestVApplication(int &argc, char **argv)
+    : VAbstractApplication(argc, argv)
+{
+    setApplicationName(VER_INTERNALNAME_2D_STR);
+    setOrganizationName(VER_COMPANYNAME_STR);
+    OpenSettings();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+const VTranslateVars *TestVApplication::TrVars()
+{
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TestVApplication::OpenSettings()
+{
+    settings = new VSettings(QSettings::IniFormat, QSettings::UserScope, QCoreApplication::organizationName(),
+                             QCoreApplication::applicationName(), this);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool TestVApplication::IsAppInGUIMode() const
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TestVApplication::InitTrVars()
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Usage: BenchmarkTest [-json <file>] [QtTest options]
+ *
+ * Besides the usual QtTest output all results are saved as JSON, by default to benchmarks.json in the working
+ * directory. The test is built only if qmake runs with CONFIG+=benchmarks.
+ */
+int main(int argc, char** argv)
+{
+    Q_INIT_RESOURCE(schema);
+
+    TestVApplication app( argc, argv );
+
+    QString report = QStringLiteral("benchmarks.json");
+    QStringList arguments = QCoreApplication::arguments();
+    const int index = arguments.indexOf(QStringLiteral("-json"));
+    if (index != -1)
+    {
+        if (index + 1 < arguments.size())
+        {
+            report = arguments.at(index + 1);
+            arguments.removeAt(index + 1);
+        }
+        arguments.removeAt(index);
+    }
+
+    int status = 0;
+    auto ASSERT_TEST = [&status, &arguments](QObject* obj)
+    {
+        status |= QTest::qExec(obj, arguments);
+        delete obj;
+    };
+
+    ASSERT_TEST(new TST_CoreBenchmarks());
+    ASSERT_TEST(new TST_Seamly2DBenchmarks());
+
+    if (not BenchmarkReport::Instance()->Save(report))
+    {
+        qWarning("Can't write benchmark report %s.", qUtf8Printable(report));
+        status |= 1;
+    }
+
+    return status;
+}
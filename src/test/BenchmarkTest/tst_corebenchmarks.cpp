@@ -0,0 +1,868 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_corebenchmarks.h"
+#include "benchmarkreport.h"
+
+#include "../ifc/exception/vexception.h"
+#include "../ifc/xml/individual_size_converter.h"
+#include "../ifc/xml/multi_size_converter.h"
+#include "../ifc/xml/vabstractpattern.h"
+#include "../ifc/xml/vpatternconverter.h"
+#include "../qmuparser/qmuparsererror.h"
+#include "../vformat/measurements.h"
+#include "../vlayout/vabstractpiece.h"
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutpiece.h"
+#include "../vpatterndb/calculator.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/variables/vincrement.h"
+#include "../vwidgets/vcurvepathitem.h"
+#include "../vwidgets/vgraphicssimpletextitem.h"
+
+#include <QBuffer>
+#include <QDomDocument>
+#include <QFile>
+#include <QFileInfo>
+#include <QGraphicsScene>
+#include <QGraphicsView>
+#include <QImage>
+#include <QLineF>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPolygonF>
+#include <QtMath>
+#include <QXmlStreamReader>
+#include <QtTest>
+#include <functional>
+
+namespace
+{
+struct Increment
+{
+    QString name;
+    QString formula;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+QString PatternPath(const QString &name)
+{
+    return BenchmarkDataPath() + QLatin1String("/patterns/") + name + QLatin1String(".sm2d");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString ReadFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        return QString();
+    }
+    return QString::fromUtf8(file.readAll());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ScalePattern write a copy of the pattern with draft blocks repeated factor times.
+ *
+ * Ids of the copies are shifted to keep them unique. References are not updated, the result is good for reading and
+ * validation only.
+ */
+QString ScalePattern(const QString &fileName, int factor, const QString &dir)
+{
+    QDomDocument doc;
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly) || not doc.setContent(&file))
+    {
+        return QString();
+    }
+
+    const QString attrId = QStringLiteral("id");
+    const QString attrName = QStringLiteral("name");
+
+    quint32 offset = 0;
+    const QDomNodeList all = doc.elementsByTagName(QStringLiteral("*"));
+    for (int i = 0; i < all.size(); ++i)
+    {
+        offset = qMax(offset, all.at(i).toElement().attribute(attrId).toUInt() + 1);
+    }
+
+    const QDomNodeList blocks = doc.elementsByTagName(QStringLiteral("draftBlock"));
+    QVector<QDomElement> originals;
+    for (int i = 0; i < blocks.size(); ++i)
+    {
+        originals.append(blocks.at(i).toElement());
+    }
+
+    if (originals.isEmpty())
+    {
+        return QString();
+    }
+
+    QDomElement last = originals.last();
+    for (int k = 1; k < factor; ++k)
+    {
+        for (int i = 0; i < originals.size(); ++i)
+        {
+            QDomElement copy = originals.at(i).cloneNode(true).toElement();
+            copy.setAttribute(attrName, copy.attribute(attrName) + QLatin1Char('_') + QString::number(k));
+
+            const QDomNodeList children = copy.elementsByTagName(QStringLiteral("*"));
+            for (int j = 0; j < children.size(); ++j)
+            {
+                QDomElement child = children.at(j).toElement();
+                if (child.hasAttribute(attrId))
+                {
+                    child.setAttribute(attrId, child.attribute(attrId).toUInt() + offset * static_cast<quint32>(k));
+                }
+            }
+
+            last.parentNode().insertAfter(copy, last);
+            last = copy;
+        }
+    }
+
+    const QString scaled = dir + QLatin1Char('/') + QFileInfo(fileName).completeBaseName() + QLatin1String("_x") +
+                           QString::number(factor) + QLatin1String(".sm2d");
+    QFile out(scaled);
+    if (not out.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return QString();
+    }
+    out.write(doc.toByteArray(1));
+    return scaled;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ResidentMemory return resident set size of the process in bytes or -1 if unknown.
+ */
+qint64 ResidentMemory()
+{
+#if defined(Q_OS_LINUX)
+    QFile status(QStringLiteral("/proc/self/status"));
+    if (status.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        const QList<QByteArray> lines = status.readAll().split('\n');
+        for (int i = 0; i < lines.size(); ++i)
+        {
+            if (lines.at(i).startsWith("VmRSS:"))
+            {
+                return lines.at(i).mid(6).trimmed().split(' ').first().toLongLong() * 1024;
+            }
+        }
+    }
+#endif
+    return -1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LoadPattern read the pattern the way the application does before evaluation.
+ *
+ * Streaming load keeps calculation sections out of the tree and reads their tags one by one.
+ * @param afterElement called after each streamed tag, memory stays low only while a tag is read.
+ * @return number of read calculation tags.
+ */
+int LoadPattern(const QString &fileName, bool streaming,
+                const std::function<void ()> &afterElement = std::function<void ()>())
+{
+    int count = 0;
+    if (not streaming)
+    {
+        VDomDocument doc;
+        doc.setXMLContent(fileName);
+        const QDomNodeList list = doc.elementsByTagName(VAbstractPattern::TagCalculation);
+        for (int i = 0; i < list.size(); ++i)
+        {
+            count += list.at(i).childNodes().size();
+        }
+        return count;
+    }
+
+    VDomDocument doc;
+    doc.setXMLContentSkipping(fileName, QStringList() << VAbstractPattern::TagCalculation);
+
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        return count;
+    }
+
+    QXmlStreamReader reader(&file);
+    while (not reader.atEnd())
+    {
+        reader.readNext();
+        if (reader.isStartElement() && reader.name() == VAbstractPattern::TagCalculation)
+        {
+            while (reader.readNextStartElement())
+            {
+                VDomDocument::ReadElement(reader, doc);
+                ++count;
+                if (afterElement)
+                {
+                    afterElement();
+                }
+            }
+        }
+    }
+    return count;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LoadMeasurements read measurements used by the pattern into the container, the way the application does.
+ * @return false if the pattern has no measurements or they could not be read.
+ */
+bool LoadMeasurements(const QString &patternFile, VContainer *data)
+{
+    QDomDocument doc;
+    QFile file(patternFile);
+    if (not file.open(QIODevice::ReadOnly) || not doc.setContent(&file))
+    {
+        return false;
+    }
+
+    const QString mPath = doc.elementsByTagName(QStringLiteral("measurements")).at(0).toElement().text();
+    if (mPath.isEmpty())
+    {
+        return false;
+    }
+    const QString fileName = QFileInfo(patternFile).absoluteDir().absoluteFilePath(mPath);
+
+    try
+    {
+        MeasurementDoc measurements(data);
+        measurements.setSize(VContainer::rsize());
+        measurements.setHeight(VContainer::rheight());
+        measurements.setXMLContent(fileName);
+
+        if (measurements.Type() == MeasurementsType::Multisize)
+        {
+            MultiSizeConverter converter(fileName);
+            measurements.setXMLContent(converter.Convert());
+        }
+        else
+        {
+            IndividualSizeConverter converter(fileName);
+            measurements.setXMLContent(converter.Convert());
+        }
+        measurements.readMeasurements();
+    }
+    catch (VException &e)
+    {
+        qWarning("%s", qUtf8Printable(e.ErrorMessage()));
+        return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<Increment> PatternIncrements(const QString &patternFile)
+{
+    QDomDocument doc;
+    QFile file(patternFile);
+    QVector<Increment> increments;
+    if (not file.open(QIODevice::ReadOnly) || not doc.setContent(&file))
+    {
+        return increments;
+    }
+
+    const QDomNodeList list = doc.elementsByTagName(QStringLiteral("increment"));
+    for (int i = 0; i < list.size(); ++i)
+    {
+        const QDomElement element = list.at(i).toElement();
+        Increment increment;
+        increment.name = element.attribute(QStringLiteral("name"));
+        increment.formula = element.attribute(QStringLiteral("formula"), QStringLiteral("0"));
+        increment.formula.replace(QLatin1Char('\n'), QLatin1Char(' '));
+        increments.append(increment);
+    }
+    return increments;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ChainedIncrements make a table where each increment depends on the previous one.
+ */
+QVector<Increment> ChainedIncrements(int count)
+{
+    QVector<Increment> increments;
+    for (int i = 0; i < count; ++i)
+    {
+        Increment increment;
+        increment.name = QStringLiteral("#i%1").arg(i);
+        increment.formula = i == 0 ? QStringLiteral("1")
+                                   : QStringLiteral("(#i%1 + sin(%2)*2)/2 + sqrt(%2)").arg(i - 1).arg(i);
+        increments.append(increment);
+    }
+    return increments;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<VSAPoint> WavyContour(int count)
+{
+    QVector<VSAPoint> points;
+    const qreal radius = 500;
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal angle = 2 * M_PI * i / count;
+        const qreal r = radius + 20 * qSin(angle * 24);
+        points.append(VSAPoint(r * qCos(angle), r * qSin(angle)));
+    }
+    points.append(points.first());
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LoopedContour make a closed path of count teeth, each tooth crosses its own base segment and makes a loop.
+ */
+QVector<QPointF> LoopedContour(int count)
+{
+    QVector<QPointF> points;
+    const qreal radius = 1000;
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal angle = 2 * M_PI * i / count;
+        const qreal step = 2 * M_PI * radius / count;
+        const QPointF base(radius * qCos(angle), radius * qSin(angle));
+        const QPointF tangent(-qSin(angle), qCos(angle));
+        const QPointF normal(qCos(angle), qSin(angle));
+
+        points.append(base);
+        points.append(base + tangent * step * 0.75);
+        points.append(base + tangent * step * 0.75 + normal * step * 0.25);
+        points.append(base + tangent * step * 0.5 + normal * step * 0.25);
+        points.append(base + tangent * step * 0.5 - normal * step * 0.25);
+    }
+    points.append(points.first());
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LongLoop make a path of count points: a vertical segment followed by one long loop that crosses it.
+ */
+QVector<QPointF> LongLoop(int count)
+{
+    const int half = count / 2;
+    QVector<QPointF> points;
+    points << QPointF(500, -100) << QPointF(500, 100);
+    for (int k = 1; k <= half; ++k)
+    {
+        points << QPointF(500 - k * 500.0 / half, 100);
+    }
+
+    points << QPointF(0, 0);
+    for (int k = 0; k < half; ++k)
+    {
+        points << QPointF((k + 0.5) * 1000.0 / half, 0);
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> DenseCurve(const QPointF &origin, int count)
+{
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal x = i * 0.5;
+        points.append(origin + QPointF(x, 40 * qSin(x / 25.0)));
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FillScene adds a synthetic pattern: long flattened curves and a label for every tenth of a curve.
+ * @param plain use plain Qt items instead of the scene items that implement the level of detail.
+ */
+void FillScene(QGraphicsScene &scene, bool plain)
+{
+    const int curves = 200;
+    const int pointsPerCurve = 2000;
+    const int labelsPerCurve = 10;
+
+    for (int i = 0; i < curves; ++i)
+    {
+        const QPointF origin((i % 10) * 1100.0, (i / 10) * 150.0);
+        QPainterPath path;
+        path.addPolygon(QPolygonF(DenseCurve(origin, pointsPerCurve)));
+
+        if (plain)
+        {
+            scene.addPath(path);
+        }
+        else
+        {
+            VCurvePathItem *item = new VCurvePathItem();
+            item->setPath(path);
+            scene.addItem(item);
+        }
+
+        for (int j = 0; j < labelsPerCurve; ++j)
+        {
+            const QString name = QStringLiteral("A%1_%2").arg(i).arg(j);
+            const QPointF pos = origin + QPointF(j * 100.0, 50);
+            if (plain)
+            {
+                scene.addSimpleText(name)->setPos(pos);
+            }
+            else
+            {
+                VGraphicsSimpleTextItem *label = new VGraphicsSimpleTextItem(name, QColor(Qt::black));
+                label->setPos(pos);
+                scene.addItem(label);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<VLayoutPiece> RectanglePieces(int count)
+{
+    QVector<VLayoutPiece> pieces;
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal width = 100 + (i % 5) * 20;
+        const qreal height = 150 + (i % 3) * 40;
+
+        QVector<QPointF> points;
+        points += QPointF(0, 0);
+        points += QPointF(width, 0);
+        points += QPointF(width, height);
+        points += QPointF(0, height);
+
+        VLayoutPiece piece;
+        piece.SetCountourPoints(points);
+        pieces.append(piece);
+    }
+    return pieces;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_CoreBenchmarks::TST_CoreBenchmarks(QObject *parent)
+    : QObject(parent),
+      tmpDir()
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::initTestCase()
+{
+    QVERIFY2(tmpDir.isValid(), "Fail to create temp directory.");
+
+    const QStringList patterns = BenchmarkPatterns();
+    for (int i = 0; i < patterns.size(); ++i)
+    {
+        QVERIFY2(QFileInfo::exists(PatternPath(patterns.at(i))),
+                 qUtf8Printable(QString("Missing sample pattern %1.").arg(PatternPath(patterns.at(i)))));
+    }
+
+    // Synthetic scale-ups of the biggest sample
+    QVERIFY(not ScalePattern(PatternPath(QStringLiteral("trousers")), 10, tmpDir.path()).isEmpty());
+    QVERIFY(not ScalePattern(PatternPath(QStringLiteral("trousers")), 50, tmpDir.path()).isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::AddPatternRows() const
+{
+    QTest::addColumn<QString>("file");
+
+    const QStringList patterns = BenchmarkPatterns();
+    for (int i = 0; i < patterns.size(); ++i)
+    {
+        QTest::newRow(qUtf8Printable(patterns.at(i))) << PatternPath(patterns.at(i));
+    }
+
+    QTest::newRow("trousers x10") << tmpDir.path() + QLatin1String("/trousers_x10.sm2d");
+    QTest::newRow("trousers x50") << tmpDir.path() + QLatin1String("/trousers_x50.sm2d");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::PatternLoad_data() const
+{
+    AddPatternRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::PatternLoad() const
+{
+    QFETCH(QString, file);
+
+    Benchmark([&file]()
+    {
+        VDomDocument doc;
+        doc.setXMLContent(file);
+    });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::StreamingLoad_data() const
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<bool>("streaming");
+
+    QStringList files;
+    QStringList names;
+    const QStringList patterns = BenchmarkPatterns();
+    for (int i = 0; i < patterns.size(); ++i)
+    {
+        files.append(PatternPath(patterns.at(i)));
+        names.append(patterns.at(i));
+    }
+    files << tmpDir.path() + QLatin1String("/trousers_x10.sm2d") << tmpDir.path() + QLatin1String("/trousers_x50.sm2d");
+    names << QStringLiteral("trousers x10") << QStringLiteral("trousers x50");
+
+    for (int i = 0; i < files.size(); ++i)
+    {
+        QTest::newRow(qUtf8Printable(names.at(i) + QLatin1String(" dom"))) << files.at(i) << false;
+        QTest::newRow(qUtf8Printable(names.at(i) + QLatin1String(" stream"))) << files.at(i) << true;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief StreamingLoad compare full load with streaming load of calculation sections.
+ *
+ * Memory is the peak growth of resident set size during one load. Allocator can return memory to the system at any
+ * time, so compare it between rows of the same report only.
+ */
+void TST_CoreBenchmarks::StreamingLoad() const
+{
+    QFETCH(QString, file);
+    QFETCH(bool, streaming);
+
+    const qint64 before = ResidentMemory();
+    qint64 peak = before;
+    int tags = 0;
+    const int count = LoadPattern(file, streaming, [&peak, &tags]()
+    {
+        if (++tags % 1000 == 0)
+        {
+            peak = qMax(peak, ResidentMemory());
+        }
+    });
+    QVERIFY(count > 0);
+
+    if (before >= 0)
+    {
+        BenchmarkReport::Instance()->AddMemory(QString::fromLatin1(QTest::currentTestFunction()),
+                                               QString::fromLatin1(QTest::currentDataTag()),
+                                               qMax(peak, ResidentMemory()) - before);
+    }
+
+    Benchmark([&file, streaming]()
+    {
+        LoadPattern(file, streaming);
+    });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::Conversion_data() const
+{
+    QTest::addColumn<QString>("file");
+
+    // The shipped samples are in the current format already, old copies of the same patterns are converted instead
+    const QString suit = BenchmarkDataPath() + QLatin1String("/suit/");
+    const QStringList patterns = QStringList() << QStringLiteral("jacket1_52-176")
+                                               << QStringLiteral("jacket2_40-146")
+                                               << QStringLiteral("jacket3_40-146")
+                                               << QStringLiteral("jacket4_40-146")
+                                               << QStringLiteral("jacket5_30-110")
+                                               << QStringLiteral("jacket6_30-110")
+                                               << QStringLiteral("pants1_52-176");
+    for (int i = 0; i < patterns.size(); ++i)
+    {
+        QTest::newRow(qUtf8Printable(patterns.at(i))) << suit + patterns.at(i) + QLatin1String(".sm2d");
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::Conversion() const
+{
+    QFETCH(QString, file);
+
+    Benchmark([&file]()
+    {
+        VPatternConverter converter(file);
+        converter.Convert();
+    });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::SchemaValidation_data() const
+{
+    AddPatternRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::SchemaValidation() const
+{
+    QFETCH(QString, file);
+
+    const QString content = ReadFile(file);
+    QVERIFY(not content.isEmpty());
+
+    // Validated content is stamped. Make each iteration unique to measure the validation itself.
+    int iteration = 0;
+    Benchmark([&file, &content, &iteration]()
+    {
+        QByteArray data = content.toUtf8();
+        data.append(QStringLiteral("<!-- %1 -->\n").arg(++iteration).toUtf8());
+        QBuffer buffer(&data);
+        VDomDocument::ValidateXML(VPatternConverter::CurrentSchema, &buffer, file);
+    });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::FormulaEvaluation_data() const
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<int>("count");
+
+    const QStringList patterns = BenchmarkPatterns();
+    for (int i = 0; i < patterns.size(); ++i)
+    {
+        QTest::newRow(qUtf8Printable(patterns.at(i))) << PatternPath(patterns.at(i)) << 0;
+    }
+
+    QTest::newRow("chain of 1000 increments") << QString() << 1000;
+    QTest::newRow("chain of 10000 increments") << QString() << 10000;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FormulaEvaluation evaluate the increments table, each formula sees measurements and previous increments.
+ */
+void TST_CoreBenchmarks::FormulaEvaluation() const
+{
+    QFETCH(QString, file);
+    QFETCH(int, count);
+
+    Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+    QVector<Increment> increments;
+
+    if (file.isEmpty())
+    {
+        increments = ChainedIncrements(count);
+    }
+    else
+    {
+        VDomDocument doc;
+        doc.setXMLContent(file);
+        unit = doc.measurementUnits();
+        LoadMeasurements(file, &data);
+        increments = PatternIncrements(file);
+    }
+    QVERIFY(not increments.isEmpty());
+
+    Benchmark([&data, &increments]()
+    {
+        data.ClearVariables(VarType::Increment);
+        for (int i = 0; i < increments.size(); ++i)
+        {
+            qreal value = 0;
+            bool ok = false;
+            try
+            {
+                Calculator cal;
+                value = cal.EvalFormula(data.DataVariables(), increments.at(i).formula);
+                ok = not qIsInf(value) && not qIsNaN(value);
+            }
+            catch (qmu::QmuParserError &error)
+            {
+                Q_UNUSED(error)
+            }
+
+            data.AddVariable(increments.at(i).name, new VIncrement(&data, increments.at(i).name,
+                                                                   static_cast<quint32>(i), value,
+                                                                   increments.at(i).formula, ok));
+        }
+    });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::SeamAllowance_data() const
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100 points") << 100;
+    QTest::newRow("1000 points") << 1000;
+    QTest::newRow("10000 points") << 10000;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::SeamAllowance() const
+{
+    QFETCH(int, count);
+
+    const QVector<VSAPoint> points = WavyContour(count);
+    QVector<QPointF> ekv;
+
+    Benchmark([&points, &ekv]()
+    {
+        ekv = VAbstractPiece::Equidistant(points, 10);
+    });
+
+    QVERIFY(not ekv.isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::CheckLoops_data() const
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100 loops") << 100;
+    QTest::newRow("1000 loops") << 1000;
+    QTest::newRow("10000 loops") << 10000;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::CheckLoops() const
+{
+    QFETCH(int, count);
+
+    const QVector<QPointF> points = LoopedContour(count);
+    QVector<QPointF> result;
+
+    Benchmark([&points, &result]()
+    {
+        result = VAbstractPiece::CheckLoops(points);
+    });
+
+    QVERIFY(result.size() < points.size());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::RemoveLongLoop_data() const
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("1000 points") << 1000;
+    QTest::newRow("4000 points") << 4000;
+    QTest::newRow("16000 points") << 16000;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::RemoveLongLoop() const
+{
+    QFETCH(int, count);
+
+    const QVector<QPointF> points = LongLoop(count);
+    QVector<QPointF> result;
+
+    Benchmark([&points, &result]()
+    {
+        result = VAbstractPiece::CheckLoops(points);
+    });
+
+    QVERIFY(result.size() < points.size());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::LayoutGenerate_data() const
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("10 pieces") << 10;
+    QTest::newRow("30 pieces") << 30;
+    QTest::newRow("60 pieces") << 60;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::LayoutGenerate() const
+{
+    QFETCH(int, count);
+
+    VLayoutGenerator generator;
+    generator.SetLayoutWidth(5);
+    generator.SetPaperWidth(1000);
+    generator.SetPaperHeight(3000);
+    generator.SetPrinterFields(false, QMarginsF());
+    generator.SetRotationIncrease(90);
+    generator.SetHeadless(true);
+
+    Benchmark([&generator, count]()
+    {
+        generator.setPieces(RectanglePieces(count));
+        generator.Generate();
+    }, true);
+
+    QVERIFY(generator.State() == LayoutErrors::NoError);
+
+    int arranged = 0;
+    const QVector<QVector<VLayoutPiece>> papers = generator.getAllPieces();
+    for (int i = 0; i < papers.size(); ++i)
+    {
+        arranged += papers.at(i).size();
+    }
+    QCOMPARE(arranged, count);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_CoreBenchmarks::LevelOfDetail_data() const
+{
+    QTest::addColumn<bool>("plain");
+    QTest::addColumn<qreal>("scale");
+
+    const QVector<qreal> scales = QVector<qreal>() << 1.0 << 0.25 << 0.1;
+    for (int i = 0; i < scales.size(); ++i)
+    {
+        const QString scale = QString::number(scales.at(i), 'f', 2);
+        QTest::newRow(qUtf8Printable(QLatin1String("plain items ") + scale)) << true << scales.at(i);
+        QTest::newRow(qUtf8Printable(QLatin1String("level of detail ") + scale)) << false << scales.at(i);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LevelOfDetail frame time of a large scene drawn with plain items and with items that skip small labels and
+ * draw decimated curves.
+ */
+void TST_CoreBenchmarks::LevelOfDetail() const
+{
+    QFETCH(bool, plain);
+    QFETCH(qreal, scale);
+
+    QGraphicsScene scene;
+    FillScene(scene, plain);
+    QGraphicsView view(&scene);
+    view.setTransform(QTransform::fromScale(scale, scale));
+
+    const QRectF source = scene.itemsBoundingRect();
+    QImage image(qCeil(source.width() * scale), qCeil(source.height() * scale), QImage::Format_ARGB32_Premultiplied);
+
+    Benchmark([&scene, &image, &source]()
+    {
+        image.fill(Qt::white);
+        QPainter painter(&image);
+        painter.setRenderHint(QPainter::Antialiasing);
+        scene.render(&painter, QRectF(image.rect()), source);
+    });
+}
@@ -0,0 +1,70 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#ifndef TST_COREBENCHMARKS_H
+#define TST_COREBENCHMARKS_H
+
+#include <QObject>
+#include <QTemporaryDir>
+
+/**
+ * @brief The TST_CoreBenchmarks class times the engines that run in-process: reading, converting and validating
+ * pattern files, formula evaluation, seam allowance, layout generation and scene rendering.
+ */
+class TST_CoreBenchmarks : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TST_CoreBenchmarks(QObject *parent = nullptr);
+
+private slots:
+    void initTestCase();
+    void PatternLoad_data() const;
+    void PatternLoad() const;
+    void StreamingLoad_data() const;
+    void StreamingLoad() const;
+    void Conversion_data() const;
+    void Conversion() const;
+    void SchemaValidation_data() const;
+    void SchemaValidation() const;
+    void FormulaEvaluation_data() const;
+    void FormulaEvaluation() const;
+    void SeamAllowance_data() const;
+    void SeamAllowance() const;
+    void CheckLoops_data() const;
+    void CheckLoops() const;
+    void RemoveLongLoop_data() const;
+    void RemoveLongLoop() const;
+    void LayoutGenerate_data() const;
+    void LayoutGenerate() const;
+    void LevelOfDetail_data() const;
+    void LevelOfDetail() const;
+
+private:
+    Q_DISABLE_COPY(TST_CoreBenchmarks)
+    QTemporaryDir tmpDir;
+
+    void AddPatternRows() const;
+};
+
+#endif // TST_COREBENCHMARKS_H
@@ -0,0 +1,317 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_seamly2dbenchmarks.h"
+#include "benchmarkreport.h"
+#include "../vmisc/def.h"
+#include "../vmisc/vsysexits.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QString PatternPath(const QString &name)
+{
+    return BenchmarkDataPath() + QLatin1String("/patterns/") + name + QLatin1String(".sm2d");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadTrace read events of the trace file the application saved on exit.
+ */
+bool ReadTrace(const QString &fileName, QJsonArray &events, QString &error)
+{
+    QFile traceFile(fileName);
+    if (not traceFile.open(QIODevice::ReadOnly))
+    {
+        error = QStringLiteral("Trace file was not written.");
+        return false;
+    }
+
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(traceFile.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError)
+    {
+        error = parseError.errorString();
+        return false;
+    }
+
+    events = doc.object().value(QStringLiteral("traceEvents")).toArray();
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SpanDurations return durations of the spans with the name in nanoseconds, in the order they finished.
+ */
+QVector<qint64> SpanDurations(const QJsonArray &events, const QString &name)
+{
+    QVector<qint64> nsecs;
+    for (int i = 0; i < events.size(); ++i)
+    {
+        const QJsonObject event = events.at(i).toObject();
+        if (event.value(QStringLiteral("ph")).toString() == QLatin1String("X")
+            && event.value(QStringLiteral("name")).toString() == name)
+        {
+            nsecs.append(static_cast<qint64>(event.value(QStringLiteral("dur")).toDouble()) * 1000);
+        }
+    }
+    return nsecs;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString FormatNumber(LayoutExportFormat format)
+{
+    return QString::number(static_cast<int>(format));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MultisizePatterns return names of the sample patterns that use multisize measurements.
+ */
+QStringList MultisizePatterns()
+{
+    return QStringList() << QStringLiteral("jacket1_52-176")
+                         << QStringLiteral("jacket2_40-146")
+                         << QStringLiteral("jacket3_40-146")
+                         << QStringLiteral("jacket4_40-146")
+                         << QStringLiteral("jacket5_30-110")
+                         << QStringLiteral("jacket6_30-110");
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_Seamly2DBenchmarks::TST_Seamly2DBenchmarks(QObject *parent)
+    : AbstractTest(parent),
+      tmpDir()
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Seamly2DBenchmarks::initTestCase()
+{
+    QVERIFY2(tmpDir.isValid(), "Fail to create temp directory.");
+
+    if (not QFileInfo::exists(Seamly2DPath()))
+    {
+        QSKIP("Seamly2D binary was not found.");
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Seamly2DBenchmarks::OpenPattern_data() const
+{
+    QTest::addColumn<QString>("file");
+
+    const QStringList patterns = BenchmarkPatterns();
+    for (int i = 0; i < patterns.size(); ++i)
+    {
+        QTest::newRow(qUtf8Printable(patterns.at(i))) << PatternPath(patterns.at(i));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief OpenPattern load, validate and fully parse the pattern without showing the main window.
+ */
+void TST_Seamly2DBenchmarks::OpenPattern()
+{
+    QFETCH(QString, file);
+
+    QString error;
+    int exit = V_EX_OK;
+    Benchmark([this, &file, &error, &exit]()
+    {
+        exit = Run(V_EX_OK, Seamly2DPath(), QStringList() << QStringLiteral("--test") << file, error);
+    }, true);
+
+    QVERIFY2(exit == V_EX_OK, qUtf8Printable(error));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Seamly2DBenchmarks::ContainerSnapshots_data() const
+{
+    OpenPattern_data();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ContainerSnapshots parse the pattern and report memory taken by tables of data copies the tools keep.
+ *
+ * VPattern records the value as a trace counter after the parse.
+ */
+void TST_Seamly2DBenchmarks::ContainerSnapshots()
+{
+    QFETCH(QString, file);
+
+    const QString trace = tmpDir.path() + QLatin1String("/trace.json");
+    QFile::remove(trace);
+
+    QString error;
+    const int exit = Run(V_EX_OK, Seamly2DPath(), QStringList() << QStringLiteral("--test") << file
+                                                                << QStringLiteral("--trace") << trace, error);
+    QVERIFY2(exit == V_EX_OK, qUtf8Printable(error));
+
+    QJsonArray events;
+    QVERIFY2(ReadTrace(trace, events, error), qUtf8Printable(error));
+
+    qint64 bytes = -1;
+    for (int i = 0; i < events.size(); ++i)
+    {
+        const QJsonObject event = events.at(i).toObject();
+        if (event.value(QStringLiteral("ph")).toString() == QLatin1String("C")
+            && event.value(QStringLiteral("name")).toString() == QLatin1String("Tool data"))
+        {
+            bytes = static_cast<qint64>(event.value(QStringLiteral("args")).toObject()
+                                        .value(QStringLiteral("value")).toDouble());
+        }
+    }
+    QVERIFY2(bytes > 0, "Trace has no memory of tool data.");
+
+    BenchmarkReport::Instance()->AddMemory(QString::fromLatin1(QTest::currentTestFunction()),
+                                           QString::fromLatin1(QTest::currentDataTag()), bytes);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Seamly2DBenchmarks::Export_data() const
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<QStringList>("gradation");
+
+    QVector<QPair<QString, LayoutExportFormat>> formats;
+    formats.append(qMakePair(QStringLiteral("svg"), LayoutExportFormat::SVG));
+    formats.append(qMakePair(QStringLiteral("pdf"), LayoutExportFormat::PDF));
+    formats.append(qMakePair(QStringLiteral("png"), LayoutExportFormat::PNG));
+    formats.append(qMakePair(QStringLiteral("obj"), LayoutExportFormat::OBJ));
+    formats.append(qMakePair(QStringLiteral("dxf flat"), LayoutExportFormat::DXF_AC1015_Flat));
+    formats.append(qMakePair(QStringLiteral("dxf aama"), LayoutExportFormat::DXF_AC1015_AAMA));
+
+    const QStringList patterns = BenchmarkPatterns();
+    for (int i = 0; i < patterns.size(); ++i)
+    {
+        for (int j = 0; j < formats.size(); ++j)
+        {
+            const QString tag = patterns.at(i) + QLatin1Char(' ') + formats.at(j).first;
+            QTest::newRow(qUtf8Printable(tag)) << PatternPath(patterns.at(i)) << FormatNumber(formats.at(j).second)
+                                               << QStringList();
+        }
+    }
+
+    // Other size and height recalculate the pattern with the lite parse before export
+    const QStringList gradation = QStringList() << QStringLiteral("--gsize") << QStringLiteral("48")
+                                                << QStringLiteral("--gheight") << QStringLiteral("170");
+    const QStringList multisize = MultisizePatterns();
+    for (int i = 0; i < multisize.size(); ++i)
+    {
+        const QString tag = multisize.at(i) + QLatin1String(" svg 48-170");
+        QTest::newRow(qUtf8Printable(tag)) << PatternPath(multisize.at(i)) << FormatNumber(LayoutExportFormat::SVG)
+                                           << gradation;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Export write pieces to each format. Layout is skipped, VLayoutGenerator is measured by TST_CoreBenchmarks.
+ *
+ * Rows with a size and height of a multisize pattern also measure the lite parse that applies them.
+ */
+void TST_Seamly2DBenchmarks::Export()
+{
+    QFETCH(QString, file);
+    QFETCH(QString, format);
+    QFETCH(QStringList, gradation);
+
+    const QStringList arguments = QStringList() << file
+                                                << QStringLiteral("--exportOnlyDetails")
+                                                << QStringLiteral("-f") << format
+                                                << QStringLiteral("-d") << tmpDir.path()
+                                                << QStringLiteral("-b") << QStringLiteral("output")
+                                                << gradation;
+
+    QString error;
+    int exit = V_EX_OK;
+    Benchmark([this, &arguments, &error, &exit]()
+    {
+        exit = Run(V_EX_OK, Seamly2DPath(), arguments, error);
+    }, true);
+
+    QVERIFY2(exit == V_EX_OK, qUtf8Printable(error));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Seamly2DBenchmarks::EditVariable_data() const
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<QString>("variable");
+
+    // Variables used only by tools of the first draft block, so the edit can skip other objects
+    QTest::newRow("trousers #SideShift") << PatternPath(QStringLiteral("trousers")) << QStringLiteral("#SideShift");
+    QTest::newRow("trousers #HemLineFrontBackDiffrence") << PatternPath(QStringLiteral("trousers"))
+                                                         << QStringLiteral("#HemLineFrontBackDiffrence");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief EditVariable measure latency from editing a custom variable to updated tools on the scene.
+ *
+ * Seamly2D changes the variable and recalculates only tools that use it, then recalculates the whole pattern with
+ * the same data. Both LiteParseTree spans of the trace are reported, the whole pattern one as the baseline.
+ */
+void TST_Seamly2DBenchmarks::EditVariable()
+{
+    QFETCH(QString, file);
+    QFETCH(QString, variable);
+
+    const QString trace = tmpDir.path() + QLatin1String("/trace.json");
+    QFile::remove(trace);
+
+    const QStringList arguments = QStringList() << QStringLiteral("--test") << file
+                                                << QStringLiteral("--testVariable") << variable
+                                                << QStringLiteral("--trace") << trace;
+
+    QString error;
+    int exit = V_EX_OK;
+    Benchmark([this, &arguments, &error, &exit]()
+    {
+        exit = Run(V_EX_OK, Seamly2DPath(), arguments, error);
+    }, true);
+    QVERIFY2(exit == V_EX_OK, qUtf8Printable(error));
+
+    QJsonArray events;
+    QVERIFY2(ReadTrace(trace, events, error), qUtf8Printable(error));
+
+    const QVector<qint64> parses = SpanDurations(events, QStringLiteral("VPattern::LiteParseTree"));
+    QVERIFY2(parses.size() >= 2, "Trace has no lite parse of the edit.");
+
+    const QString stage = QString::fromLatin1(QTest::currentTestFunction());
+    const QString sample = QString::fromLatin1(QTest::currentDataTag());
+    BenchmarkReport::Instance()->Add(stage, sample + QLatin1String(" incremental"),
+                                     QVector<qint64>() << parses.at(parses.size() - 2));
+    BenchmarkReport::Instance()->Add(stage, sample + QLatin1String(" full parse"),
+                                     QVector<qint64>() << parses.last());
+}
@@ -0,0 +1,58 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#ifndef TST_SEAMLY2DBENCHMARKS_H
+#define TST_SEAMLY2DBENCHMARKS_H
+
+#include "../vtest/abstracttest.h"
+
+#include <QTemporaryDir>
+
+/**
+ * @brief The TST_Seamly2DBenchmarks class times stages that only the application can run: opening a pattern with the
+ * full parse, editing a custom variable and exporting it. Seamly2D runs in console mode, so times include start of
+ * the process. Memory taken by data of tools and times of the recalculation after an edit are read from the trace.
+ */
+class TST_Seamly2DBenchmarks : public AbstractTest
+{
+    Q_OBJECT
+public:
+    explicit TST_Seamly2DBenchmarks(QObject *parent = nullptr);
+
+private slots:
+    void initTestCase();
+    void OpenPattern_data() const;
+    void OpenPattern();
+    void ContainerSnapshots_data() const;
+    void ContainerSnapshots();
+    void Export_data() const;
+    void Export();
+    void EditVariable_data() const;
+    void EditVariable();
+
+private:
+    Q_DISABLE_COPY(TST_Seamly2DBenchmarks)
+    QTemporaryDir tmpDir;
+};
+
+#endif // TST_SEAMLY2DBENCHMARKS_H
@@ -56,6 +56,8 @@
 
 int main(int argc, char** argv)
 {
+    Q_INIT_RESOURCE(schema);
+
     QApplication app( argc, argv );
 
     int status = 0;
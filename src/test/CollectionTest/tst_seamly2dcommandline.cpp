@@ -56,8 +56,12 @@
 #include "tst_seamly2dcommandline.h"
 #include "../vmisc/vsysexits.h"
 #include "../vmisc/logging.h"
+#include "../ifc/exception/vexception.h"
+#include "../ifc/xml/vpatternconverter.h"
 
 #include <QtTest>
+#include <QJsonDocument>
+#include <QJsonObject>
 
 const QString tmpTestFolder = QStringLiteral("tst_seamly2d_tmp");
 const QString tmpTestCollectionFolder = QStringLiteral("tst_seamly2d_collection_tmp");
@@ -162,6 +166,16 @@ void TST_Seamly2DCommandLine::ExportMode_data() const
             << QString("-p;;0;;-d;;%1;;--gsize;;40;;--gheight;;134;;-b;;output").arg(tmp)
             << V_EX_OK;
 
+    QTest::newRow("A file with limited gradation. Multisize measurements. Several sizes and heights.")
+            << "glimited_vst.sm2d"
+            << QString("-p;;0;;-d;;%1;;--gsize;;38,40;;--gheight;;128-134;;-b;;output").arg(tmp)
+            << V_EX_OK;
+
+    QTest::newRow("A file with limited gradation. Multisize measurements. Several sizes, one is wrong.")
+            << "glimited_vst.sm2d"
+            << QString("-p;;0;;-d;;%1;;--gsize;;44-48;;--gheight;;134;;-b;;output").arg(tmp)
+            << V_EX_DATAERR;
+
     QTest::newRow("A file with limited gradation. Individual measurements.")
             << "glimited_vit.sm2d"
             << QString("-p;;0;;-d;;%1;;--gsize;;40;;--gheight;;134;;-b;;output").arg(tmp)
@@ -302,6 +316,142 @@ void TST_Seamly2DCommandLine::TestOpenCollection()
     QVERIFY2(exit == exitCode, qUtf8Printable(error));
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Seamly2DCommandLine::TestStreamedEvaluation_data() const
+{
+    QTest::addColumn<QString>("file");
+
+    QTest::newRow("Trousers")    << "trousers.sm2d";
+    QTest::newRow("MaleShirt")   << "male_shirt.sm2d";
+    QTest::newRow("Keiko_skirt") << "keiko_skirt.sm2d";
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestStreamedEvaluation compare console export of a pattern parsed from the tree with export of the same
+ * pattern parsed by VPattern::parseStream().
+ *
+ * Collection files are in old format, console export converts them and parses the tree. A converted copy is in current
+ * format, console export reads its calculation sections from the file.
+ */
+void TST_Seamly2DCommandLine::TestStreamedEvaluation()
+{
+    QFETCH(QString, file);
+
+    const QString tmp = QCoreApplication::applicationDirPath() + QDir::separator() + tmpTestCollectionFolder;
+    const QString oldFile = tmp + QDir::separator() + file;
+    const QString currentFile = tmp + QDir::separator() + QFileInfo(file).baseName() + QLatin1String("_current.sm2d");
+
+    try
+    {
+        VPatternConverter converter(oldFile);
+        QVERIFY(converter.GetCurrentFormatVarsion() < VPatternConverter::PatternMaxVer);
+        QFile::remove(currentFile);
+        QVERIFY(QFile::copy(converter.Convert(), currentFile));
+    }
+    catch (VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+
+    const QString domDir = tmp + QDir::separator() + QFileInfo(file).baseName() + QLatin1String("_dom");
+    const QString streamDir = tmp + QDir::separator() + QFileInfo(file).baseName() + QLatin1String("_stream");
+
+    const QStringList patterns = QStringList() << oldFile << currentFile;
+    const QStringList outputs = QStringList() << domDir << streamDir;
+    for (int i = 0; i < patterns.size(); ++i)
+    {
+        QVERIFY(QDir().mkpath(outputs.at(i)));
+
+        QString error;
+        const QStringList arg = QStringList() << patterns.at(i)
+                                              << QStringLiteral("--exportOnlyDetails")
+                                              << QStringLiteral("-f") << QString::number(7) // OBJ
+                                              << QStringLiteral("-d") << outputs.at(i)
+                                              << QStringLiteral("-b") << QStringLiteral("output");
+        const int exit = Run(V_EX_OK, Seamly2DPath(), arg, error);
+        QVERIFY2(exit == V_EX_OK, qUtf8Printable(error));
+    }
+
+    const QStringList domFiles = QDir(domDir).entryList(QDir::Files, QDir::Name);
+    QVERIFY(not domFiles.isEmpty());
+    QCOMPARE(QDir(streamDir).entryList(QDir::Files, QDir::Name), domFiles);
+
+    for (int i = 0; i < domFiles.size(); ++i)
+    {
+        QFile domResult(domDir + QDir::separator() + domFiles.at(i));
+        QFile streamResult(streamDir + QDir::separator() + domFiles.at(i));
+        QVERIFY(domResult.open(QIODevice::ReadOnly));
+        QVERIFY(streamResult.open(QIODevice::ReadOnly));
+        QVERIFY2(domResult.readAll() == streamResult.readAll(),
+                 qUtf8Printable(QString("Export %1 differs.").arg(domFiles.at(i))));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Seamly2DCommandLine::TestHeadlessEvaluation_data() const
+{
+    QTest::addColumn<QString>("file");
+
+    QTest::newRow("Trousers")    << "trousers.sm2d";
+    QTest::newRow("MaleShirt")   << "male_shirt.sm2d";
+    QTest::newRow("Keiko_skirt") << "keiko_skirt.sm2d";
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestHeadlessEvaluation compare points, curves and pieces of a pattern parsed with tools, as the main window
+ * does, with data of the same pattern calculated by VPattern::Evaluate(), as console export does.
+ */
+void TST_Seamly2DCommandLine::TestHeadlessEvaluation()
+{
+    QFETCH(QString, file);
+
+    const QString tmp = QCoreApplication::applicationDirPath() + QDir::separator() + tmpTestCollectionFolder;
+    const QString pattern = tmp + QDir::separator() + file;
+    const QString fullParseData = tmp + QDir::separator() + QFileInfo(file).baseName() + QLatin1String("_full.json");
+    const QString headlessData = tmp + QDir::separator() + QFileInfo(file).baseName() +
+                                 QLatin1String("_headless.json");
+
+    const QStringList outputs = QStringList() << fullParseData << headlessData;
+    QVector<QJsonObject> results;
+    for (int i = 0; i < outputs.size(); ++i)
+    {
+        QStringList arg = QStringList() << QStringLiteral("--test") << pattern
+                                        << QStringLiteral("--testData") << outputs.at(i);
+        if (i == 1)
+        {
+            arg << QStringLiteral("--testHeadless");
+        }
+
+        QString error;
+        const int exit = Run(V_EX_OK, Seamly2DPath(), arg, error);
+        QVERIFY2(exit == V_EX_OK, qUtf8Printable(error));
+
+        QFile data(outputs.at(i));
+        QVERIFY(data.open(QIODevice::ReadOnly));
+        const QJsonDocument json = QJsonDocument::fromJson(data.readAll());
+        QVERIFY(json.isObject());
+        results.append(json.object());
+    }
+
+    const QStringList sections = QStringList() << QStringLiteral("objects") << QStringLiteral("pieces");
+    for (int i = 0; i < sections.size(); ++i)
+    {
+        const QJsonObject fullParse = results.at(0).value(sections.at(i)).toObject();
+        const QJsonObject headless = results.at(1).value(sections.at(i)).toObject();
+        QCOMPARE(headless.keys(), fullParse.keys());
+
+        for (auto j = fullParse.constBegin(); j != fullParse.constEnd(); ++j)
+        {
+            QVERIFY2(headless.value(j.key()) == j.value(),
+                     qUtf8Printable(QString("Calculated %1 %2 differs.").arg(sections.at(i), j.key())));
+        }
+    }
+
+    QVERIFY(not results.at(0).value(QStringLiteral("pieces")).toObject().isEmpty());
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // cppcheck-suppress unusedFunction
 void TST_Seamly2DCommandLine::cleanupTestCase()
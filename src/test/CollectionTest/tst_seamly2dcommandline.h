@@ -70,6 +70,10 @@ private slots:
     void TestMode();
     void TestOpenCollection_data() const;
     void TestOpenCollection();
+    void TestStreamedEvaluation_data() const;
+    void TestStreamedEvaluation();
+    void TestHeadlessEvaluation_data() const;
+    void TestHeadlessEvaluation();
     void cleanupTestCase();
 
 private:
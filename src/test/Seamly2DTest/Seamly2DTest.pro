@@ -49,7 +49,18 @@ SOURCES += \
     tst_vpointf.cpp \
     tst_readval.cpp \
     tst_vtranslatevars.cpp \
-    tst_vabstractpiece.cpp
+    tst_vabstractpiece.cpp \
+    tst_vlayoutgenerator.cpp \
+    tst_calculator.cpp \
+    tst_vpatterngraph.cpp \
+    tst_vcontainer.cpp \
+    tst_vdomdocument.cpp \
+    tst_scenerendering.cpp \
+    tst_vtrace.cpp \
+    tst_vpersistenthash.cpp \
+    tst_vobjengine.cpp \
+    tst_vdxfengine.cpp \
+    tst_vcontour.cpp
 
 *msvc*:SOURCES += stable.cpp
 
@@ -75,7 +86,18 @@ HEADERS += \
     tst_vpointf.h \
     tst_readval.h \
     tst_vtranslatevars.h \
-    tst_vabstractpiece.h
+    tst_vabstractpiece.h \
+    tst_vlayoutgenerator.h \
+    tst_calculator.h \
+    tst_vpatterngraph.h \
+    tst_vcontainer.h \
+    tst_vdomdocument.h \
+    tst_scenerendering.h \
+    tst_vtrace.h \
+    tst_vpersistenthash.h \
+    tst_vobjengine.h \
+    tst_vdxfengine.h \
+    tst_vcontour.h
 
 include(warnings.pri)
 
@@ -151,6 +173,24 @@ DEPENDPATH += $$PWD/../../libs/vgeometry
 win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vgeometry/$${DESTDIR}/vgeometry.lib
 else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vgeometry/$${DESTDIR}/libvgeometry.a
 
+# VObj static library
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vobj/$${DESTDIR}/ -lvobj
+
+INCLUDEPATH += $$PWD/../../libs/vobj
+DEPENDPATH += $$PWD/../../libs/vobj
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vobj/$${DESTDIR}/vobj.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vobj/$${DESTDIR}/libvobj.a
+
+# VDxf static library
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vdxf/$${DESTDIR}/ -lvdxf
+
+INCLUDEPATH += $$PWD/../../libs/vdxf
+DEPENDPATH += $$PWD/../../libs/vdxf
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vdxf/$${DESTDIR}/vdxf.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vdxf/$${DESTDIR}/libvdxf.a
+
 # VLayout static library
 unix|win32: LIBS += -L$$OUT_PWD/../../libs/vlayout/$${DESTDIR} -lvlayout
 
@@ -72,6 +72,17 @@
 #include "tst_vpointf.h"
 #include "tst_readval.h"
 #include "tst_vtranslatevars.h"
+#include "tst_vlayoutgenerator.h"
+#include "tst_calculator.h"
+#include "tst_vpatterngraph.h"
+#include "tst_vcontainer.h"
+#include "tst_vdomdocument.h"
+#include "tst_scenerendering.h"
+#include "tst_vtrace.h"
+#include "tst_vpersistenthash.h"
+#include "tst_vobjengine.h"
+#include "tst_vdxfengine.h"
+#include "tst_vcontour.h"
 
 #include "../vmisc/def.h"
 #include "../qmuparser/qmudef.h"
@@ -159,6 +170,17 @@ int main(int argc, char** argv)
     ASSERT_TEST(new TST_VPointF());
     ASSERT_TEST(new TST_ReadVal());
     ASSERT_TEST(new TST_VTranslateVars());
+    ASSERT_TEST(new TST_VLayoutGenerator());
+    ASSERT_TEST(new TST_Calculator());
+    ASSERT_TEST(new TST_VPatternGraph());
+    ASSERT_TEST(new TST_VContainer());
+    ASSERT_TEST(new TST_VPersistentHash());
+    ASSERT_TEST(new TST_VObjEngine());
+    ASSERT_TEST(new TST_VDxfEngine());
+    ASSERT_TEST(new TST_VContour());
+    ASSERT_TEST(new TST_VDomDocument());
+    ASSERT_TEST(new TST_SceneRendering());
+    ASSERT_TEST(new TST_VTrace()); // Must be the last, tracing stays enabled
 
     return status;
 }
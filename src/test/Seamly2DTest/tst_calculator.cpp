@@ -0,0 +1,113 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_calculator.h"
+#include "../vpatterndb/calculator.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/variables/vincrement.h"
+#include "../qmuparser/qmuparsererror.h"
+
+#include <QtTest>
+
+namespace
+{
+typedef VPersistentHash<QString, QSharedPointer<VInternalVariable> > Variables;
+
+//---------------------------------------------------------------------------------------------------------------------
+Variables MakeVariables(VContainer *data, qreal a, qreal b)
+{
+    Variables vars;
+    vars.insert("#a", QSharedPointer<VInternalVariable>(new VIncrement(data, "#a", 0, a, QString::number(a), true)));
+    vars.insert("#b", QSharedPointer<VInternalVariable>(new VIncrement(data, "#b", 1, b, QString::number(b), true)));
+    return vars;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_Calculator::TST_Calculator(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestCachedFormula the second evaluation of a formula must use values of new variables, not the cached ones.
+ */
+void TST_Calculator::TestCachedFormula() const
+{
+    Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+
+    const QString formula = QStringLiteral("#a*#b+#a*#a");
+
+    const Variables vars1 = MakeVariables(&data, 2, 3);
+    const Variables vars2 = MakeVariables(&data, 5, 1);
+
+    {
+        Calculator cal;
+        QCOMPARE(cal.EvalFormula(&vars1, formula), 10.0);
+    }
+
+    {
+        Calculator cal;
+        QCOMPARE(cal.EvalFormula(&vars2, formula), 30.0);
+    }
+
+    Calculator cal;
+    QCOMPARE(cal.EvalFormula(&vars1, formula), 10.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Calculator::TestCachedConstant() const
+{
+    const Variables vars;
+    for (int i = 0; i < 2; ++i)
+    {
+        Calculator cal;
+        QCOMPARE(cal.EvalFormula(&vars, QStringLiteral("(1+2)*4")), 12.0);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestCachedUnknownVariable a cached formula must still report variables that don't exist anymore.
+ */
+void TST_Calculator::TestCachedUnknownVariable() const
+{
+    Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+
+    const QString formula = QStringLiteral("#a+#b*2");
+
+    const Variables vars = MakeVariables(&data, 1, 2);
+    {
+        Calculator cal;
+        QCOMPARE(cal.EvalFormula(&vars, formula), 5.0);
+    }
+
+    Variables reduced = vars;
+    reduced.remove("#b");
+
+    Calculator cal;
+    QVERIFY_EXCEPTION_THROWN(cal.EvalFormula(&reduced, formula), qmu::QmuParserError);
+}
@@ -0,0 +1,112 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_scenerendering.h"
+#include "../vwidgets/global.h"
+
+#include <QLineF>
+#include <QPainterPath>
+#include <QPolygonF>
+#include <QtMath>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> DenseCurve(const QPointF &origin, int count)
+{
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal x = i * 0.5;
+        points.append(origin + QPointF(x, 40 * qSin(x / 25.0)));
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal DistanceToPolyline(const QPointF &point, const QPolygonF &polyline)
+{
+    qreal distance = QLineF(point, polyline.first()).length();
+    for (int i = 0; i < polyline.size() - 1; ++i)
+    {
+        const QPointF a = polyline.at(i);
+        const QPointF ab = polyline.at(i + 1) - a;
+        const qreal length = QPointF::dotProduct(ab, ab);
+        qreal t = length > 0 ? QPointF::dotProduct(point - a, ab) / length : 0;
+        t = qBound(0.0, t, 1.0);
+        distance = qMin(distance, QLineF(point, a + ab * t).length());
+    }
+    return distance;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_SceneRendering::TST_SceneRendering(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_SceneRendering::TestDecimatedPath() const
+{
+    const QVector<QPointF> points = DenseCurve(QPointF(10, 10), 5000);
+    QPainterPath path;
+    path.addPolygon(QPolygonF(points));
+
+    const qreal tolerance = 5;
+    const QPainterPath simplified = decimatedPath(path, tolerance);
+
+    QVERIFY(simplified.elementCount() < path.elementCount() / 4);
+    QCOMPARE(QPointF(simplified.elementAt(0)), points.first());
+    QCOMPARE(QPointF(simplified.elementAt(simplified.elementCount() - 1)), points.last());
+
+    const QList<QPolygonF> polylines = simplified.toSubpathPolygons();
+    QCOMPARE(polylines.size(), 1);
+
+    for (int i = 0; i < points.size(); ++i)
+    {
+        QVERIFY2(DistanceToPolyline(points.at(i), polylines.first()) <= tolerance + accuracyPointOnLine,
+                 qPrintable(QStringLiteral("Point %1 is too far from the decimated path.").arg(i)));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_SceneRendering::TestDecimatedPathCache() const
+{
+    QPainterPath path;
+    path.addPolygon(QPolygonF(DenseCurve(QPointF(), 1000)));
+
+    VDecimatedPathCache cache;
+    QVERIFY(cache.path(path, levelOfDetailScale).isEmpty());
+    QVERIFY(cache.path(path, 2.0).isEmpty());
+
+    const int zoomedOut = cache.path(path, 0.1).elementCount();
+    QVERIFY(zoomedOut > 1);
+    QVERIFY(zoomedOut < path.elementCount());
+    QVERIFY(cache.path(path, 0.5).elementCount() > zoomedOut);
+
+    QPainterPath other;
+    other.addPolygon(QPolygonF(DenseCurve(QPointF(), 10)));
+    QVERIFY(cache.path(other, 0.1).elementCount() <= other.elementCount());
+}
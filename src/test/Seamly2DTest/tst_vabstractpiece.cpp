@@ -2407,6 +2407,49 @@ void TST_VAbstractPiece::PathLoopsCase() const
     Comparison(res, expect);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractPiece::PathRemoveLoopLarge_data() const
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("500 points") << 500;
+    QTest::newRow("1000 points") << 1000;
+    QTest::newRow("2000 points") << 2000;
+    QTest::newRow("4000 points") << 4000;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractPiece::PathRemoveLoopLarge() const
+{
+    QFETCH(int, count);
+
+    // A vertical segment followed by a long loop that crosses it once in the point (500, 0).
+    const int half = count / 2;
+    QVector<QPointF> path;
+    path << QPointF(500, -100) << QPointF(500, 100);
+    for (int k = 1; k <= half; ++k)
+    {
+        path << QPointF(500 - k * 500.0 / half, 100);
+    }
+
+    QVector<QPointF> expect;
+    expect << QPointF(500, -100) << QPointF(500, 0);
+
+    path << QPointF(0, 0);
+    for (int k = 0; k < half; ++k)
+    {
+        const QPointF p((k + 0.5) * 1000.0 / half, 0);
+        path << p;
+        if (p.x() > 500)
+        {
+            expect << p;
+        }
+    }
+
+    const QVector<QPointF> res = VAbstractPiece::CheckLoops(path);
+    Comparison(res, expect);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VAbstractPiece::BrokenDetailEquidistant_data() const
 {
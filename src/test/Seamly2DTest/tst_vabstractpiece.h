@@ -70,6 +70,8 @@ private slots:
     void PathRemoveLoop() const;
     void PathLoopsCase_data() const;
     void PathLoopsCase() const;
+    void PathRemoveLoopLarge_data() const;
+    void PathRemoveLoopLarge() const;
     void BrokenDetailEquidistant_data() const;
     void BrokenDetailEquidistant() const;
     void CorrectEquidistantPoints_data() const;
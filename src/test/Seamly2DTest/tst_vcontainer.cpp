@@ -0,0 +1,182 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vcontainer.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/variables/measurement_variable.h"
+#include "../vgeometry/vpointf.h"
+
+#include <QThread>
+#include <QtTest>
+
+namespace
+{
+/**
+ * @brief The SizeEvaluation class evaluates a measurement for one size in own thread and own context.
+ */
+class SizeEvaluation : public QThread
+{
+public:
+    explicit SizeEvaluation(qreal size)
+        : QThread(), size(size), value(0), lastId(NULL_ID), isUnique(false)
+    {}
+
+    qreal   size;
+    qreal   value;
+    quint32 lastId;
+    bool    isUnique;
+
+protected:
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        VEvaluationContext context;
+        VEvaluationScope scope(&context);
+
+        Unit unit = Unit::Cm;
+        VContainer data(nullptr, &unit);
+        VContainer::setSize(size);
+        VContainer::setHeight(176);
+
+        QSharedPointer<MeasurementVariable> m(new MeasurementVariable(0, "waist", 50, 176, 80, 2, 0));
+        m->setSize(VContainer::rsize());
+        m->setHeight(VContainer::rheight());
+        m->SetUnit(&unit);
+        data.AddVariable(m->GetName(), m);
+
+        for (int i = 0; i < 10000; ++i)
+        {
+            VContainer::getNextId();
+        }
+
+        // Give other threads a chance to change their size before reading ours.
+        QThread::msleep(10);
+
+        value = *data.GetVariable<MeasurementVariable>("waist")->GetValue();
+        lastId = VContainer::getId();
+        isUnique = not VContainer::IsUnique("waist");
+    }
+};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VContainer::TST_VContainer(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestScope state of an installed context must not leak into the default one.
+ */
+void TST_VContainer::TestScope() const
+{
+    const quint32 id = VContainer::getId();
+    const qreal size = VContainer::size();
+
+    {
+        VEvaluationContext context;
+        VEvaluationScope scope(&context);
+
+        QCOMPARE(VContainer::getId(), NULL_ID);
+        QCOMPARE(VContainer::getNextId(), 1u);
+        VContainer::UpdateId(100);
+        VContainer::setSize(size + 2);
+        QCOMPARE(VContainer::Context(), &context);
+    }
+
+    QCOMPARE(VContainer::getId(), id);
+    QCOMPARE(VContainer::size(), size);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestParallelSizes each thread must see only the size and ids of its own context.
+ */
+void TST_VContainer::TestParallelSizes() const
+{
+    QVector<SizeEvaluation *> evaluations;
+    for (int size = 40; size <= 54; size += 2)
+    {
+        evaluations.append(new SizeEvaluation(size));
+    }
+
+    for (auto evaluation : evaluations)
+    {
+        evaluation->start();
+    }
+
+    for (auto evaluation : evaluations)
+    {
+        evaluation->wait();
+
+        const qreal expected = 80 + (evaluation->size - 50) / 2 * 2;
+        QCOMPARE(evaluation->value, expected);
+        QCOMPARE(evaluation->lastId, 10000u);
+        QVERIFY(evaluation->isUnique);
+    }
+
+    qDeleteAll(evaluations);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestSnapshots copies taken by tools keep own set of objects and variables, but share the objects themselves.
+ */
+void TST_VContainer::TestSnapshots() const
+{
+    VEvaluationContext context;
+    VEvaluationScope scope(&context);
+
+    Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+    QList<VContainer> snapshots;
+    quint32 previous = NULL_ID;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const quint32 id = data.AddGObject(new VPointF(i, i, QString("A%1").arg(i), 0, 0));
+        if (previous != NULL_ID)
+        {
+            data.AddLine(previous, id);
+        }
+        previous = id;
+        snapshots.append(data);
+    }
+
+    QCOMPARE(snapshots.at(9).DataGObjects()->size(), 10);
+    QCOMPARE(snapshots.at(9).DataVariables()->size(), 18);
+    QCOMPARE(data.DataGObjects()->size(), 1000);
+
+    // Update of an existing object is done in place, all snapshots see it
+    data.UpdateGObject(1, new VPointF(-1, -1, QStringLiteral("A0"), 0, 0));
+    QCOMPARE(snapshots.first().GeometricObject<VPointF>(1)->x(), -1.0);
+
+    QSet<const void *> visited;
+    const qint64 single = data.DataGObjects()->MemoryUsage(&visited);
+    qint64 total = single;
+    for (int i = 0; i < snapshots.size(); ++i)
+    {
+        total += snapshots.at(i).DataGObjects()->MemoryUsage(&visited);
+    }
+    // Private tables would take about five hundred times more
+    QVERIFY2(total < single * 100, qUtf8Printable(QString("%1 bytes for snapshots of %2").arg(total).arg(single)));
+}
@@ -0,0 +1,115 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vcontour.h"
+#include "../vlayout/vcontour.h"
+
+#include <QPainterPath>
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <QtMath>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> Comb()
+{
+    QVector<QPointF> points;
+    points << QPointF(0, 1000) << QPointF(0, 0);
+    for (int i = 0; i < 10; ++i)
+    {
+        points << QPointF(i * 100 + 50, 0) << QPointF(i * 100 + 50, 800) << QPointF(i * 100 + 100, 800)
+               << QPointF(i * 100 + 100, 0);
+    }
+    points << QPointF(1000, 1000);
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Spiral goes around the middle of the sheet several times and back, so the winding number there is not 1.
+ */
+QVector<QPointF> Spiral()
+{
+    QVector<QPointF> points;
+    const int turns = 3;
+    const int steps = 24;
+    for (int i = 0; i <= turns * steps; ++i)
+    {
+        const qreal angle = 2 * M_PI * i / steps;
+        const qreal radius = 200 + i * 3;
+        points << QPointF(500 + radius * qCos(angle), 500 + radius * qSin(angle));
+    }
+    points << QPointF(950, 500) << QPointF(950, 980) << QPointF(20, 980) << QPointF(20, 500);
+    return points;
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VContour::TST_VContour(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VContour::TestClippedPath_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("contour");
+    QTest::addColumn<QRectF>("clipRect");
+
+    QTest::newRow("Comb, teeth") << Comb() << QRectF(130, 300, 420, 200);
+    QTest::newRow("Comb, one gap") << Comb() << QRectF(410, 100, 30, 600);
+    QTest::newRow("Comb, corner") << Comb() << QRectF(-50, 700, 300, 400);
+    QTest::newRow("Spiral, middle") << Spiral() << QRectF(450, 450, 100, 100);
+    QTest::newRow("Spiral, turns") << Spiral() << QRectF(300, 250, 400, 120);
+    QTest::newRow("Spiral, outside") << Spiral() << QRectF(1100, 1100, 100, 100);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestClippedPath inside the clip rect the clipped path must fill the same points as the whole contour.
+ */
+void TST_VContour::TestClippedPath() const
+{
+    QFETCH(QVector<QPointF>, contour);
+    QFETCH(QRectF, clipRect);
+
+    VContour globalContour(1000, 1000);
+    globalContour.SetContour(contour);
+
+    const QPainterPath wholePath = globalContour.ContourPath();
+    const QPainterPath clippedPath = globalContour.ContourPath(clipRect);
+
+    const int samples = 40;
+    for (int i = 0; i < samples; ++i)
+    {
+        for (int j = 0; j < samples; ++j)
+        {
+            const QPointF p(clipRect.left() + (i + 0.5) * clipRect.width() / samples,
+                            clipRect.top() + (j + 0.5) * clipRect.height() / samples);
+            QCOMPARE(clippedPath.contains(p), wholePath.contains(p));
+        }
+    }
+}
@@ -0,0 +1,330 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vdomdocument.h"
+#include "../ifc/xml/vabstractpattern.h"
+#include "../ifc/xml/vdomdocument.h"
+
+#include <QFile>
+#include <QTemporaryFile>
+#include <QTextStream>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WritePattern write a pattern with given number of draft blocks and points in each calculation section.
+ */
+void WritePattern(QIODevice *device, int blocks, int points)
+{
+    QXmlStreamWriter stream(device);
+    stream.setAutoFormatting(true);
+    stream.writeStartDocument();
+    stream.writeStartElement(VAbstractPattern::TagPattern);
+    stream.writeComment(QStringLiteral("Pattern created for testing."));
+    stream.writeTextElement(VDomDocument::TagVersion, QStringLiteral("0.6.8"));
+    stream.writeTextElement(VDomDocument::TagUnit, QStringLiteral("cm"));
+    stream.writeEmptyElement(VAbstractPattern::TagIncrements);
+
+    quint32 id = 0;
+    for (int i = 0; i < blocks; ++i)
+    {
+        stream.writeStartElement(VAbstractPattern::TagDraftBlock);
+        stream.writeAttribute(VAbstractPattern::AttrName, QStringLiteral("Block %1").arg(i + 1));
+
+        stream.writeStartElement(VAbstractPattern::TagCalculation);
+        const quint32 basePoint = ++id;
+        for (int j = 0; j < points; ++j)
+        {
+            stream.writeStartElement(VAbstractPattern::TagPoint);
+            stream.writeAttribute(VDomDocument::AttrId, QString::number(j == 0 ? basePoint : ++id));
+            stream.writeAttribute(VAbstractPattern::AttrType, j == 0 ? QStringLiteral("single")
+                                                                     : QStringLiteral("endLine"));
+            stream.writeAttribute(QStringLiteral("name"), QStringLiteral("A%1").arg(id));
+            stream.writeAttribute(QStringLiteral("basePoint"), QString::number(basePoint));
+            stream.writeAttribute(QStringLiteral("length"), QStringLiteral("(Line_A1_A2 + #x%1)/2").arg(j));
+            stream.writeAttribute(QStringLiteral("angle"), QString::number(j % 360));
+            stream.writeAttribute(QStringLiteral("mx"), QStringLiteral("0.132292"));
+            stream.writeAttribute(QStringLiteral("my"), QStringLiteral("0.264583"));
+            stream.writeEndElement();
+        }
+        stream.writeEndElement(); // calculation
+
+        stream.writeStartElement(VAbstractPattern::TagModeling);
+        stream.writeStartElement(VAbstractPattern::TagPoint);
+        stream.writeAttribute(VDomDocument::AttrId, QString::number(++id));
+        stream.writeAttribute(QStringLiteral("idObject"), QString::number(basePoint));
+        stream.writeAttribute(VAbstractPattern::AttrType, QStringLiteral("modeling"));
+        stream.writeEndElement();
+        stream.writeEndElement(); // modeling
+
+        stream.writeEmptyElement(VAbstractPattern::TagPieces);
+        stream.writeEndElement(); // draftBlock
+    }
+
+    stream.writeEndElement(); // pattern
+    stream.writeEndDocument();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief StreamCalculations read all tags of calculation sections one by one the way a streaming parse does.
+ * @return ids of read tags.
+ */
+QVector<quint32> StreamCalculations(const QString &fileName, QDomDocument &doc)
+{
+    QVector<quint32> ids;
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        return ids;
+    }
+
+    QXmlStreamReader reader(&file);
+    while (not reader.atEnd())
+    {
+        reader.readNext();
+        if (reader.isStartElement() && reader.name() == VAbstractPattern::TagCalculation)
+        {
+            while (reader.readNextStartElement())
+            {
+                const QDomElement element = VDomDocument::ReadElement(reader, doc);
+                ids.append(VDomDocument::GetParametrUInt(element, VDomDocument::AttrId, NULL_ID_STR));
+            }
+        }
+    }
+    return ids;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<quint32> CalculationIds(const QDomDocument &doc)
+{
+    QVector<quint32> ids;
+    const QDomNodeList list = doc.elementsByTagName(VAbstractPattern::TagCalculation);
+    for (int i = 0; i < list.size(); ++i)
+    {
+        QDomElement element = list.at(i).firstChildElement();
+        while (not element.isNull())
+        {
+            ids.append(VDomDocument::GetParametrUInt(element, VDomDocument::AttrId, NULL_ID_STR));
+            element = element.nextSiblingElement();
+        }
+    }
+    return ids;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString ToString(const QDomNode &node)
+{
+    QString text;
+    QTextStream stream(&text);
+    node.save(stream, 1);
+    return text;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VDomDocument::TST_VDomDocument(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestSkippedContent skipped tags must not reach the tree, the rest must be the same as with full load.
+ */
+void TST_VDomDocument::TestSkippedContent() const
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    WritePattern(&file, 2, 10);
+    file.close();
+
+    VDomDocument full;
+    full.setXMLContent(file.fileName());
+
+    VDomDocument shell;
+    shell.setXMLContentSkipping(file.fileName(), QStringList() << VAbstractPattern::TagCalculation);
+
+    QCOMPARE(shell.elementsByTagName(VAbstractPattern::TagCalculation).size(), 0);
+    QCOMPARE(shell.elementsByTagName(VAbstractPattern::TagDraftBlock).size(), 2);
+
+    // Removing calculation sections from full tree must give the same document.
+    const QDomNodeList calculations = full.elementsByTagName(VAbstractPattern::TagCalculation);
+    while (not calculations.isEmpty())
+    {
+        const QDomNode calculation = calculations.at(0);
+        calculation.parentNode().removeChild(calculation);
+    }
+    QCOMPARE(ToString(shell.documentElement()), ToString(full.documentElement()));
+
+    // Elements left in memory can be found by id.
+    const QDomElement modeling = shell.elementById(11);
+    QVERIFY(not modeling.isNull());
+    QCOMPARE(modeling.attribute(QStringLiteral("idObject")), QStringLiteral("1"));
+    QVERIFY(shell.elementById(2).isNull());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestStreamedElements a streaming pass must see the same calculation tags as the full tree.
+ */
+void TST_VDomDocument::TestStreamedElements() const
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    WritePattern(&file, 3, 25);
+    file.close();
+
+    VDomDocument full;
+    full.setXMLContent(file.fileName());
+
+    VDomDocument shell;
+    shell.setXMLContentSkipping(file.fileName(), QStringList() << VAbstractPattern::TagCalculation);
+
+    const QVector<quint32> ids = StreamCalculations(file.fileName(), shell);
+    QCOMPARE(ids, CalculationIds(full));
+
+    // Read element keeps all attributes.
+    QFile stream(file.fileName());
+    QVERIFY(stream.open(QIODevice::ReadOnly));
+    QXmlStreamReader reader(&stream);
+    while (reader.readNextStartElement() && reader.name() != VAbstractPattern::TagPoint)
+    {
+        if (reader.name() != VAbstractPattern::TagPattern && reader.name() != VAbstractPattern::TagDraftBlock
+                && reader.name() != VAbstractPattern::TagCalculation)
+        {
+            reader.skipCurrentElement();
+        }
+    }
+    QVERIFY(reader.isStartElement());
+    const QDomElement point = VDomDocument::ReadElement(reader, shell);
+    QVERIFY(reader.isEndElement());
+    QCOMPARE(point.attributes().size(), full.elementById(1).attributes().size());
+    QCOMPARE(point.attribute(VAbstractPattern::AttrType), QStringLiteral("single"));
+    QVERIFY(point.parentNode().isNull());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestElementByIdChangedId the cached element must not be found by the old id after the id was changed.
+ */
+void TST_VDomDocument::TestElementByIdChangedId() const
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    WritePattern(&file, 2, 10);
+    file.close();
+
+    VDomDocument doc;
+    doc.setXMLContent(file.fileName());
+
+    QDomElement point = doc.elementById(5);
+    QVERIFY(not point.isNull());
+    point.setAttribute(VDomDocument::AttrId, 500);
+
+    QVERIFY(doc.elementById(5).isNull());
+    QVERIFY(doc.elementById(5, VAbstractPattern::TagPoint).isNull());
+
+    const QDomElement renumbered = doc.elementById(500);
+    QVERIFY(renumbered == point);
+    QVERIFY(doc.elementById(500, VAbstractPattern::TagPoint) == point);
+
+    // Other cached elements are still found after the rescan.
+    QCOMPARE(doc.elementById(6).attribute(VDomDocument::AttrId), QStringLiteral("6"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestElementByIdMoved an element moved to other parent must be found at the new place.
+ */
+void TST_VDomDocument::TestElementByIdMoved() const
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    WritePattern(&file, 2, 10);
+    file.close();
+
+    VDomDocument doc;
+    doc.setXMLContent(file.fileName());
+
+    const QDomElement point = doc.elementById(5);
+    QVERIFY(not point.isNull());
+
+    // Move the point into the calculation section of the second draft block.
+    QDomElement target = doc.elementById(12).parentNode().toElement();
+    QVERIFY(not target.isNull());
+    target.appendChild(point);
+
+    const QDomElement moved = doc.elementById(5);
+    QVERIFY(moved == point);
+    QVERIFY(moved.parentNode() == target);
+    QVERIFY(doc.elementById(5, VAbstractPattern::TagPoint).parentNode() == target);
+
+    // A copy moved in place of the original must be returned, not the detached original.
+    const QDomElement copy = point.cloneNode().toElement();
+    target.replaceChild(copy, point);
+
+    const QDomElement found = doc.elementById(5);
+    QVERIFY(found == copy);
+    QVERIFY(not (found == point));
+    QVERIFY(found.parentNode() == target);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestElementByIdRemoved a removed element must not be returned, also when its parent was removed.
+ */
+void TST_VDomDocument::TestElementByIdRemoved() const
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    WritePattern(&file, 2, 10);
+    file.close();
+
+    VDomDocument doc;
+    doc.setXMLContent(file.fileName());
+
+    const QDomElement point = doc.elementById(5);
+    QVERIFY(not point.isNull());
+    point.parentNode().removeChild(point);
+
+    QVERIFY(doc.elementById(5).isNull());
+    QVERIFY(doc.elementById(5, VAbstractPattern::TagPoint).isNull());
+
+    // Element stays attached to its removed parent, the whole branch is detached from the document.
+    const QDomElement modeling = doc.elementById(11);
+    QVERIFY(not modeling.isNull());
+    QDomNode section = modeling.parentNode();
+    section.parentNode().removeChild(section);
+
+    QVERIFY(not modeling.parentNode().isNull());
+    QVERIFY(doc.elementById(11).isNull());
+    QVERIFY(doc.elementById(11, VAbstractPattern::TagPoint).isNull());
+
+    // Elements of the other draft block are still found.
+    QVERIFY(not doc.elementById(22).isNull());
+}
@@ -0,0 +1,168 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vdxfengine.h"
+#include "../vdxf/vdxfpaintdevice.h"
+#include "../vdxf/dxfdef.h"
+#include "../vmisc/def.h"
+
+#include <QFile>
+#include <QFont>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPolygonF>
+#include <QTemporaryDir>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+bool Paint(const QString &fileName, bool binary, bool streaming, const QFont &registered, const QFont &font)
+{
+    VDxfPaintDevice generator;
+    generator.setFileName(fileName);
+    generator.setSize(QSize(2000, 2000));
+    generator.setResolution(PrintDPI);
+    generator.SetBinaryFormat(binary);
+    generator.SetStreaming(streaming);
+    generator.AddFont(registered);
+
+    QPainter painter;
+    if (not painter.begin(&generator))
+    {
+        return false;
+    }
+
+    painter.setPen(QPen(Qt::black, 1, Qt::SolidLine));
+    painter.drawLine(QLineF(10, 10, 500, 300));
+    painter.setPen(QPen(Qt::black, 1, Qt::DashLine));
+    painter.drawLine(QLineF(500, 300, 10, 800));
+
+    painter.setPen(QPen(Qt::black, 1, Qt::SolidLine));
+    painter.drawPolyline(QPolygonF() << QPointF(100, 100) << QPointF(900, 150) << QPointF(700, 900));
+    painter.drawPolygon(QPolygonF() << QPointF(1000, 1000) << QPointF(1500, 1000) << QPointF(1250, 1400));
+
+    QPainterPath path;
+    path.moveTo(1200, 200);
+    path.cubicTo(1300, 100, 1500, 500, 1800, 300);
+    painter.drawPath(path);
+
+    painter.drawEllipse(QPointF(600, 1500), 300, 150);
+
+    painter.setFont(font);
+    painter.drawText(QPointF(100, 1900), QStringLiteral("Seamly2D") + endStringPlaceholder);
+
+    return painter.end();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadDxf reads the file and masks the creation time, the only part that differs between two exports.
+ */
+QByteArray ReadDxf(const QString &fileName)
+{
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        return QByteArray();
+    }
+
+    QByteArray data = file.readAll();
+    const QByteArray variable("$TDCREATE");
+    const int begin = data.indexOf(variable);
+    if (begin != -1)
+    {
+        const int valueBegin = begin + variable.size();
+        const int valueEnd = data.indexOf('$', valueBegin);
+        if (valueEnd != -1)
+        {
+            data.remove(valueBegin, valueEnd - valueBegin);
+        }
+    }
+    return data;
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VDxfEngine::TST_VDxfEngine(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDxfEngine::TestStreaming_data() const
+{
+    QTest::addColumn<bool>("binary");
+    QTest::addColumn<bool>("registered");
+
+    QTest::newRow("ASCII, registered font") << false << true;
+    QTest::newRow("ASCII, unregistered font") << false << false;
+    QTest::newRow("Binary, registered font") << true << true;
+    QTest::newRow("Binary, unregistered font") << true << false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestStreaming compares the streamed file with the file written by dx_iface::fileExport() at the end.
+ *
+ * Text in a font that was not registered before painting falls back to the default style while streaming, the old
+ * writer adds a style for it instead.
+ */
+void TST_VDxfEngine::TestStreaming() const
+{
+    QFETCH(bool, binary);
+    QFETCH(bool, registered);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    QFont registeredFont(QStringLiteral("Courier"));
+    registeredFont.setPixelSize(40);
+
+    QFont font = registeredFont;
+    if (not registered)
+    {
+        font.setBold(true);
+    }
+
+    const QString streamed = dir.path() + QStringLiteral("/streamed.dxf");
+    const QString exported = dir.path() + QStringLiteral("/exported.dxf");
+    QVERIFY(Paint(streamed, binary, true, registeredFont, font));
+    QVERIFY(Paint(exported, binary, false, registeredFont, font));
+
+    const QByteArray streamedData = ReadDxf(streamed);
+    const QByteArray exportedData = ReadDxf(exported);
+    QVERIFY(not streamedData.isEmpty());
+    QVERIFY(not exportedData.isEmpty());
+
+    if (registered)
+    {
+        QCOMPARE(streamedData, exportedData);
+    }
+    else
+    {
+        const QByteArray style = font.family().toUpper().toUtf8() + "_BOLD";
+        QVERIFY(not streamedData.contains(style));
+        QVERIFY(exportedData.contains(style));
+    }
+}
@@ -73,6 +73,46 @@ void TST_VLayoutDetail::RemoveDublicates() const
     Case3();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LayoutAllowanceCache check that cached layout geometry follows a new layout width.
+ */
+void TST_VLayoutDetail::LayoutAllowanceCache() const
+{
+    QVector<QPointF> points;
+    points += QPointF(0, 0);
+    points += QPointF(100, 0);
+    points += QPointF(100, 100);
+    points += QPointF(0, 100);
+
+    VLayoutPiece piece;
+    piece.SetCountourPoints(points);
+
+    piece.SetLayoutWidth(10);
+    piece.SetLayoutAllowancePoints();
+    const QRectF narrow = piece.LayoutBoundingRect();
+    const qreal narrowDiagonal = piece.Diagonal();
+    QVERIFY(narrow.contains(QRectF(0, 0, 100, 100)));
+
+    piece.SetLayoutWidth(20);
+    piece.SetLayoutAllowancePoints();
+    const QRectF wide = piece.LayoutBoundingRect();
+
+    QVERIFY(wide.width() > narrow.width());
+    QVERIFY(wide.height() > narrow.height());
+    QVERIFY(wide.contains(narrow));
+    QVERIFY(piece.Diagonal() > narrowDiagonal);
+
+    // Edges of the new allowance lie 20 away from the contour, the old ones only 10.
+    const QRectF inner(-15, -15, 130, 130);
+    QVERIFY(piece.LayoutEdgesCount() > 0);
+    for (int i = 1; i <= piece.LayoutEdgesCount(); ++i)
+    {
+        const QLineF edge = piece.LayoutEdge(i);
+        QVERIFY2(not inner.contains(edge.p1()), qUtf8Printable(QString("Edge %1 is stale.").arg(i)));
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VLayoutDetail::Case1() const
 {
@@ -62,6 +62,7 @@ class TST_VLayoutDetail : public AbstractTest
 
 private slots:
     void RemoveDublicates() const;
+    void LayoutAllowanceCache() const;
 
 private:
     void Case1() const;
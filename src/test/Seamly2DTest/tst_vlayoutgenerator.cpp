@@ -0,0 +1,139 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vlayoutgenerator.h"
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutpiece.h"
+
+#include <QEventLoop>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QVector<VLayoutPiece> RectanglePieces(int count)
+{
+    QVector<VLayoutPiece> pieces;
+    for (int i = 0; i < count; ++i)
+    {
+        // Vary sizes a little bit to get something closer to a real marker
+        const qreal width = 100 + (i % 5) * 20;
+        const qreal height = 150 + (i % 3) * 40;
+
+        QVector<QPointF> points;
+        points += QPointF(0, 0);
+        points += QPointF(width, 0);
+        points += QPointF(width, height);
+        points += QPointF(0, height);
+
+        VLayoutPiece piece;
+        piece.SetCountourPoints(points);
+        pieces.append(piece);
+    }
+    return pieces;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VLayoutGenerator::TST_VLayoutGenerator(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutGenerator::GenerateAllPieces_data() const
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("10 pieces") << 10;
+    QTest::newRow("30 pieces") << 30;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutGenerator::GenerateAllPieces() const
+{
+    QFETCH(int, count);
+
+    VLayoutGenerator generator;
+    generator.setPieces(RectanglePieces(count));
+    generator.SetLayoutWidth(5);
+    generator.SetPaperWidth(1000);
+    generator.SetPaperHeight(3000);
+    generator.SetPrinterFields(false, QMarginsF());
+    generator.SetRotationIncrease(90);
+    generator.SetHeadless(true);
+    generator.Generate();
+
+    QVERIFY(generator.State() == LayoutErrors::NoError);
+
+    int arranged = 0;
+    const QVector<QVector<VLayoutPiece>> papers = generator.getAllPieces();
+    for (int i = 0; i < papers.size(); ++i)
+    {
+        arranged += papers.at(i).size();
+    }
+    QCOMPARE(arranged, count);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutGenerator::GenerateInBackground() const
+{
+    const int count = 30;
+
+    VLayoutGenerator generator;
+    generator.setPieces(RectanglePieces(count));
+    generator.SetLayoutWidth(5);
+    generator.SetPaperWidth(600);
+    generator.SetPaperHeight(600);
+    generator.SetPrinterFields(false, QMarginsF());
+    generator.SetRotationIncrease(90);
+
+    QVector<int> streamed;
+    int streamedPieces = 0;
+    QEventLoop loop;
+    connect(&generator, &VLayoutGenerator::PaperArranged, &loop,
+            [&streamed, &streamedPieces](int index, const VLayoutPaper &paper)
+    {
+        streamed.append(index);
+        streamedPieces += paper.Count();
+    });
+    connect(&generator, &VLayoutGenerator::Finished, &loop, &QEventLoop::quit);
+    connect(&generator, &VLayoutGenerator::Error, &loop, &QEventLoop::quit);
+
+    generator.GenerateInBackground();
+    loop.exec();
+    generator.Wait();
+
+    QVERIFY(not generator.IsRunning());
+    QVERIFY(generator.State() == LayoutErrors::NoError);
+    QVERIFY(generator.IsPaperStreamFinal());
+
+    const int sheets = generator.getAllPieces().size();
+    QVERIFY(sheets > 1);
+    QCOMPARE(streamed.size(), sheets);
+    for (int i = 0; i < streamed.size(); ++i)
+    {
+        QCOMPARE(streamed.at(i), i);
+    }
+    QCOMPARE(streamedPieces, count);
+}
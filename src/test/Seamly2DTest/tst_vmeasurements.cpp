@@ -264,3 +264,49 @@ void TST_Measurements::ValidPMCodesIndividualFile()
         }
     }
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ValidationStamps check that validated content gets one stamp and invalid content is never stamped.
+ */
+void TST_Measurements::ValidationStamps()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString stampsFile = dir.path() + QLatin1String("/validation.stamps");
+    VDomDocument::SetValidationStampsFile(stampsFile);
+
+    Unit mUnit = Unit::Cm;
+    QSharedPointer<VContainer> data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit));
+    QSharedPointer<MeasurementDoc> m = QSharedPointer<MeasurementDoc>(new MeasurementDoc(mUnit, data.data()));
+
+    const QString fileName = dir.path() + QLatin1String("/empty.smis");
+    QString saveError;
+    QVERIFY2(m->SaveDocument(fileName, saveError), saveError.toUtf8().constData());
+
+    auto CountStamps = [stampsFile]()
+    {
+        QFile file(stampsFile);
+        return file.open(QIODevice::ReadOnly) ? file.readAll().count('\n') : 0;
+    };
+
+    try
+    {
+        VDomDocument::ValidateXML(IndividualSizeConverter::CurrentSchema, fileName);
+        VDomDocument::ValidateXML(IndividualSizeConverter::CurrentSchema, fileName);
+    }
+    catch (VException &error)
+    {
+        VDomDocument::SetValidationStampsFile(QString());
+        QFAIL(error.ErrorMessage().toUtf8().constData());
+    }
+    QCOMPARE(CountStamps(), 1);
+
+    QBuffer invalid;
+    invalid.setData("<?xml version=\"1.0\" encoding=\"UTF-8\"?><smis><unknown/></smis>");
+    QVERIFY_EXCEPTION_THROWN(VDomDocument::ValidateXML(IndividualSizeConverter::CurrentSchema, &invalid,
+                                                       QLatin1String("invalid.smis")), VException);
+    QCOMPARE(CountStamps(), 1);
+
+    VDomDocument::SetValidationStampsFile(QString());
+}
@@ -66,6 +66,8 @@ private slots:
 
     void ValidPMCodesMultisizeFile();
     void ValidPMCodesIndividualFile();
+
+    void ValidationStamps();
 };
 
 #endif // TST_VMEASUREMENTS_H
@@ -0,0 +1,300 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vobjengine.h"
+#include "../vobj/vobjpaintdevice.h"
+
+#include <QBuffer>
+#include <QFont>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPolygonF>
+#include <QtMath>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+qreal Area(const QVector<QPointF> &points)
+{
+    qreal area = 0;
+    for (int i = 0; i < points.size(); ++i)
+    {
+        const QPointF &p1 = points.at(i);
+        const QPointF &p2 = points.at((i + 1) % points.size());
+        area += p1.x() * p2.y() - p2.x() * p1.y();
+    }
+    return qAbs(area) / 2;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool InsideFace(const QPointF &p, const QVector<QPointF> &face)
+{
+    qreal sign = 0;
+    for (int i = 0; i < face.size(); ++i)
+    {
+        const QPointF &a = face.at(i);
+        const QPointF &b = face.at((i + 1) % face.size());
+        const qreal cross = (b.x() - a.x()) * (p.y() - a.y()) - (b.y() - a.y()) * (p.x() - a.x());
+        if (sign * cross < 0)
+        {
+            return false;
+        }
+        if (not qFuzzyIsNull(cross))
+        {
+            sign = cross;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CheckFill faces must cover filled parts of the path and leave holes empty.
+ *
+ * Points of a grid not too close to the outline are checked against the path, the area of faces must match the
+ * filled part of the grid.
+ */
+void CheckFill(const QPainterPath &path)
+{
+    const QSize size(2000, 2000);
+    QBuffer buffer;
+    VObjPaintDevice generator;
+    generator.setOutputDevice(&buffer);
+    generator.setSize(size);
+
+    QPainter painter;
+    QVERIFY(painter.begin(&generator));
+    painter.drawPath(path);
+    QVERIFY(painter.end());
+
+    // Back from OBJ coordinates to the device
+    const qreal half = qFloor(size.width()/2.0);
+    QVector<QPointF> vertices;
+    QVector<QVector<QPointF>> faces;
+    const QList<QByteArray> lines = buffer.data().split('\n');
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        const QList<QByteArray> items = lines.at(i).split(' ');
+        if (items.first() == "v")
+        {
+            vertices.append(QPointF((items.at(1).toDouble() + 1) * half, (1 - items.at(2).toDouble()) * half));
+        }
+        else if (items.first() == "f")
+        {
+            QCOMPARE(items.size(), 4);
+            QVector<QPointF> face;
+            for (int j = 1; j < items.size(); ++j)
+            {
+                const int index = items.at(j).toInt();
+                QVERIFY(index >= 1 && index <= vertices.size());
+                face.append(vertices.at(index - 1));
+            }
+            faces.append(face);
+        }
+    }
+    QVERIFY(not faces.isEmpty());
+
+    const QRectF rect = path.boundingRect();
+    const int steps = 100;
+    const qreal margin = 0.5;
+    int filled = 0;
+    int checked = 0;
+    for (int i = 0; i < steps; ++i)
+    {
+        for (int j = 0; j < steps; ++j)
+        {
+            const QPointF p(rect.left() + rect.width() * (i + 0.5) / steps,
+                            rect.top() + rect.height() * (j + 0.5) / steps);
+            const bool inside = path.contains(p);
+            if (path.contains(p + QPointF(margin, 0)) != inside || path.contains(p - QPointF(margin, 0)) != inside
+                || path.contains(p + QPointF(0, margin)) != inside || path.contains(p - QPointF(0, margin)) != inside)
+            {
+                continue; // Too close to the outline
+            }
+
+            bool covered = false;
+            for (int k = 0; k < faces.size() && not covered; ++k)
+            {
+                covered = InsideFace(p, faces.at(k));
+            }
+            QVERIFY2(covered == inside, qUtf8Printable(QString("Point (%1; %2) must be %3.").arg(p.x()).arg(p.y())
+                                                       .arg(inside ? "covered" : "empty")));
+            ++checked;
+            filled += inside ? 1 : 0;
+        }
+    }
+    QVERIFY(checked > steps * steps / 2);
+
+    qreal facesArea = 0;
+    for (int i = 0; i < faces.size(); ++i)
+    {
+        facesArea += Area(faces.at(i));
+    }
+
+    // Samples skipped near the outline make the estimate rough, overlapping faces would exceed it
+    const qreal cell = rect.width() * rect.height() / (steps * steps);
+    const qreal area = filled * cell;
+    QVERIFY2(qAbs(facesArea - area) <= area * 0.1,
+             qUtf8Printable(QString("Faces cover %1, filled %2.").arg(facesArea).arg(area)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QPolygonF CombOutline(int teeth)
+{
+    QPolygonF outline;
+    outline << QPointF(10, 500);
+    for (int i = 0; i < teeth; ++i)
+    {
+        outline << QPointF(10 + i * 4 + 1, 500) << QPointF(10 + i * 4 + 1, 400) << QPointF(10 + i * 4 + 3, 400)
+                << QPointF(10 + i * 4 + 3, 500);
+    }
+    outline << QPointF(10 + teeth * 4, 500) << QPointF(10 + teeth * 4, 550) << QPointF(10, 550);
+    return outline;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QPolygonF WavyOutline(int count)
+{
+    QPolygonF outline;
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal angle = 2 * M_PI * i / count;
+        const qreal r = 800 + 60 * qSin(angle * 24);
+        outline << QPointF(1000 + r * qCos(angle), 1000 + r * qSin(angle));
+    }
+    return outline;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VObjEngine::TST_VObjEngine(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VObjEngine::TestTriangulation_data() const
+{
+    QTest::addColumn<QPolygonF>("outline");
+
+    QPolygonF square;
+    square << QPointF(100, 100) << QPointF(600, 100) << QPointF(600, 600) << QPointF(100, 600);
+    QTest::newRow("square") << square;
+
+    QPolygonF lShape;
+    lShape << QPointF(100, 100) << QPointF(900, 100) << QPointF(900, 300) << QPointF(300, 300) << QPointF(300, 900)
+           << QPointF(100, 900);
+    QTest::newRow("L shape") << lShape;
+
+    QTest::newRow("comb, 400 teeth") << CombOutline(400);
+    QTest::newRow("wavy, 5000 points") << WavyOutline(5000);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestTriangulation faces of a plane must cover exactly the outline, without extra vertices.
+ */
+void TST_VObjEngine::TestTriangulation() const
+{
+    QFETCH(QPolygonF, outline);
+
+    QBuffer buffer;
+    VObjPaintDevice generator;
+    generator.setOutputDevice(&buffer);
+    generator.setSize(QSize(2000, 2000));
+
+    QPainterPath path;
+    path.addPolygon(outline);
+    path.closeSubpath();
+
+    QPainter painter;
+    QVERIFY(painter.begin(&generator));
+    painter.drawPath(path);
+    QVERIFY(painter.end());
+
+    QVector<QPointF> vertices;
+    qreal facesArea = 0;
+    int faces = 0;
+    const QList<QByteArray> lines = buffer.data().split('\n');
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        const QList<QByteArray> items = lines.at(i).split(' ');
+        if (items.first() == "v")
+        {
+            vertices.append(QPointF(items.at(1).toDouble(), items.at(2).toDouble()));
+        }
+        else if (items.first() == "f")
+        {
+            QCOMPARE(items.size(), 4);
+            QVector<QPointF> face;
+            for (int j = 1; j < items.size(); ++j)
+            {
+                const int index = items.at(j).toInt();
+                QVERIFY(index >= 1 && index <= vertices.size());
+                face.append(vertices.at(index - 1));
+            }
+            facesArea += Area(face);
+            ++faces;
+        }
+    }
+
+    QCOMPARE(vertices.size(), outline.size());
+    QVERIFY(faces > 0 && faces <= outline.size() - 2);
+    const qreal area = Area(vertices);
+    QVERIFY2(qAbs(facesArea - area) <= area * 1e-6,
+             qUtf8Printable(QString("Faces cover %1, outline %2.").arg(facesArea).arg(area)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestRing the hole of a ring must stay empty.
+ */
+void TST_VObjEngine::TestRing() const
+{
+    QPainterPath path;
+    path.addEllipse(QPointF(1000, 1000), 800, 800);
+    path.addEllipse(QPointF(1000, 1000), 400, 400);
+    path.addRect(QRectF(950, 950, 100, 100)); // Island inside the hole
+
+    CheckFill(path);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestText counters of glyphs must stay empty.
+ */
+void TST_VObjEngine::TestText() const
+{
+    QFont font;
+    font.setPixelSize(500);
+
+    QPainterPath path;
+    path.addText(QPointF(100, 1200), font, QStringLiteral("B&o8"));
+    if (path.isEmpty())
+    {
+        QSKIP("No font to draw text.");
+    }
+
+    CheckFill(path);
+}
@@ -0,0 +1,197 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vpatterngraph.h"
+#include "../ifc/xml/vpatterngraph.h"
+#include "../ifc/ifcdef.h"
+
+#include <QtTest>
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VPatternGraph::TST_VPatternGraph(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestOwner objects created by a tool belong to the tool.
+ */
+void TST_VPatternGraph::TestOwner() const
+{
+    VPatternGraph graph;
+    graph.AddVertex(1, "A");
+    graph.AddVertex(5, "A"); // Cut spline, creates objects 6 and 7
+    graph.AddVertex(8, "A");
+
+    QCOMPARE(graph.Owner(NULL_ID), NULL_ID);
+    QCOMPARE(graph.Owner(1), 1u);
+    QCOMPARE(graph.Owner(4), 1u);
+    QCOMPARE(graph.Owner(6), 5u);
+    QCOMPARE(graph.Owner(7), 5u);
+    QCOMPARE(graph.Owner(100), 8u);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestDependents only the changed object and its transitive dependents in parse order must be returned.
+ */
+void TST_VPatternGraph::TestDependents() const
+{
+    VPatternGraph graph;
+    // Parse order differs from id order, tool 20 was inserted in the middle of history.
+    graph.AddVertex(1, "A");
+    graph.AddVertex(2, "A");
+    graph.AddVertex(20, "A");
+    graph.AddVertex(3, "A");
+    graph.AddVertex(4, "A");
+    graph.AddVertex(5, "A");
+
+    graph.AddEdge(1, 2);
+    graph.AddEdge(2, 20);
+    graph.AddEdge(20, 4);
+    graph.AddEdge(1, 3);
+    graph.AddEdge(3, 5);
+    graph.AddEdge(4, 5);
+
+    QCOMPARE(graph.Dependents(2), QVector<quint32>() << 2 << 20 << 4 << 5);
+    QCOMPARE(graph.Dependents(3), QVector<quint32>() << 3 << 5);
+    QCOMPARE(graph.Dependents(5), QVector<quint32>() << 5);
+    QCOMPARE(graph.Dependents(1), QVector<quint32>() << 1 << 2 << 20 << 3 << 4 << 5);
+    QCOMPARE(graph.Dependents(NULL_ID), QVector<quint32>());
+
+    graph.Clear();
+    QVERIFY(graph.IsEmpty());
+    QCOMPARE(graph.Dependents(2), QVector<quint32>());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPatternGraph::TestIncomplete() const
+{
+    VPatternGraph graph;
+    graph.AddVertex(1, "A");
+    graph.AddVertex(2, "B");
+    QVERIFY(graph.IsComplete("A"));
+    QVERIFY(graph.IsComplete("B"));
+
+    graph.SetIncomplete("B");
+    QVERIFY(graph.IsComplete("A"));
+    QVERIFY(not graph.IsComplete("B"));
+    QCOMPARE(graph.DraftBlock(2), QString("B"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestChangedDependency a formula edit replaces dependencies of the element, the new source must update it.
+ */
+void TST_VPatternGraph::TestChangedDependency() const
+{
+    VPatternGraph graph;
+    graph.AddVertex(1, "A");
+    graph.AddVertex(2, "A");
+    graph.AddVertex(3, "A");
+    graph.AddVertex(4, "A");
+    graph.AddEdge(1, 3);
+    graph.AddEdge(3, 4);
+
+    QCOMPARE(graph.Dependents(2), QVector<quint32>() << 2);
+
+    // Formula of tool 3 now uses a variable of point 2 instead of point 1.
+    graph.RemoveEdgesTo(3);
+    graph.AddEdge(2, 3);
+
+    QCOMPARE(graph.Dependents(2), QVector<quint32>() << 2 << 3 << 4);
+    QCOMPARE(graph.Dependents(1), QVector<quint32>() << 1);
+    QCOMPARE(graph.Dependents(3), QVector<quint32>() << 3 << 4);
+
+    graph.RemoveEdgesTo(3);
+    graph.AddEdge(1, 3);
+    graph.AddEdge(2, 3);
+    QCOMPARE(graph.Dependents(1), QVector<quint32>() << 1 << 3 << 4);
+    QCOMPARE(graph.Dependents(2), QVector<quint32>() << 2 << 3 << 4);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestVariableUsers elements that use a custom variable in formulas, a formula edit can stop using it.
+ */
+void TST_VPatternGraph::TestVariableUsers() const
+{
+    VPatternGraph graph;
+    graph.AddVertex(1, "A");
+    graph.AddVertex(10, "A");
+    graph.AddVertex(2, "A");
+    graph.AddVertex(3, "A");
+    graph.AddEdge(2, 3);
+
+    graph.AddVariableUse("#a", 2);
+    graph.AddVariableUse("#a", 10);
+    graph.AddVariableUse("#b", 3);
+    graph.AddVariableUse("#b", 100); // Unknown element
+
+    QCOMPARE(graph.VariableUsers("#a"), QVector<quint32>() << 10 << 2);
+    QCOMPARE(graph.VariableUsers("#b"), QVector<quint32>() << 3);
+    QCOMPARE(graph.VariableUsers("#c"), QVector<quint32>());
+
+    // Formula of tool 2 doesn't use the variable anymore.
+    graph.RemoveEdgesTo(2);
+    QCOMPARE(graph.VariableUsers("#a"), QVector<quint32>() << 10);
+    QCOMPARE(graph.Dependents(2), QVector<quint32>() << 2 << 3);
+
+    graph.Clear();
+    QCOMPARE(graph.VariableUsers("#b"), QVector<quint32>());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestLargePatternEdit changing a point at the end of a big pattern must touch only a few objects.
+ *
+ * The pattern is a set of independent chains of tools, like fronts, backs and sleeves of a draft block.
+ */
+void TST_VPatternGraph::TestLargePatternEdit() const
+{
+    const int chains = 50;
+    const int length = 100;
+
+    VPatternGraph graph;
+    quint32 id = 1;
+    graph.AddVertex(id, "A"); // Base point
+    for (int i = 0; i < chains; ++i)
+    {
+        quint32 previous = 1;
+        for (int j = 0; j < length; ++j)
+        {
+            ++id;
+            graph.AddVertex(id, "A");
+            graph.AddEdge(previous, id);
+            previous = id;
+        }
+    }
+
+    const quint32 changed = id - 4;
+
+    const QVector<quint32> dependents = graph.Dependents(changed);
+
+    QCOMPARE(dependents, QVector<quint32>() << changed << changed + 1 << changed + 2 << changed + 3 << changed + 4);
+    QCOMPARE(graph.Dependents(1).size(), chains * length + 1);
+}
@@ -0,0 +1,217 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vpersistenthash.h"
+#include "../vpatterndb/vpersistenthash.h"
+
+#include <QHash>
+#include <QtTest>
+#include <functional>
+
+namespace
+{
+/**
+ * @brief The CollidingKey struct has only four hash values, most keys end in collision nodes.
+ */
+struct CollidingKey
+{
+    int key;
+
+    bool operator==(const CollidingKey &other) const
+    {
+        return key == other.key;
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+uint qHash(const CollidingKey &key)
+{
+    return static_cast<uint>(key.key % 4) * 0x40000000u;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key>
+bool SameContent(const VPersistentHash<Key, int> &hash, const QHash<int, int> &reference,
+                 const std::function<int(const Key &)> &toInt)
+{
+    if (hash.size() != reference.size())
+    {
+        return false;
+    }
+
+    int count = 0;
+    for (auto i = hash.constBegin(); i != hash.constEnd(); ++i)
+    {
+        ++count;
+        const int key = toInt(i.key());
+        if (not reference.contains(key) || reference.value(key) != i.value())
+        {
+            return false;
+        }
+    }
+    return count == reference.size();
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VPersistentHash::TST_VPersistentHash(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPersistentHash::TestInsertValue() const
+{
+    VPersistentHash<QString, int> hash;
+    QVERIFY(hash.isEmpty());
+    QCOMPARE(hash.value(QStringLiteral("a")), 0);
+    QCOMPARE(hash.value(QStringLiteral("a"), -1), -1);
+    QVERIFY(hash.constBegin() == hash.constEnd());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        hash.insert(QString::number(i), i);
+    }
+    hash.insert(QStringLiteral("10"), 100);
+
+    QCOMPARE(hash.size(), 1000);
+    QCOMPARE(hash.value(QStringLiteral("10")), 100);
+    QCOMPARE(hash.value(QStringLiteral("999")), 999);
+    QVERIFY(not hash.contains(QStringLiteral("1000")));
+    QCOMPARE(hash.keys().size(), 1000);
+
+    QCOMPARE(hash.remove(QStringLiteral("1000")), 0);
+    QCOMPARE(hash.remove(QStringLiteral("10")), 1);
+    QCOMPARE(hash.size(), 999);
+    QVERIFY(not hash.contains(QStringLiteral("10")));
+
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    QVERIFY(hash.constBegin() == hash.constEnd());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestCollisions keys with equal hashes must be kept apart.
+ */
+void TST_VPersistentHash::TestCollisions() const
+{
+    VPersistentHash<CollidingKey, int> hash;
+    QHash<int, int> reference;
+    for (int i = 0; i < 200; ++i)
+    {
+        hash.insert(CollidingKey{i}, i * 2);
+        reference.insert(i, i * 2);
+    }
+    QVERIFY(SameContent<CollidingKey>(hash, reference, [](const CollidingKey &key) { return key.key; }));
+
+    for (int i = 0; i < 200; i += 3)
+    {
+        QCOMPARE(hash.remove(CollidingKey{i}), 1);
+        reference.remove(i);
+    }
+    QVERIFY(SameContent<CollidingKey>(hash, reference, [](const CollidingKey &key) { return key.key; }));
+    QCOMPARE(hash.value(CollidingKey{1}), 2);
+    QVERIFY(not hash.contains(CollidingKey{3}));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestRandomOperations compare a long run of inserts and removes with QHash.
+ */
+void TST_VPersistentHash::TestRandomOperations() const
+{
+    // Own generator keeps the sequence same on all platforms
+    quint32 seed = 1;
+    auto Random = [&seed]()
+    {
+        seed = seed * 1103515245u + 12345u;
+        return static_cast<int>((seed >> 16) & 0x7FFF);
+    };
+
+    VPersistentHash<quint32, int> hash;
+    QHash<int, int> reference;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int key = Random() % 3000;
+        if (Random() % 3 != 0)
+        {
+            hash.insert(static_cast<quint32>(key), i);
+            reference.insert(key, i);
+        }
+        else
+        {
+            QCOMPARE(hash.remove(static_cast<quint32>(key)), reference.remove(key));
+        }
+    }
+    QVERIFY(SameContent<quint32>(hash, reference, [](const quint32 &key) { return static_cast<int>(key); }));
+
+    const QList<int> keys = reference.keys();
+    for (int i = 0; i < keys.size(); ++i)
+    {
+        hash.remove(static_cast<quint32>(keys.at(i)));
+    }
+    QVERIFY(hash.isEmpty());
+    QVERIFY(hash.constBegin() == hash.constEnd());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestCopyOnWrite a write must not be seen by copies and must copy only a small part of the trie.
+ */
+void TST_VPersistentHash::TestCopyOnWrite() const
+{
+    VPersistentHash<quint32, int> hash;
+    QHash<int, int> reference;
+    for (int i = 0; i < 5000; ++i)
+    {
+        hash.insert(static_cast<quint32>(i), i);
+        reference.insert(i, i);
+    }
+
+    QVector<VPersistentHash<quint32, int>> copies;
+    for (int i = 0; i < 100; ++i)
+    {
+        copies.append(hash);
+        hash.insert(static_cast<quint32>(i), -i);
+        hash.remove(static_cast<quint32>(4999 - i));
+    }
+
+    const auto toInt = [](const quint32 &key) { return static_cast<int>(key); };
+    QVERIFY(SameContent<quint32>(copies.first(), reference, toInt));
+    QCOMPARE(copies.at(50).value(10), -10);
+    QCOMPARE(copies.at(50).value(60), 60);
+    QVERIFY(not copies.at(50).contains(4999));
+    QVERIFY(copies.at(50).contains(4949));
+    QCOMPARE(hash.size(), 4900);
+
+    QSet<const void *> visited;
+    const qint64 single = hash.MemoryUsage(&visited);
+    qint64 total = single;
+    for (int i = 0; i < copies.size(); ++i)
+    {
+        total += copies.at(i).MemoryUsage(&visited);
+    }
+    // Full copies would take a hundred times more
+    QVERIFY2(total < single * 10, qUtf8Printable(QString("%1 bytes for copies of %2").arg(total).arg(single)));
+}
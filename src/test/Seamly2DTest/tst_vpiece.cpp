@@ -277,3 +277,46 @@ void TST_VPiece::Issue620()
     // Begin comparison
     Comparison(pointsEkv, origPoints);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPiece::GeometryCache()
+{
+    const Unit unit = Unit::Mm;
+    QScopedPointer<VContainer> data(new VContainer(nullptr, &unit));
+    qApp->setPatternUnit(unit);
+
+    data->UpdateGObject(1, new VPointF(0, 0, "A1", 5, 10));
+    data->UpdateGObject(2, new VPointF(400, 0, "A2", 5, 10));
+    data->UpdateGObject(3, new VPointF(400, 600, "A3", 5, 10));
+    data->UpdateGObject(4, new VPointF(0, 600, "A4", 5, 10));
+
+    auto CreatePiece = [](qreal width)
+    {
+        VPiece piece;
+        piece.SetSeamAllowance(true);
+        piece.SetSAWidth(width);
+        piece.GetPath().Append(VPieceNode(1, Tool::NodePoint));
+        piece.GetPath().Append(VPieceNode(2, Tool::NodePoint));
+        piece.GetPath().Append(VPieceNode(3, Tool::NodePoint));
+        piece.GetPath().Append(VPieceNode(4, Tool::NodePoint));
+        return piece;
+    };
+
+    const quint32 id = data->AddPiece(CreatePiece(7));
+    const VPiece piece = data->GetPiece(id);
+
+    const QVector<QPointF> seamAllowance = piece.SeamAllowancePoints(data.data());
+    Comparison(piece.SeamAllowancePoints(data.data()), seamAllowance);
+    Comparison(piece.MainPathPoints(data.data()), CreatePiece(7).MainPathPoints(data.data()));
+
+    // Moving a point must not return geometry of the old position
+    data->UpdateGObject(3, new VPointF(500, 700, "A3", 5, 10));
+    const QVector<QPointF> moved = piece.SeamAllowancePoints(data.data());
+    QVERIFY(moved != seamAllowance);
+    Comparison(moved, CreatePiece(7).SeamAllowancePoints(data.data()));
+    Comparison(piece.MainPathPoints(data.data()), CreatePiece(7).MainPathPoints(data.data()));
+
+    // Updated piece takes the cache of the previous version, but a new width still gives new geometry
+    data->UpdatePiece(id, CreatePiece(10));
+    Comparison(data->GetPiece(id).SeamAllowancePoints(data.data()), CreatePiece(10).SeamAllowancePoints(data.data()));
+}
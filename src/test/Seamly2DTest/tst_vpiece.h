@@ -63,6 +63,7 @@ class TST_VPiece : public AbstractTest
 private slots:
     void ClearLoop();
     void Issue620();
+    void GeometryCache();
 
 private:
     Q_DISABLE_COPY(TST_VPiece)
@@ -54,6 +54,7 @@
  *************************************************************************/
 
 #include "tst_vspline.h"
+#include "../vgeometry/vcubicbezier.h"
 #include "../vgeometry/vspline.h"
 #include "../vmisc/logging.h"
 
@@ -482,3 +483,30 @@ void TST_VSpline::CompareSplines(const VSpline &spl1, const VSpline &spl2) const
     // Compare points
     Comparison(spl1.getPoints(), spl2.getPoints());
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::TestCachedPoints()
+{
+    const VPointF p1(1168.8582803149607, 39.999874015748034, "p1", 5.0000125984251973, 9.9999874015748045);
+    const VPointF p2(1246.6446, 305.9451, "p2", 5.0000125984251973, 9.9999874015748045);
+    const VPointF p3(739.2853, 1726.4935, "p3", 5.0000125984251973, 9.9999874015748045);
+    const VPointF p4(681.33729132409951, 1815.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+    const VPointF p5(881.33729132409951, 1215.7969526662778, "p5", 5.0000125984251973, 9.9999874015748045);
+
+    const VCubicBezier curve(p1, p2, p3, p4);
+    const qreal length = curve.GetLength();
+    QCOMPARE(length, VAbstractCurve::PathLength(curve.getPoints()));
+
+    // Changing a copy must drop its calculated points and leave the original untouched.
+    VCubicBezier changed = curve;
+    QCOMPARE(changed.GetLength(), length);
+    changed.SetP4(p5);
+
+    const VCubicBezier expected(p1, p2, p3, p5);
+    QCOMPARE(changed.getPoints(), expected.getPoints());
+    QCOMPARE(changed.GetLength(), expected.GetLength());
+    QCOMPARE(curve.GetLength(), length);
+
+    const qreal halfLength = changed.GetLength()/2.0;
+    QVERIFY(qAbs(changed.LengthT(changed.GetParmT(halfLength)) - halfLength) <= 0.001 * halfLength);
+}
@@ -76,6 +76,7 @@ private slots:
     void TestLengthByPoint();
     void TestFlip_data();
     void TestFlip();
+    void TestCachedPoints();
 
 private:
     Q_DISABLE_COPY(TST_VSpline)
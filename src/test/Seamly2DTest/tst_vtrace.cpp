@@ -0,0 +1,115 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026  Seamly, LLC                                       *
+ *                                                                         *
+ *   https://github.com/fashionfreedom/seamly2d                             *
+ *                                                                         *
+ ***************************************************************************
+ **
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ **************************************************************************/
+
+#include "tst_vtrace.h"
+#include "../vmisc/vtrace.h"
+
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+void TracedWork()
+{
+    V_TRACE_SCOPE("test", "TracedWork");
+    QThread::msleep(2);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+class TracedThread : public QThread
+{
+protected:
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        TracedWork();
+    }
+};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VTrace::TST_VTrace(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTrace::TestDisabledByDefault() const
+{
+    QVERIFY(not VTrace::IsEnabled());
+    TracedWork();
+    QVERIFY(not VTrace::Save());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TestTraceEventFormat spans from different threads must be saved as complete events of own threads, a
+ * counter as a counter event.
+ */
+void TST_VTrace::TestTraceEventFormat() const
+{
+    // Tracing can't be disabled again, it stays on for the rest of the run
+    const QString fileName = QDir::temp().absoluteFilePath(QStringLiteral("seamly2d_tst_vtrace.json"));
+    VTrace::Enable(fileName);
+    QVERIFY(VTrace::IsEnabled());
+
+    TracedWork();
+    TracedThread thread;
+    thread.start();
+    QVERIFY(thread.wait(10000));
+    VTrace::AddCounter("test", "Bytes", 4096);
+
+    QVERIFY(VTrace::Save());
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QJsonParseError error;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    QVERIFY2(error.error == QJsonParseError::NoError, qUtf8Printable(error.errorString()));
+
+    const QJsonArray events = doc.object().value(QStringLiteral("traceEvents")).toArray();
+    QCOMPARE(events.size(), 3);
+
+    const QJsonObject counter = events.last().toObject();
+    QCOMPARE(counter.value(QStringLiteral("name")).toString(), QStringLiteral("Bytes"));
+    QCOMPARE(counter.value(QStringLiteral("ph")).toString(), QStringLiteral("C"));
+    QCOMPARE(counter.value(QStringLiteral("args")).toObject().value(QStringLiteral("value")).toInt(), 4096);
+
+    QSet<int> threads;
+    for (int i = 0; i < events.size() - 1; ++i)
+    {
+        const QJsonObject event = events.at(i).toObject();
+        QCOMPARE(event.value(QStringLiteral("name")).toString(), QStringLiteral("TracedWork"));
+        QCOMPARE(event.value(QStringLiteral("cat")).toString(), QStringLiteral("test"));
+        QCOMPARE(event.value(QStringLiteral("ph")).toString(), QStringLiteral("X"));
+        QVERIFY(event.value(QStringLiteral("ts")).toDouble() >= 0);
+        QVERIFY(event.value(QStringLiteral("dur")).toDouble() >= 1000);
+        threads.insert(event.value(QStringLiteral("tid")).toInt());
+    }
+    QCOMPARE(threads.size(), 2);
+}
@@ -5,3 +5,7 @@ SUBDIRS = \
     Seamly2DTest \
     TranslationsTest \
     CollectionTest
+
+benchmarks{ # Long running, for enable run qmake with CONFIG+=benchmarks
+    SUBDIRS += BenchmarkTest
+}